@@ -3390,6 +3390,12 @@ void TemplateTable::fast_accessfield(TosState state) {
   }
 }
 
+void TemplateTable::fast_agetfield_ifnull() {
+  transition(atos, vtos);
+  // The getfield/ifnull pair is only fused on x86.
+  __ stop("fast_agetfield_ifnull: should not be rewritten");
+}
+
 void TemplateTable::fast_xaccess(TosState state) {
   transition(vtos, state);
 
@@ -2898,6 +2898,12 @@ void TemplateTable::putstatic(int byte_no) {
   putfield_or_static(byte_no, true);
 }
 
+void TemplateTable::fast_agetfield_ifnull() {
+  transition(atos, vtos);
+  // The getfield/ifnull pair is only fused on x86.
+  __ stop("fast_agetfield_ifnull: should not be rewritten");
+}
+
 void TemplateTable::fast_xaccess(TosState state) {
   transition(vtos, state);
   Register Rcache = G3_scratch;
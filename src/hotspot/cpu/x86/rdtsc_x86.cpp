@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "rdtsc_x86.hpp"
+#include "runtime/task.hpp"
 #include "runtime/thread.inline.hpp"
 #include "vm_version_ext_x86.hpp"
 
@@ -168,6 +169,59 @@ static bool ergonomics() {
   return ft_enabled;
 }
 
+static jlong _drift_base_os = 0;
+static jlong _drift_base_tsc = 0;
+
+// Periodically compares the time elapsed according to the tsc-derived
+// counter with the os elapsed counter it was calibrated against. The
+// published or estimated tsc frequency can be off, and a tsc that is
+// not invariant can change rate with power management, in which case
+// time stamps drift away from the os clock for as long as the VM runs.
+// Warns once when the divergence exceeds the threshold. The time source
+// is deliberately not switched at runtime: consumers like JFR have
+// already recorded time stamps and the counter frequency, and values
+// from a different source would not be comparable with them.
+class RdtscDriftCheckTask : public PeriodicTask {
+ private:
+  // Maximum relative divergence tolerated between the two clocks,
+  // in parts per million.
+  static const jlong DRIFT_WARN_THRESHOLD_PPM = 10000; // one percent
+  bool _warned;
+ public:
+  RdtscDriftCheckTask() : PeriodicTask(PeriodicTask::max_interval), _warned(false) {}
+  virtual void task();
+};
+
+void RdtscDriftCheckTask::task() {
+  if (_warned) {
+    return;
+  }
+  const double os_seconds = (double)(os::elapsed_counter() - _drift_base_os) /
+                            (double)os::elapsed_frequency();
+  const double tsc_seconds = (double)(os::rdtsc() - _drift_base_tsc) /
+                             (double)tsc_frequency;
+  assert(os_seconds > 0, "invariant");
+  const jlong drift_ppm = (jlong)(fabsd(tsc_seconds - os_seconds) / os_seconds * 1000000.0);
+  if (drift_ppm > DRIFT_WARN_THRESHOLD_PPM) {
+    warning("The fast time stamp counter drifts " JLONG_FORMAT " ppm relative to the os clock.\n"
+            "Time stamps may be unreliable; consider running with -XX:-UseFastUnorderedTimeStamps.",
+            drift_ppm);
+    _warned = true;
+  }
+}
+
+void Rdtsc::start_drift_check() {
+  static bool started = false;
+  if (started || !rdtsc_elapsed_counter_enabled) {
+    return;
+  }
+  _drift_base_os = os::elapsed_counter();
+  _drift_base_tsc = os::rdtsc();
+  RdtscDriftCheckTask* task = new RdtscDriftCheckTask();
+  task->enroll();
+  started = true;
+}
+
 bool Rdtsc::is_supported() {
   return VM_Version_Ext::supports_tscinv_ext();
 }
@@ -45,6 +45,7 @@ class Rdtsc : AllStatic {
   static bool  is_elapsed_counter_enabled(); // turn off with -XX:-UseFastUnorderedTimeStamps
   static jlong epoch();
   static bool  initialize();
+  static void  start_drift_check(); // periodically verify tsc time against the os clock
 };
 
 #endif // CPU_X86_RDTSC_X86_HPP
@@ -5223,6 +5223,115 @@ address generate_avx_ghash_processBlocks() {
     return start;
   }
 
+  /**
+   *  Arguments:
+   *
+   *  Input:
+   *    c_rarg0   - ary      address of first element
+   *    c_rarg1   - cnt      number of elements
+   *
+   *  Output:
+   *    rax       - polynomial hash: sum of ary[i]*31^(cnt-1-i)
+   */
+  address generate_string_hashcode(bool is_latin1) {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", is_latin1 ? "stringLatin1HashCode" : "stringUTF16HashCode");
+
+    // Coefficient tables for the vectorized loop: eight lanes of 31^8 to
+    // rescale the accumulator each round, and [31^7, 31^6, ..., 31^0] to
+    // weight the lanes when the loop terminates. All values are mod 2^32,
+    // matching Java's wrapping int arithmetic.
+    __ align(32);
+    address pow31_8 = __ pc();
+    for (int i = 0; i < 8; i++) {
+      __ emit_data(0x94446f01, relocInfo::none, 0);  // 31^8
+    }
+    address coef = __ pc();
+    __ emit_data(0x67e12cdf, relocInfo::none, 0);    // 31^7
+    __ emit_data(0x34e63b41, relocInfo::none, 0);    // 31^6
+    __ emit_data(0x01b4d89f, relocInfo::none, 0);    // 31^5
+    __ emit_data(0x000e1781, relocInfo::none, 0);    // 31^4
+    __ emit_data(0x0000745f, relocInfo::none, 0);    // 31^3
+    __ emit_data(0x000003c1, relocInfo::none, 0);    // 31^2
+    __ emit_data(0x0000001f, relocInfo::none, 0);    // 31^1
+    __ emit_data(0x00000001, relocInfo::none, 0);    // 31^0
+
+    address start = __ pc();
+
+    BLOCK_COMMENT("Entry:");
+    __ enter();
+
+    const Register ary    = c_rarg0;
+    const Register cnt    = c_rarg1;
+    const Register result = rax;    // return value
+    const Register tmp    = r10;
+
+    const XMMRegister vacc  = xmm0;
+    const XMMRegister vdata = xmm1;
+    const XMMRegister vcoef = xmm2;
+
+    Label L_vector_loop, L_scalar_loop, L_scalar_test;
+
+    __ xorl(result, result);
+    __ cmpl(cnt, 8);
+    __ jcc(Assembler::less, L_scalar_test);
+
+    // Eight lanes of partial hashes: every round rescales the lanes by
+    // 31^8 and accumulates the next eight zero-extended elements, so
+    // after the loop lane j holds the partial hash of elements j, j+8,
+    // j+16, ... of the vectorized prefix.
+    __ vpxor(vacc, vacc, vacc, Assembler::AVX_256bit);
+    __ vmovdqu(vcoef, ExternalAddress(pow31_8), tmp);
+
+    __ align(32);
+    __ BIND(L_vector_loop);
+    __ vpmulld(vacc, vacc, vcoef, Assembler::AVX_256bit);
+    if (is_latin1) {
+      __ movq(vdata, Address(ary, 0));      // next 8 bytes
+      __ vpmovzxbw(vdata, vdata, Assembler::AVX_128bit);
+    } else {
+      __ movdqu(vdata, Address(ary, 0));    // next 8 chars
+    }
+    __ vpmovzxwd(vdata, vdata, Assembler::AVX_256bit);
+    __ vpaddd(vacc, vacc, vdata, Assembler::AVX_256bit);
+    __ addptr(ary, is_latin1 ? 8 : 16);
+    __ subl(cnt, 8);
+    __ cmpl(cnt, 8);
+    __ jcc(Assembler::greaterEqual, L_vector_loop);
+
+    // Weight the lanes by their remaining powers of 31 and add them up;
+    // the tail below folds in the at most seven leftover elements.
+    __ vmovdqu(vcoef, ExternalAddress(coef), tmp);
+    __ vpmulld(vacc, vacc, vcoef, Assembler::AVX_256bit);
+    __ vextracti128_high(vdata, vacc);
+    __ vpaddd(vacc, vacc, vdata, Assembler::AVX_128bit);
+    __ phaddd(vacc, vacc);
+    __ phaddd(vacc, vacc);
+    __ movdl(result, vacc);
+    __ jmp(L_scalar_test);
+
+    __ BIND(L_scalar_loop);
+    __ imull(result, result, 31);
+    if (is_latin1) {
+      __ movzbl(tmp, Address(ary, 0));
+      __ addptr(ary, 1);
+    } else {
+      __ movzwl(tmp, Address(ary, 0));
+      __ addptr(ary, 2);
+    }
+    __ addl(result, tmp);
+    __ decrementl(cnt);
+    __ BIND(L_scalar_test);
+    __ testl(cnt, cnt);
+    __ jcc(Assembler::notZero, L_scalar_loop);
+
+    __ vzeroupper();
+    __ leave();
+    __ ret(0);
+
+    return start;
+  }
+
 /**
    *  Arguments:
    *
@@ -6024,6 +6133,11 @@ address generate_avx_ghash_processBlocks() {
     if (UseVectorizedMismatchIntrinsic) {
       StubRoutines::_vectorizedMismatch = generate_vectorizedMismatch();
     }
+
+    if (UseStringHashCodeIntrinsic) {
+      StubRoutines::_stringLatin1HashCode = generate_string_hashcode(true);
+      StubRoutines::_stringUTF16HashCode = generate_string_hashcode(false);
+    }
   }
 
  public:
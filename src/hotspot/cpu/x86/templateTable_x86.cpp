@@ -2925,7 +2925,22 @@ void TemplateTable::getfield_or_static(int byte_no, bool is_static, RewriteContr
   do_oop_load(_masm, field, rax);
   __ push(atos);
   if (!is_static && rc == may_rewrite) {
-    patch_bytecode(Bytecodes::_fast_agetfield, bc, rbx);
+    if (RewriteFrequentPairs) {
+      Label rewrite;
+      // If the next bytecode is an ifnull, fuse the pair: the field load
+      // and the null test are then done without a dispatch in between
+      // (see fast_agetfield_ifnull).
+      __ load_unsigned_byte(rbx,
+                            at_bcp(Bytecodes::length_for(Bytecodes::_getfield)));
+      __ cmpl(rbx, Bytecodes::_ifnull);
+      __ movl(bc, Bytecodes::_fast_agetfield_ifnull);
+      __ jccb(Assembler::equal, rewrite);
+      __ movl(bc, Bytecodes::_fast_agetfield);
+      __ bind(rewrite);
+      patch_bytecode(Bytecodes::_getfield, bc, rbx, false);
+    } else {
+      patch_bytecode(Bytecodes::_fast_agetfield, bc, rbx);
+    }
   }
   __ jmp(Done);
 
@@ -3564,6 +3579,47 @@ void TemplateTable::fast_accessfield(TosState state) {
   //   __ bind(notVolatile);
 }
 
+void TemplateTable::fast_agetfield_ifnull() {
+  transition(atos, vtos);
+
+  // This is the fused getfield/ifnull pair created by getfield_or_static
+  // when the bytecode following an object-field load is an ifnull. The
+  // field load and the null test are performed without a dispatch in
+  // between. Only the common non-null (branch not taken) case is handled
+  // here; on a null value we dispatch to the unmodified _ifnull that still
+  // follows in the bytecode stream, so that taken branches go through the
+  // usual branch profiling and on-stack-replacement machinery.
+
+  // access constant pool cache
+  __ get_cache_and_index_at_bcp(rcx, rbx, 1);
+  // replace index with field offset from cache entry
+  __ movptr(rbx, Address(rcx, rbx, Address::times_ptr,
+                         in_bytes(ConstantPoolCache::base_offset() +
+                                  ConstantPoolCacheEntry::f2_offset())));
+
+  // rax: object
+  __ verify_oop(rax);
+  __ null_check(rax);
+  const Address field(rax, rbx, Address::times_1, 0*wordSize);
+
+  do_oop_load(_masm, field, rax);
+  __ verify_oop(rax);
+
+  Label not_null;
+  __ testptr(rax, rax);
+  __ jcc(Assembler::notZero, not_null);
+
+  // Null: dispatch to the following ifnull with the value as TOS; it will
+  // take the branch.
+  __ dispatch_next(atos, Bytecodes::length_for(Bytecodes::_getfield));
+
+  __ bind(not_null);
+  // Not taken. The mdp still corresponds to the ifnull's BranchData since
+  // a getfield has no profile data of its own, so profile the branch like
+  // if_nullcmp would and fall through to the dispatch past the pair.
+  __ profile_not_taken_branch(rax);
+}
+
 void TemplateTable::fast_xaccess(TosState state) {
   transition(vtos, state);
 
@@ -1340,6 +1340,15 @@ void VM_Version::get_processor_features() {
       warning("vectorizedMismatch intrinsics are not available on this CPU");
     FLAG_SET_DEFAULT(UseVectorizedMismatchIntrinsic, false);
   }
+  if (supports_avx2()) {
+    if (FLAG_IS_DEFAULT(UseStringHashCodeIntrinsic)) {
+      UseStringHashCodeIntrinsic = true;
+    }
+  } else if (UseStringHashCodeIntrinsic) {
+    if (!FLAG_IS_DEFAULT(UseStringHashCodeIntrinsic))
+      warning("String hashCode intrinsics are not available on this CPU");
+    FLAG_SET_DEFAULT(UseStringHashCodeIntrinsic, false);
+  }
 #else
   if (UseVectorizedMismatchIntrinsic) {
     if (!FLAG_IS_DEFAULT(UseVectorizedMismatchIntrinsic)) {
@@ -1347,6 +1356,12 @@ void VM_Version::get_processor_features() {
     }
     FLAG_SET_DEFAULT(UseVectorizedMismatchIntrinsic, false);
   }
+  if (UseStringHashCodeIntrinsic) {
+    if (!FLAG_IS_DEFAULT(UseStringHashCodeIntrinsic)) {
+      warning("String hashCode intrinsics are not available in 32-bit VM");
+    }
+    FLAG_SET_DEFAULT(UseStringHashCodeIntrinsic, false);
+  }
 #endif // _LP64
 
   // Use count leading zeros count instruction if available.
@@ -27,6 +27,7 @@
 #include <errno.h>
 #include "utilities/globalDefinitions.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/orderAccess.hpp"
 #include "runtime/os.hpp"
 #include "logging/log.hpp"
 #include "osContainer_linux.hpp"
@@ -51,6 +52,19 @@
  */
 #define PER_CPU_SHARES 1024
 
+/*
+ * The CPU limit values are re-read from the cgroup filesystem so that
+ * live changes made by an orchestrator are honored, but parsing several
+ * /sys/fs/cgroup files on each query is too expensive for a value that
+ * is polled as often as the processor count.  Cache the computed count
+ * briefly; a limit change is still observed at most
+ * OSCONTAINER_CACHE_TIMEOUT nanoseconds later.
+ */
+#define OSCONTAINER_CACHE_TIMEOUT (20 * NANOSECS_PER_MILLISEC)
+
+static volatile int  cached_processor_count = 0;
+static volatile jlong processor_count_timestamp = 0;
+
 bool  OSContainer::_is_initialized   = false;
 bool  OSContainer::_is_containerized = false;
 julong _unlimited_memory;
@@ -586,6 +600,15 @@ int OSContainer::active_processor_count() {
   int cpu_count, limit_count;
   int result;
 
+  jlong now = os::javaTimeNanos();
+  if (now - OrderAccess::load_acquire(&processor_count_timestamp) < OSCONTAINER_CACHE_TIMEOUT) {
+    result = cached_processor_count;
+    if (result > 0) {
+      log_trace(os, container)("OSContainer::active_processor_count (cached): %d", result);
+      return result;
+    }
+  }
+
   cpu_count = limit_count = os::Linux::active_processor_count();
   int quota  = cpu_quota();
   int period = cpu_period();
@@ -618,6 +641,11 @@ int OSContainer::active_processor_count() {
 
   result = MIN2(cpu_count, limit_count);
   log_trace(os, container)("OSContainer::active_processor_count: %d", result);
+
+  // Publish the value before the timestamp so a reader that sees a
+  // fresh timestamp cannot pick up a stale count.
+  cached_processor_count = result;
+  OrderAccess::release_store(&processor_count_timestamp, now);
   return result;
 }
 
@@ -800,6 +800,16 @@ static void *thread_native_entry(Thread *thread) {
   return 0;
 }
 
+// Each Java thread gets a freshly created native thread.  Threads are
+// created detached, so glibc already recycles the stack (and with it the
+// kernel guard mapping and static TLS block) of an exited thread for the
+// next pthread_create of the same stack size; pooling live parked OS
+// threads inside the VM for reuse by Thread.start would buy little over
+// that and would leave the recycled thread's identity -- name, priority,
+// affinity, signal mask, cached JNIEnv seen by native code -- to be
+// scrubbed by hand on every reuse.  Workloads gated by thread-start
+// bursts should pool at the library level where the reused thread keeps
+// its identity by design.
 bool os::create_thread(Thread* thread, ThreadType thr_type,
                        size_t req_stack_size) {
   assert(thread->osthread() == NULL, "caller responsible");
@@ -2194,10 +2204,35 @@ void os::Linux::print_proc_sys_info(outputStream* st) {
   st->cr();
 }
 
+// Print the huge page backing of the process address space, so that the page
+// sizes actually achieved (e.g. by khugepaged with UseTransparentHugePages)
+// can be verified. smaps_rollup requires Linux 4.14; stay silent when it is
+// unavailable.
+static void print_process_hugepage_info(outputStream* st) {
+  FILE* f = fopen("/proc/self/smaps_rollup", "r");
+  if (f == NULL) {
+    return;
+  }
+  st->print_cr("Process huge page usage (/proc/self/smaps_rollup):");
+  char line[128];
+  while (fgets(line, sizeof(line), f) != NULL) {
+    if (strncmp(line, "Rss:", 4) == 0 ||
+        strncmp(line, "AnonHugePages:", 14) == 0 ||
+        strncmp(line, "ShmemPmdMapped:", 15) == 0 ||
+        strncmp(line, "FilePmdMapped:", 14) == 0) {
+      st->print("%s", line);
+    }
+  }
+  fclose(f);
+  st->cr();
+}
+
 void os::Linux::print_full_memory_info(outputStream* st) {
   st->print("\n/proc/meminfo:\n");
   _print_ascii_file("/proc/meminfo", st);
   st->cr();
+
+  print_process_hugepage_info(st);
 }
 
 void os::Linux::print_ld_preload_file(outputStream* st) {
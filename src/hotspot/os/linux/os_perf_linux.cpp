@@ -230,15 +230,18 @@ static double get_cpu_load(int which_logical_cpu, CPUPerfCounters* counters, dou
  *  Ensure that 'fmt' does _NOT_ contain the first two "%d %s"
  */
 static int SCANF_ARGS(2, 0) vread_statdata(const char* procfile, _SCANFMT_ const char* fmt, va_list args) {
-  FILE*f;
+  int fd;
   int n;
   char buf[2048];
 
-  if ((f = fopen(procfile, "r")) == NULL) {
+  if ((fd = os::open(procfile, O_RDONLY, 0)) < 0) {
     return -1;
   }
 
-  if ((n = fread(buf, 1, sizeof(buf), f)) != -1) {
+  // Read the whole (small) file with a single system call rather than
+  // through stdio; fopen allocates a FILE and its buffer on every call,
+  // and these files are re-read for every sample of every thread.
+  if ((n = (int)::read(fd, buf, sizeof(buf))) > 0) {
     char *tmp;
 
     buf[n-1] = '\0';
@@ -253,7 +256,7 @@ static int SCANF_ARGS(2, 0) vread_statdata(const char* procfile, _SCANFMT_ const
     }
   }
 
-  fclose(f);
+  ::close(fd);
 
   return n;
 }
@@ -1062,6 +1062,18 @@ static void unmap_shared(char* addr, size_t bytes) {
 
 // create the PerfData memory region in shared memory.
 //
+// The region is a file-backed shared mapping so that monitoring tools
+// can attach by mapping the same file; every counter update therefore
+// dirties pages of the backing store.  On hosts where writeback of many
+// hsperfdata files is a problem the supported remedies are placing
+// java.io.tmpdir/hsperfdata on tmpfs, which removes the writeback
+// entirely, or -XX:-UsePerfData / -XX:+PerfDisableSharedMem together
+// with -XX:+PerfDataSaveToFile when no live attach is needed.  A
+// write()-based flusher from anonymous memory was considered and
+// rejected: it re-dirties the whole region at every cadence instead of
+// only the pages counters actually touch, and observers would see
+// torn, stale snapshots between flushes.
+//
 static char* create_shared_memory(size_t size) {
 
   // create the shared memory region.
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled/precompiled.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
 #include "runtime/os.hpp"
 #include "waitBarrier_linux.hpp"
@@ -43,30 +44,41 @@ static int futex(volatile int *addr, int futex_op, int op_arg) {
 }
 
 void LinuxWaitBarrier::arm(int barrier_tag) {
-  assert(_futex_barrier == 0, "Should not be already armed: "
-         "_futex_barrier=%d", _futex_barrier);
-  _futex_barrier = barrier_tag;
+  for (int i = 0; i < SHARDS; i++) {
+    assert(_shard[i]._futex_barrier == 0, "Should not be already armed: "
+           "_futex_barrier=%d", _shard[i]._futex_barrier);
+    _shard[i]._futex_barrier = barrier_tag;
+  }
+  _ticket = 0;
   OrderAccess::fence();
 }
 
 void LinuxWaitBarrier::disarm() {
-  assert(_futex_barrier != 0, "Should be armed/non-zero.");
-  _futex_barrier = 0;
-  int s = futex(&_futex_barrier,
-                FUTEX_WAKE_PRIVATE,
-                INT_MAX /* wake a max of this many threads */);
-  guarantee_with_errno(s > -1, "futex FUTEX_WAKE failed");
+  // Disarm all shards before waking any of them, so that a waiter woken
+  // spuriously from a later shard sees its word already cleared.
+  for (int i = 0; i < SHARDS; i++) {
+    assert(_shard[i]._futex_barrier != 0, "Should be armed/non-zero.");
+    _shard[i]._futex_barrier = 0;
+  }
+  for (int i = 0; i < SHARDS; i++) {
+    int s = futex(&_shard[i]._futex_barrier,
+                  FUTEX_WAKE_PRIVATE,
+                  INT_MAX /* wake a max of this many threads */);
+    guarantee_with_errno(s > -1, "futex FUTEX_WAKE failed");
+  }
 }
 
 void LinuxWaitBarrier::wait(int barrier_tag) {
   assert(barrier_tag != 0, "Trying to wait on disarmed value");
+  volatile int* const addr =
+    &_shard[(uint)Atomic::add(1, &_ticket) % SHARDS]._futex_barrier;
   if (barrier_tag == 0 ||
-      barrier_tag != _futex_barrier) {
+      barrier_tag != *addr) {
     OrderAccess::fence();
     return;
   }
   do {
-    int s = futex(&_futex_barrier,
+    int s = futex(addr,
                   FUTEX_WAIT_PRIVATE,
                   barrier_tag /* should be this tag */);
     guarantee_with_errno((s == 0) ||
@@ -76,5 +88,5 @@ void LinuxWaitBarrier::wait(int barrier_tag) {
     // Return value 0: woken up, but re-check in case of spurious wakeup.
     // Error EINTR: woken by signal, so re-check and re-wait if necessary.
     // Error EAGAIN: we are already disarmed and so will pass the check.
-  } while (barrier_tag == _futex_barrier);
+  } while (barrier_tag == *addr);
 }
@@ -26,16 +26,33 @@
 #define OS_LINUX_WAITBARRIER_LINUX_HPP
 
 #include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
 
 class LinuxWaitBarrier : public CHeapObj<mtInternal> {
-  volatile int _futex_barrier;
+  // The futex words waiters block on. The words are sharded so that the
+  // waiters spread over several futex hash buckets in the kernel, and
+  // disarm() issues one wake per shard instead of walking one long wait
+  // queue under a single bucket lock; threads woken from the first
+  // shards run while the remaining shards are still being woken. Each
+  // word has a cache line to itself. All shards are armed and disarmed
+  // together; waiters pick a shard round-robin using the ticket counter.
+  static const int SHARDS = 8;
+  struct {
+    volatile int _futex_barrier;
+    char _pad[DEFAULT_CACHE_LINE_SIZE - sizeof(int)];
+  } _shard[SHARDS];
+  volatile int _ticket;
 
   // Prevent copying and assignment of LinuxWaitBarrier instances.
   LinuxWaitBarrier(const LinuxWaitBarrier&);
   LinuxWaitBarrier& operator=(const LinuxWaitBarrier&);
 
  public:
-  LinuxWaitBarrier() : _futex_barrier(0) {};
+  LinuxWaitBarrier() : _ticket(0) {
+    for (int i = 0; i < SHARDS; i++) {
+      _shard[i]._futex_barrier = 0;
+    }
+  };
   ~LinuxWaitBarrier() {};
 
   const char* description() { return "futex"; }
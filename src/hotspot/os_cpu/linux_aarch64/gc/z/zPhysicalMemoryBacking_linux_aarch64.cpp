@@ -150,8 +150,10 @@ size_t ZPhysicalMemoryBacking::commit(size_t size) {
     // Try commit hole
     const size_t filled = _file.commit(start, allocated);
     if (filled > 0) {
-      // Successful or partialy successful
-      _committed.free(start, filled);
+      // Successful or partialy successful. Newly committed memory has no
+      // NUMA home until it is touched, so hand it to the committing
+      // thread's node, where the binding applied at map time will place it.
+      _committed.get(ZNUMA::id()).free(start, filled);
       committed += filled;
     }
     if (filled < allocated) {
@@ -168,7 +170,7 @@ size_t ZPhysicalMemoryBacking::commit(size_t size) {
     const size_t expanded = _file.commit(start, remaining);
     if (expanded > 0) {
       // Successful or partialy successful
-      _committed.free(start, expanded);
+      _committed.get(ZNUMA::id()).free(start, expanded);
       committed += expanded;
     }
   }
@@ -179,52 +181,85 @@ size_t ZPhysicalMemoryBacking::commit(size_t size) {
 size_t ZPhysicalMemoryBacking::uncommit(size_t size) {
   size_t uncommitted = 0;
 
-  // Punch holes in backing file
-  while (uncommitted < size) {
-    size_t allocated = 0;
-    const size_t remaining = size - uncommitted;
-    const uintptr_t start = _committed.alloc_from_back_at_most(remaining, &allocated);
-    assert(start != UINTPTR_MAX, "Allocation should never fail");
+  // Punch holes in backing file, draining each node's pool in turn
+  const uint32_t numa_count = ZNUMA::count();
+  for (uint32_t numa_id = 0; numa_id < numa_count && uncommitted < size; numa_id++) {
+    while (uncommitted < size) {
+      size_t allocated = 0;
+      const size_t remaining = size - uncommitted;
+      const uintptr_t start = _committed.get(numa_id).alloc_from_back_at_most(remaining, &allocated);
+      if (start == UINTPTR_MAX) {
+        // Node pool empty, try next node
+        break;
+      }
+
+      // Try punch hole
+      const size_t punched = _file.uncommit(start, allocated);
+      if (punched > 0) {
+        // Successful or partialy successful
+        _uncommitted.free(start, punched);
+        uncommitted += punched;
+      }
+      if (punched < allocated) {
+        // Failed or partialy failed
+        _committed.get(numa_id).free(start + punched, allocated - punched);
+        return uncommitted;
+      }
+    }
+  }
 
-    // Try punch hole
-    const size_t punched = _file.uncommit(start, allocated);
-    if (punched > 0) {
-      // Successful or partialy successful
-      _uncommitted.free(start, punched);
-      uncommitted += punched;
+  return uncommitted;
+}
+
+uintptr_t ZPhysicalMemoryBacking::alloc_granule(uint32_t numa_id) {
+  // Try NUMA local pool
+  const uintptr_t start = _committed.get(numa_id).alloc_from_front(ZGranuleSize);
+  if (start != UINTPTR_MAX) {
+    return start;
+  }
+
+  // Try NUMA remote pool(s), i.e. steal memory from the other
+  // nodes when the local pool is exhausted
+  const uint32_t numa_count = ZNUMA::count();
+  uint32_t remote_numa_id = numa_id + 1;
+  const uint32_t remote_numa_count = numa_count - 1;
+  for (uint32_t i = 0; i < remote_numa_count; i++) {
+    if (remote_numa_id == numa_count) {
+      remote_numa_id = 0;
     }
-    if (punched < allocated) {
-      // Failed or partialy failed
-      _committed.free(start + punched, allocated - punched);
-      return uncommitted;
+
+    const uintptr_t remote_start = _committed.get(remote_numa_id).alloc_from_front(ZGranuleSize);
+    if (remote_start != UINTPTR_MAX) {
+      return remote_start;
     }
+
+    remote_numa_id++;
   }
 
-  return uncommitted;
+  fatal("Allocation should never fail");
+  return UINTPTR_MAX;
 }
 
-ZPhysicalMemory ZPhysicalMemoryBacking::alloc(size_t size) {
+ZPhysicalMemory ZPhysicalMemoryBacking::alloc(size_t size, uint32_t numa_id) {
   assert(is_aligned(size, ZGranuleSize), "Invalid size");
 
   ZPhysicalMemory pmem;
 
   // Allocate segments
   for (size_t allocated = 0; allocated < size; allocated += ZGranuleSize) {
-    const uintptr_t start = _committed.alloc_from_front(ZGranuleSize);
-    assert(start != UINTPTR_MAX, "Allocation should never fail");
-    pmem.add_segment(ZPhysicalMemorySegment(start, ZGranuleSize));
+    pmem.add_segment(ZPhysicalMemorySegment(alloc_granule(numa_id), ZGranuleSize));
   }
 
   return pmem;
 }
 
-void ZPhysicalMemoryBacking::free(const ZPhysicalMemory& pmem) {
+void ZPhysicalMemoryBacking::free(const ZPhysicalMemory& pmem, uint32_t numa_id) {
   const size_t nsegments = pmem.nsegments();
 
   // Free segments
   for (size_t i = 0; i < nsegments; i++) {
     const ZPhysicalMemorySegment& segment = pmem.segment(i);
-    _committed.free(segment.start(), segment.size());
+    _committed.get(numa_id).free(segment.start(), segment.size());
   }
 }
 
@@ -249,7 +284,7 @@ void ZPhysicalMemoryBacking::pretouch_view(uintptr_t addr, size_t size) const {
   os::pretouch_memory((void*)addr, (void*)(addr + size), page_size);
 }
 
-void ZPhysicalMemoryBacking::map_view(const ZPhysicalMemory& pmem, uintptr_t addr, bool pretouch) const {
+void ZPhysicalMemoryBacking::map_view(const ZPhysicalMemory& pmem, uintptr_t addr, bool numa_local, bool pretouch) const {
   const size_t nsegments = pmem.nsegments();
   size_t size = 0;
 
@@ -271,8 +306,14 @@ void ZPhysicalMemoryBacking::map_view(const ZPhysicalMemory& pmem, uintptr_t add
     advise_view(addr, size, MADV_HUGEPAGE);
   }
 
-  // NUMA interleave memory before touching it
-  ZNUMA::memory_interleave(addr, size);
+  // Bind or interleave memory before touching it. Memory for pages used
+  // by the CPU-local allocation path is bound to the allocating thread's
+  // node, while memory for shared pages is interleaved across all nodes.
+  if (numa_local) {
+    ZNUMA::memory_bind(addr, size, ZNUMA::id());
+  } else {
+    ZNUMA::memory_interleave(addr, size);
+  }
 
   // Pre-touch memory
   if (pretouch) {
@@ -296,15 +337,15 @@ uintptr_t ZPhysicalMemoryBacking::nmt_address(uintptr_t offset) const {
   return ZAddress::marked0(offset);
 }
 
-void ZPhysicalMemoryBacking::map(const ZPhysicalMemory& pmem, uintptr_t offset) const {
+void ZPhysicalMemoryBacking::map(const ZPhysicalMemory& pmem, uintptr_t offset, bool numa_local) const {
   if (ZVerifyViews) {
     // Map good view
-    map_view(pmem, ZAddress::good(offset), AlwaysPreTouch);
+    map_view(pmem, ZAddress::good(offset), numa_local, AlwaysPreTouch);
   } else {
     // Map all views
-    map_view(pmem, ZAddress::marked0(offset), AlwaysPreTouch);
-    map_view(pmem, ZAddress::marked1(offset), AlwaysPreTouch);
-    map_view(pmem, ZAddress::remapped(offset), AlwaysPreTouch);
+    map_view(pmem, ZAddress::marked0(offset), numa_local, AlwaysPreTouch);
+    map_view(pmem, ZAddress::marked1(offset), numa_local, AlwaysPreTouch);
+    map_view(pmem, ZAddress::remapped(offset), numa_local, AlwaysPreTouch);
   }
 }
 
@@ -323,7 +364,7 @@ void ZPhysicalMemoryBacking::unmap(const ZPhysicalMemory& pmem, uintptr_t offset
 void ZPhysicalMemoryBacking::debug_map(const ZPhysicalMemory& pmem, uintptr_t offset) const {
   // Map good view
   assert(ZVerifyViews, "Should be enabled");
-  map_view(pmem, ZAddress::good(offset), false /* pretouch */);
+  map_view(pmem, ZAddress::good(offset), false /* numa_local */, false /* pretouch */);
 }
 
 void ZPhysicalMemoryBacking::debug_unmap(const ZPhysicalMemory& pmem, uintptr_t offset) const {
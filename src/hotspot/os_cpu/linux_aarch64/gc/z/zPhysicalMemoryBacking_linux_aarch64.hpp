@@ -26,24 +26,27 @@
 
 #include "gc/z/zBackingFile_linux_aarch64.hpp"
 #include "gc/z/zMemory.hpp"
+#include "gc/z/zValue.hpp"
 
 class ZErrno;
 class ZPhysicalMemory;
 
 class ZPhysicalMemoryBacking {
 private:
-  ZBackingFile   _file;
-  ZMemoryManager _committed;
-  ZMemoryManager _uncommitted;
+  ZBackingFile             _file;
+  ZPerNUMA<ZMemoryManager> _committed;
+  ZMemoryManager           _uncommitted;
 
   void warn_available_space(size_t max) const;
   void warn_max_map_count(size_t max) const;
 
+  uintptr_t alloc_granule(uint32_t numa_id);
+
   void map_failed(ZErrno err) const;
 
   void advise_view(uintptr_t addr, size_t size, int advice) const;
   void pretouch_view(uintptr_t addr, size_t size) const;
-  void map_view(const ZPhysicalMemory& pmem, uintptr_t addr, bool pretouch) const;
+  void map_view(const ZPhysicalMemory& pmem, uintptr_t addr, bool numa_local, bool pretouch) const;
   void unmap_view(const ZPhysicalMemory& pmem, uintptr_t addr) const;
 
 public:
@@ -55,12 +58,12 @@ public:
   size_t commit(size_t size);
   size_t uncommit(size_t size);
 
-  ZPhysicalMemory alloc(size_t size);
-  void free(const ZPhysicalMemory& pmem);
+  ZPhysicalMemory alloc(size_t size, uint32_t numa_id);
+  void free(const ZPhysicalMemory& pmem, uint32_t numa_id);
 
   uintptr_t nmt_address(uintptr_t offset) const;
 
-  void map(const ZPhysicalMemory& pmem, uintptr_t offset) const;
+  void map(const ZPhysicalMemory& pmem, uintptr_t offset, bool numa_local) const;
   void unmap(const ZPhysicalMemory& pmem, uintptr_t offset) const;
 
   void debug_map(const ZPhysicalMemory& pmem, uintptr_t offset) const;
@@ -140,6 +140,27 @@ static void pd_aligned_disjoint_words(const HeapWord* from, HeapWord* to, size_t
   pd_disjoint_words(from, to, count);
 }
 
+#ifdef AMD64
+#define PD_HAS_NON_TEMPORAL_COPY
+static void pd_aligned_disjoint_words_nt(const HeapWord* from, HeapWord* to, size_t count) {
+  // Streaming stores bypass the cache; the trailing sfence orders them
+  // with subsequent stores. Includes a zero-count check.
+  __asm__ volatile("        testq   %2,%2          ;"
+                   "        jz      2f             ;"
+                   "1:      movq    (%0),%%rdx     ;"
+                   "        movnti  %%rdx,(%1)     ;"
+                   "        addq    $8,%0          ;"
+                   "        addq    $8,%1          ;"
+                   "        subq    $1,%2          ;"
+                   "        jnz     1b             ;"
+                   "        sfence                 ;"
+                   "2:                              "
+                   : "+r" (from), "+r" (to), "+r" (count)
+                   :
+                   : "rdx", "memory", "cc");
+}
+#endif // AMD64
+
 static void pd_conjoint_bytes(const void* from, void* to, size_t count) {
 #ifdef AMD64
   (void)memmove(to, from, count);
@@ -163,6 +163,19 @@ public:
 };
 
 
+// AOT libraries are the supported form of cross-run compiled code.
+// Persisting JIT-produced nmethods directly (serialize on shutdown,
+// revalidate and install on startup) keeps coming up as an alternative
+// and does not work with what an nmethod is: its code embeds raw
+// addresses of the run that produced it -- oops and Klass* in immediates,
+// inline cache targets, stub and card-table addresses, compressed-oop
+// base/shift -- and its validity rests on a Dependencies set whose
+// assumptions (class hierarchy leaves, unique concrete methods) must be
+// re-proven against whatever classes the next run loads, not just
+// fingerprint-compared.  Relocating and re-validating all of that is
+// exactly the job jaotc does ahead of time with a position-independent
+// code model; a shutdown-time snapshot would have to duplicate that
+// model to be more than a cache of deopt bombs.
 class AOTCodeHeap : public CodeHeap {
   AOTLib* _lib;
   int _aot_id;
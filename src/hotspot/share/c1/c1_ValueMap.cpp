@@ -262,11 +262,12 @@ void ValueMap::print_statistics() {
 
 class ShortLoopOptimizer : public ValueNumberingVisitor {
  private:
-  GlobalValueNumbering* _gvn;
-  BlockList             _loop_blocks;
-  bool                  _too_complicated_loop;
-  bool                  _has_field_store[T_ARRAY + 1];
-  bool                  _has_indexed_store[T_ARRAY + 1];
+  GlobalValueNumbering*   _gvn;
+  BlockList               _loop_blocks;
+  bool                    _too_complicated_loop;
+  GrowableArray<ciField*> _stored_fields;          // fields stored somewhere in the loop
+  bool                    _has_unknown_field_store; // a store in the loop needed patching
+  bool                    _has_indexed_store[T_ARRAY + 1];
 
   // simplified access to methods of GlobalValueNumbering
   ValueMap* current_map()                        { return _gvn->current_map(); }
@@ -276,8 +277,13 @@ class ShortLoopOptimizer : public ValueNumberingVisitor {
   void      kill_memory()                                 { _too_complicated_loop = true; }
   void      kill_field(ciField* field, bool all_offsets)  {
     current_map()->kill_field(field, all_offsets);
-    assert(field->type()->basic_type() >= 0 && field->type()->basic_type() <= T_ARRAY, "Invalid type");
-    _has_field_store[field->type()->basic_type()] = true;
+    if (all_offsets) {
+      // The offset of the stored field is not known yet, so it may
+      // overlap with any field load.
+      _has_unknown_field_store = true;
+    } else {
+      _stored_fields.append(field);
+    }
   }
   void      kill_array(ValueType* type)                   {
     current_map()->kill_array(type);
@@ -290,16 +296,27 @@ class ShortLoopOptimizer : public ValueNumberingVisitor {
     : _gvn(gvn)
     , _loop_blocks(ValueMapMaxLoopSize)
     , _too_complicated_loop(false)
+    , _has_unknown_field_store(false)
   {
     for (int i=0; i<= T_ARRAY; i++){
-      _has_field_store[i] = false;
       _has_indexed_store[i] = false;
     }
   }
 
-  bool has_field_store(BasicType type) {
-    assert(type >= 0 && type <= T_ARRAY, "Invalid type");
-    return _has_field_store[type];
+  // Returns true if a store in the loop may modify this field
+  bool has_field_store(ciField* field) {
+    if (_has_unknown_field_store) {
+      return true;
+    }
+    for (int i = 0; i < _stored_fields.length(); i++) {
+      ciField* stored = _stored_fields.at(i);
+      // ciField's are not unique; must compare their contents
+      // (same matching rule as ValueMap::kill_field)
+      if (stored->holder() == field->holder() && stored->offset() == field->offset()) {
+        return true;
+      }
+    }
+    return false;
   }
 
   bool has_indexed_store(BasicType type) {
@@ -381,7 +398,7 @@ void LoopInvariantCodeMotion::process_block(BlockBegin* block) {
     } else if (cur->as_LoadField() != NULL) {
       LoadField* lf = (LoadField*)cur;
       // deoptimizes on NullPointerException
-      cur_invariant = !lf->needs_patching() && !lf->field()->is_volatile() && !_short_loop_optimizer->has_field_store(lf->field()->type()->basic_type()) && is_invariant(lf->obj()) && _insert_is_pred;
+      cur_invariant = !lf->needs_patching() && !lf->field()->is_volatile() && !_short_loop_optimizer->has_field_store(lf->field()) && is_invariant(lf->obj()) && _insert_is_pred;
     } else if (cur->as_ArrayLength() != NULL) {
       ArrayLength *length = cur->as_ArrayLength();
       cur_invariant = is_invariant(length->array());
@@ -435,6 +452,12 @@ bool ShortLoopOptimizer::process(BlockBegin* loop_header) {
   _too_complicated_loop = false;
   _loop_blocks.clear();
   _loop_blocks.append(loop_header);
+  // Stores seen while processing an earlier loop are of no concern here
+  _stored_fields.clear();
+  _has_unknown_field_store = false;
+  for (int i = 0; i <= T_ARRAY; i++) {
+    _has_indexed_store[i] = false;
+  }
 
   for (int i = 0; i < _loop_blocks.length(); i++) {
     BlockBegin* block = _loop_blocks.at(i);
@@ -536,9 +536,9 @@ ciCallProfile ciMethod::call_profile_at_bci(int bci) {
         // or < 0 in the case of a type check failure for checkcast, aastore, instanceof.
         // The call site count is > 0 in the case of a polymorphic virtual call.
         if (morphism > 0 && morphism == result._limit) {
-           // The morphism <= MorphismLimit.
-           if ((morphism <  ciCallProfile::MorphismLimit) ||
-               (morphism == ciCallProfile::MorphismLimit && count == 0)) {
+           // The morphism is exact if the profile has a free row left, or
+           // if all rows are taken but no calls fell past the recorded types.
+           if ((morphism < (int)call->row_limit()) || count == 0) {
 #ifdef ASSERT
              if (count > 0) {
                this->print_short_name(tty);
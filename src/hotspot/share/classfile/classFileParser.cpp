@@ -30,6 +30,7 @@
 #include "classfile/classLoaderData.inline.hpp"
 #include "classfile/defaultMethods.hpp"
 #include "classfile/dictionary.hpp"
+#include "classfile/fieldLayoutHints.hpp"
 #include "classfile/javaClasses.inline.hpp"
 #include "classfile/moduleEntry.hpp"
 #include "classfile/packageEntry.hpp"
@@ -4044,110 +4045,122 @@ void ClassFileParser::layout_fields(ConstantPool* cp,
     next_nonstatic_padded_offset = next_nonstatic_oop_offset + (nonstatic_oop_count * heapOopSize);
   }
 
+  // When layout hints name fields of this class, allocate the hinted (hot)
+  // fields in a first pass so they pack towards the start of the instance
+  // within their size class, ahead of the unhinted (cold) fields.
+  const bool has_field_hints = FieldLayoutHintsFile != NULL &&
+                               FieldLayoutHints::has_hints_for(_class_name);
+
   // Iterate over fields again and compute correct offsets.
   // The field allocation type was temporarily stored in the offset slot.
   // oop fields are located before non-oop fields (static and non-static).
-  for (AllFieldStream fs(_fields, cp); !fs.done(); fs.next()) {
+  for (int pass = 0; pass < (has_field_hints ? 2 : 1); pass++) {
+    for (AllFieldStream fs(_fields, cp); !fs.done(); fs.next()) {
 
-    // skip already laid out fields
-    if (fs.is_offset_set()) continue;
+      // skip already laid out fields
+      if (fs.is_offset_set()) continue;
 
-    // contended instance fields are handled below
-    if (fs.is_contended() && !fs.access_flags().is_static()) continue;
+      // contended instance fields are handled below
+      if (fs.is_contended() && !fs.access_flags().is_static()) continue;
 
-    int real_offset = 0;
-    const FieldAllocationType atype = (const FieldAllocationType) fs.allocation_type();
+      // unhinted fields wait for the second pass when layout hints are present
+      if (has_field_hints && pass == 0 &&
+          !FieldLayoutHints::is_hot_field(_class_name, fs.name())) continue;
 
-    // pack the rest of the fields
-    switch (atype) {
-      case STATIC_OOP:
-        real_offset = next_static_oop_offset;
-        next_static_oop_offset += heapOopSize;
-        break;
-      case STATIC_BYTE:
-        real_offset = next_static_byte_offset;
-        next_static_byte_offset += 1;
-        break;
-      case STATIC_SHORT:
-        real_offset = next_static_short_offset;
-        next_static_short_offset += BytesPerShort;
-        break;
-      case STATIC_WORD:
-        real_offset = next_static_word_offset;
-        next_static_word_offset += BytesPerInt;
-        break;
-      case STATIC_DOUBLE:
-        real_offset = next_static_double_offset;
-        next_static_double_offset += BytesPerLong;
-        break;
-      case NONSTATIC_OOP:
-        if( nonstatic_oop_space_count > 0 ) {
-          real_offset = nonstatic_oop_space_offset;
-          nonstatic_oop_space_offset += heapOopSize;
-          nonstatic_oop_space_count  -= 1;
-        } else {
-          real_offset = next_nonstatic_oop_offset;
-          next_nonstatic_oop_offset += heapOopSize;
-        }
+      int real_offset = 0;
+      const FieldAllocationType atype = (const FieldAllocationType) fs.allocation_type();
 
-        // Record this oop in the oop maps
-        if( nonstatic_oop_map_count > 0 &&
-            nonstatic_oop_offsets[nonstatic_oop_map_count - 1] ==
-            real_offset -
-            int(nonstatic_oop_counts[nonstatic_oop_map_count - 1]) *
-            heapOopSize ) {
-          // This oop is adjacent to the previous one, add to current oop map
-          assert(nonstatic_oop_map_count - 1 < max_nonstatic_oop_maps, "range check");
-          nonstatic_oop_counts[nonstatic_oop_map_count - 1] += 1;
-        } else {
-          // This oop is not adjacent to the previous one, create new oop map
-          assert(nonstatic_oop_map_count < max_nonstatic_oop_maps, "range check");
-          nonstatic_oop_offsets[nonstatic_oop_map_count] = real_offset;
-          nonstatic_oop_counts [nonstatic_oop_map_count] = 1;
-          nonstatic_oop_map_count += 1;
-          if( first_nonstatic_oop_offset == 0 ) { // Undefined
-            first_nonstatic_oop_offset = real_offset;
+      // pack the rest of the fields
+      switch (atype) {
+        case STATIC_OOP:
+          real_offset = next_static_oop_offset;
+          next_static_oop_offset += heapOopSize;
+          break;
+        case STATIC_BYTE:
+          real_offset = next_static_byte_offset;
+          next_static_byte_offset += 1;
+          break;
+        case STATIC_SHORT:
+          real_offset = next_static_short_offset;
+          next_static_short_offset += BytesPerShort;
+          break;
+        case STATIC_WORD:
+          real_offset = next_static_word_offset;
+          next_static_word_offset += BytesPerInt;
+          break;
+        case STATIC_DOUBLE:
+          real_offset = next_static_double_offset;
+          next_static_double_offset += BytesPerLong;
+          break;
+        case NONSTATIC_OOP:
+          if( nonstatic_oop_space_count > 0 ) {
+            real_offset = nonstatic_oop_space_offset;
+            nonstatic_oop_space_offset += heapOopSize;
+            nonstatic_oop_space_count  -= 1;
+          } else {
+            real_offset = next_nonstatic_oop_offset;
+            next_nonstatic_oop_offset += heapOopSize;
           }
-        }
-        break;
-      case NONSTATIC_BYTE:
-        if( nonstatic_byte_space_count > 0 ) {
-          real_offset = nonstatic_byte_space_offset;
-          nonstatic_byte_space_offset += 1;
-          nonstatic_byte_space_count  -= 1;
-        } else {
-          real_offset = next_nonstatic_byte_offset;
-          next_nonstatic_byte_offset += 1;
-        }
-        break;
-      case NONSTATIC_SHORT:
-        if( nonstatic_short_space_count > 0 ) {
-          real_offset = nonstatic_short_space_offset;
-          nonstatic_short_space_offset += BytesPerShort;
-          nonstatic_short_space_count  -= 1;
-        } else {
-          real_offset = next_nonstatic_short_offset;
-          next_nonstatic_short_offset += BytesPerShort;
-        }
-        break;
-      case NONSTATIC_WORD:
-        if( nonstatic_word_space_count > 0 ) {
-          real_offset = nonstatic_word_space_offset;
-          nonstatic_word_space_offset += BytesPerInt;
-          nonstatic_word_space_count  -= 1;
-        } else {
-          real_offset = next_nonstatic_word_offset;
-          next_nonstatic_word_offset += BytesPerInt;
-        }
-        break;
-      case NONSTATIC_DOUBLE:
-        real_offset = next_nonstatic_double_offset;
-        next_nonstatic_double_offset += BytesPerLong;
-        break;
-      default:
-        ShouldNotReachHere();
+
+          // Record this oop in the oop maps
+          if( nonstatic_oop_map_count > 0 &&
+              nonstatic_oop_offsets[nonstatic_oop_map_count - 1] ==
+              real_offset -
+              int(nonstatic_oop_counts[nonstatic_oop_map_count - 1]) *
+              heapOopSize ) {
+            // This oop is adjacent to the previous one, add to current oop map
+            assert(nonstatic_oop_map_count - 1 < max_nonstatic_oop_maps, "range check");
+            nonstatic_oop_counts[nonstatic_oop_map_count - 1] += 1;
+          } else {
+            // This oop is not adjacent to the previous one, create new oop map
+            assert(nonstatic_oop_map_count < max_nonstatic_oop_maps, "range check");
+            nonstatic_oop_offsets[nonstatic_oop_map_count] = real_offset;
+            nonstatic_oop_counts [nonstatic_oop_map_count] = 1;
+            nonstatic_oop_map_count += 1;
+            if( first_nonstatic_oop_offset == 0 ) { // Undefined
+              first_nonstatic_oop_offset = real_offset;
+            }
+          }
+          break;
+        case NONSTATIC_BYTE:
+          if( nonstatic_byte_space_count > 0 ) {
+            real_offset = nonstatic_byte_space_offset;
+            nonstatic_byte_space_offset += 1;
+            nonstatic_byte_space_count  -= 1;
+          } else {
+            real_offset = next_nonstatic_byte_offset;
+            next_nonstatic_byte_offset += 1;
+          }
+          break;
+        case NONSTATIC_SHORT:
+          if( nonstatic_short_space_count > 0 ) {
+            real_offset = nonstatic_short_space_offset;
+            nonstatic_short_space_offset += BytesPerShort;
+            nonstatic_short_space_count  -= 1;
+          } else {
+            real_offset = next_nonstatic_short_offset;
+            next_nonstatic_short_offset += BytesPerShort;
+          }
+          break;
+        case NONSTATIC_WORD:
+          if( nonstatic_word_space_count > 0 ) {
+            real_offset = nonstatic_word_space_offset;
+            nonstatic_word_space_offset += BytesPerInt;
+            nonstatic_word_space_count  -= 1;
+          } else {
+            real_offset = next_nonstatic_word_offset;
+            next_nonstatic_word_offset += BytesPerInt;
+          }
+          break;
+        case NONSTATIC_DOUBLE:
+          real_offset = next_nonstatic_double_offset;
+          next_nonstatic_double_offset += BytesPerLong;
+          break;
+        default:
+          ShouldNotReachHere();
+      }
+      fs.set_offset(real_offset);
     }
-    fs.set_offset(real_offset);
   }
 
 
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "jvm.h"
+#include "classfile/classLoader.hpp"
 #include "classfile/compactHashtable.hpp"
 #include "classfile/javaClasses.hpp"
 #include "logging/logMessage.hpp"
@@ -35,14 +36,19 @@
 #include "utilities/numberSeq.hpp"
 #include <sys/stat.h>
 
+#ifndef O_BINARY       // if defined (Win32) use binary files.
+#define O_BINARY 0     // otherwise do nothing.
+#endif
+
 #if INCLUDE_CDS
 /////////////////////////////////////////////////////
 //
 // The compact hash table writer implementations
 //
 CompactHashtableWriter::CompactHashtableWriter(int num_entries,
-                                               CompactHashtableStats* stats) {
-  assert(DumpSharedSpaces || DynamicDumpSharedSpaces, "dump-time only");
+                                               CompactHashtableStats* stats,
+                                               bool c_heap_allocated) {
+  assert(DumpSharedSpaces || DynamicDumpSharedSpaces || c_heap_allocated, "dump-time only");
   assert(num_entries >= 0, "sanity");
   _num_buckets = calculate_num_buckets(num_entries);
   assert(_num_buckets > 0, "no buckets");
@@ -56,6 +62,8 @@ CompactHashtableWriter::CompactHashtableWriter(int num_entries,
   _stats = stats;
   _compact_buckets = NULL;
   _compact_entries = NULL;
+  _num_compact_entries = 0;
+  _c_heap_allocated = c_heap_allocated;
   _num_empty_buckets = 0;
   _num_value_only_buckets = 0;
   _num_other_buckets = 0;
@@ -68,6 +76,10 @@ CompactHashtableWriter::~CompactHashtableWriter() {
   }
 
   FREE_C_HEAP_ARRAY(GrowableArray<Entry>*, _buckets);
+  if (_c_heap_allocated) {
+    FREE_C_HEAP_ARRAY(u4, _compact_buckets);
+    FREE_C_HEAP_ARRAY(u4, _compact_entries);
+  }
 }
 
 size_t CompactHashtableWriter::estimate_size(int num_entries) {
@@ -107,13 +119,24 @@ void CompactHashtableWriter::allocate_table() {
                                   "Too many entries.");
   }
 
-  _compact_buckets = MetaspaceShared::new_ro_array<u4>(_num_buckets + 1);
-  _compact_entries = MetaspaceShared::new_ro_array<u4>(entries_space);
+  size_t bucket_bytes, entry_bytes;
+  if (_c_heap_allocated) {
+    _compact_buckets = NEW_C_HEAP_ARRAY(u4, _num_buckets + 1, mtSymbol);
+    _compact_entries = NEW_C_HEAP_ARRAY(u4, entries_space, mtSymbol);
+    bucket_bytes = (_num_buckets + 1) * sizeof(u4);
+    entry_bytes  = entries_space * sizeof(u4);
+  } else {
+    _compact_buckets = MetaspaceShared::new_ro_array<u4>(_num_buckets + 1)->data();
+    _compact_entries = MetaspaceShared::new_ro_array<u4>(entries_space)->data();
+    bucket_bytes = MetaspaceShared::ro_array_bytesize<u4>(_num_buckets + 1);
+    entry_bytes  = MetaspaceShared::ro_array_bytesize<u4>(entries_space);
+  }
+  _num_compact_entries = entries_space;
 
   _stats->bucket_count    = _num_buckets;
-  _stats->bucket_bytes    = _compact_buckets->size() * BytesPerWord;
+  _stats->bucket_bytes    = (int)bucket_bytes;
   _stats->hashentry_count = _num_entries_written;
-  _stats->hashentry_bytes = _compact_entries->size() * BytesPerWord;
+  _stats->hashentry_bytes = (int)entry_bytes;
 }
 
 // Write the compact table's buckets
@@ -124,19 +147,19 @@ void CompactHashtableWriter::dump_table(NumberSeq* summary) {
     int bucket_size = bucket->length();
     if (bucket_size == 1) {
       // bucket with one entry is compacted and only has the symbol offset
-      _compact_buckets->at_put(index, BUCKET_INFO(offset, VALUE_ONLY_BUCKET_TYPE));
+      _compact_buckets[index] = BUCKET_INFO(offset, VALUE_ONLY_BUCKET_TYPE);
 
       Entry ent = bucket->at(0);
-      _compact_entries->at_put(offset++, ent.value());
+      _compact_entries[offset++] = ent.value();
       _num_value_only_buckets++;
     } else {
       // regular bucket, each entry is a symbol (hash, offset) pair
-      _compact_buckets->at_put(index, BUCKET_INFO(offset, REGULAR_BUCKET_TYPE));
+      _compact_buckets[index] = BUCKET_INFO(offset, REGULAR_BUCKET_TYPE);
 
       for (int i=0; i<bucket_size; i++) {
         Entry ent = bucket->at(i);
-        _compact_entries->at_put(offset++, u4(ent.hash())); // write entry hash
-        _compact_entries->at_put(offset++, ent.value());
+        _compact_entries[offset++] = u4(ent.hash()); // write entry hash
+        _compact_entries[offset++] = ent.value();
       }
       if (bucket_size == 0) {
         _num_empty_buckets++;
@@ -148,13 +171,14 @@ void CompactHashtableWriter::dump_table(NumberSeq* summary) {
   }
 
   // Mark the end of the buckets
-  _compact_buckets->at_put(_num_buckets, BUCKET_INFO(offset, TABLEEND_BUCKET_TYPE));
-  assert(offset == (u4)_compact_entries->length(), "sanity");
+  _compact_buckets[_num_buckets] = BUCKET_INFO(offset, TABLEEND_BUCKET_TYPE);
+  assert(offset == (u4)_num_compact_entries, "sanity");
 }
 
 
 // Write the compact table
 void CompactHashtableWriter::dump(SimpleCompactHashtable *cht, const char* table_name) {
+  assert(!_c_heap_allocated, "the table must be allocated in the CDS dump space");
   NumberSeq summary;
   allocate_table();
   dump_table(&summary);
@@ -162,7 +186,7 @@ void CompactHashtableWriter::dump(SimpleCompactHashtable *cht, const char* table
   int table_bytes = _stats->bucket_bytes + _stats->hashentry_bytes;
   address base_address = address(SharedBaseAddress);
   cht->init(base_address,  _num_entries_written, _num_buckets,
-            _compact_buckets->data(), _compact_entries->data());
+            _compact_buckets, _compact_entries);
 
   LogMessage(cds, hashtables) msg;
   if (msg.is_info()) {
@@ -185,6 +209,56 @@ void CompactHashtableWriter::dump(SimpleCompactHashtable *cht, const char* table
   }
 }
 
+static bool write_image_bytes(int fd, const void* buffer, size_t nbytes) {
+  return os::write(fd, buffer, (unsigned int)nbytes) == nbytes;
+}
+
+// Write the compact table to a standalone image file. See compactHashtable.hpp
+// for the contract with the caller and CompactHashtableImage for the layout.
+bool CompactHashtableWriter::write_image(const char* filename, const char* payload, size_t payload_size) {
+  assert(_c_heap_allocated, "the table must be allocated in the C heap");
+  NumberSeq summary;
+  allocate_table();
+  dump_table(&summary);
+
+  size_t bucket_array_bytes = (_num_buckets + 1) * sizeof(u4);
+  size_t entry_array_bytes  = _num_compact_entries * sizeof(u4);
+  size_t image_size = sizeof(CompactHashtableImage::Header)
+                    + bucket_array_bytes + entry_array_bytes + payload_size;
+  if (image_size > (size_t)max_jint) {
+    return false; // too large for the u4 sizes in the header
+  }
+
+  int crc = ClassLoader::crc32(0, (const char*)_compact_buckets, (int)bucket_array_bytes);
+  crc = ClassLoader::crc32(crc, (const char*)_compact_entries, (int)entry_array_bytes);
+  crc = ClassLoader::crc32(crc, payload, (int)payload_size);
+
+  CompactHashtableImage::Header header;
+  header._magic               = CompactHashtableImage::IMAGE_MAGIC;
+  header._version             = CompactHashtableImage::IMAGE_VERSION;
+  header._entry_count         = (u4)_num_entries_written;
+  header._bucket_count        = (u4)_num_buckets;
+  header._bucket_array_length = (u4)(_num_buckets + 1);
+  header._entry_array_length  = (u4)_num_compact_entries;
+  header._payload_size        = (u4)payload_size;
+  header._crc                 = (u4)crc;
+
+  remove(filename);
+  int fd = os::open(filename, O_RDWR | O_CREAT | O_TRUNC | O_BINARY, 0444);
+  if (fd < 0) {
+    return false;
+  }
+  bool success = write_image_bytes(fd, &header, sizeof(header))
+              && write_image_bytes(fd, _compact_buckets, bucket_array_bytes)
+              && write_image_bytes(fd, _compact_entries, entry_array_bytes)
+              && (payload_size == 0 || write_image_bytes(fd, payload, payload_size));
+  ::close(fd);
+  if (!success) {
+    remove(filename); // don't leave a truncated image behind
+  }
+  return success;
+}
+
 /////////////////////////////////////////////////////////////
 //
 // The CompactHashtable implementation
@@ -220,9 +294,76 @@ void SimpleCompactHashtable::serialize_header(SerializeClosure* soc) {
 }
 #endif // INCLUDE_CDS
 
-#ifndef O_BINARY       // if defined (Win32) use binary files.
-#define O_BINARY 0     // otherwise do nothing.
-#endif
+////////////////////////////////////////////////////////
+//
+// CompactHashtableImage
+//
+CompactHashtableImage::~CompactHashtableImage() {
+  if (_base != NULL) {
+    os::unmap_memory(_base, _size);
+  }
+  if (_fd >= 0) {
+    ::close(_fd);
+  }
+}
+
+bool CompactHashtableImage::map(const char* filename, SimpleCompactHashtable* cht) {
+  assert(_base == NULL, "already mapped");
+  struct stat st;
+  if (os::stat(filename, &st) != 0) {
+    return false;
+  }
+  _size = st.st_size;
+  if (_size < sizeof(Header) || _size > (size_t)max_jint) {
+    return false;
+  }
+  _fd = os::open(filename, O_RDONLY | O_BINARY, 0);
+  if (_fd < 0) {
+    _fd = -1;
+    return false;
+  }
+  _base = os::map_memory(_fd, filename, 0, NULL, _size, true /* read_only */);
+  if (_base == NULL) {
+    ::close(_fd);
+    _fd = -1;
+    return false;
+  }
+
+  const Header* h = header();
+  size_t bucket_array_bytes = (size_t)h->_bucket_array_length * sizeof(u4);
+  size_t entry_array_bytes  = (size_t)h->_entry_array_length * sizeof(u4);
+  u4* buckets = (u4*)(_base + sizeof(Header));
+  u4* entries = (u4*)((char*)buckets + bucket_array_bytes);
+
+  bool valid = (h->_magic == IMAGE_MAGIC &&
+                h->_version == IMAGE_VERSION &&
+                h->_bucket_array_length == h->_bucket_count + 1 &&
+                sizeof(Header) + bucket_array_bytes + entry_array_bytes
+                  + h->_payload_size == _size);
+  if (valid) {
+    int crc = ClassLoader::crc32(0, (const char*)buckets, (int)bucket_array_bytes);
+    crc = ClassLoader::crc32(crc, (const char*)entries, (int)entry_array_bytes);
+    crc = ClassLoader::crc32(crc, (const char*)entries + entry_array_bytes, (int)h->_payload_size);
+    valid = ((u4)crc == h->_crc);
+  }
+  if (!valid) {
+    os::unmap_memory(_base, _size);
+    _base = NULL;
+    ::close(_fd);
+    _fd = -1;
+    return false;
+  }
+
+  // Assign the table fields directly rather than through init(): during a
+  // dynamic CDS dump init() translates the array pointers into the dump
+  // buffer, which must not happen for a mapped image.
+  cht->_base_address = (address)((char*)entries + entry_array_bytes); // start of the payload
+  cht->_entry_count  = h->_entry_count;
+  cht->_bucket_count = h->_bucket_count;
+  cht->_buckets      = buckets;
+  cht->_entries      = entries;
+  return true;
+}
 
 ////////////////////////////////////////////////////////
 //
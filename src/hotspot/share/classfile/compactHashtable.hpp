@@ -107,12 +107,19 @@ private:
   int _num_other_buckets;
   GrowableArray<Entry>** _buckets;
   CompactHashtableStats* _stats;
-  Array<u4>* _compact_buckets;
-  Array<u4>* _compact_entries;
+  u4* _compact_buckets;
+  u4* _compact_entries;
+  int _num_compact_entries;
+  bool _c_heap_allocated;
 
 public:
-  // This is called at dump-time only
-  CompactHashtableWriter(int num_entries, CompactHashtableStats* stats);
+  // By default the compact arrays are allocated in the CDS read-only dump
+  // space, so this is called at dump-time only. With c_heap_allocated=true
+  // the arrays are allocated in the C heap instead and the writer can be
+  // used at run time, e.g. for building a standalone image file with
+  // write_image().
+  CompactHashtableWriter(int num_entries, CompactHashtableStats* stats,
+                         bool c_heap_allocated = false);
   ~CompactHashtableWriter();
 
   void add(unsigned int hash, u4 value);
@@ -129,6 +136,16 @@ private:
 public:
   void dump(SimpleCompactHashtable *cht, const char* table_name);
 
+  // Write the compact table, followed by payload_size bytes of client
+  // payload, to a standalone image file that can later be mapped read-only
+  // by CompactHashtableImage and hence shared between JVMs via the page
+  // cache. The entry values added to this writer must be offsets into the
+  // payload: after mapping, the table's base address is the mapped address
+  // of the payload, so a value v decodes to &payload[v] (see
+  // OffsetCompactHashtable). Requires a c_heap_allocated writer. Returns
+  // false if the file cannot be written.
+  bool write_image(const char* filename, const char* payload, size_t payload_size);
+
   static size_t estimate_size(int num_entries);
 };
 #endif // INCLUDE_CDS
@@ -214,6 +231,8 @@ public:
 
   void init(address base_address, u4 entry_count, u4 bucket_count, u4* buckets, u4* entries);
 
+  friend class CompactHashtableImage;
+
   // Read/Write the table's header from/to the CDS archive
   void serialize_header(SerializeClosure* soc) NOT_CDS_RETURN;
 
@@ -338,6 +357,59 @@ class OffsetCompactHashtable : public CompactHashtable<
 };
 
 
+////////////////////////////////////////////////////////////////////////
+//
+// CompactHashtableImage -- maps a standalone compact table image file
+// (created by CompactHashtableWriter::write_image) and initializes a table
+// to read from it. The file is mapped read-only, so its pages are shared
+// via the page cache between all processes that map the same image. The
+// mapping stays valid until this object is deleted.
+//
+class CompactHashtableImage : public CHeapObj<mtSymbol> {
+  friend class CompactHashtableWriter;
+
+  // On-disk layout: Header, u4 buckets[_bucket_array_length],
+  // u4 entries[_entry_array_length], char payload[_payload_size].
+  struct Header {
+    u4 _magic;
+    u4 _version;
+    u4 _entry_count;
+    u4 _bucket_count;
+    u4 _bucket_array_length;   // number of u4 slots, i.e. _bucket_count + 1
+    u4 _entry_array_length;    // number of u4 slots
+    u4 _payload_size;          // in bytes
+    u4 _crc;                   // crc32 of buckets, entries and payload
+  };
+
+  static const u4 IMAGE_MAGIC   = 0x43485449; // "CHTI"
+  static const u4 IMAGE_VERSION = 1;
+
+  int    _fd;
+  char*  _base;
+  size_t _size;
+
+  const Header* header() const {
+    assert(_base != NULL, "not mapped");
+    return (const Header*)_base;
+  }
+
+public:
+  CompactHashtableImage() : _fd(-1), _base(NULL), _size(0) {}
+  ~CompactHashtableImage();
+
+  // Map the image file and point cht at the mapped buckets/entries, with the
+  // payload as the table's base address. Returns false (leaving cht
+  // untouched) if the file cannot be mapped or fails validation.
+  bool map(const char* filename, SimpleCompactHashtable* cht);
+
+  const char* payload() const {
+    return _base + sizeof(Header)
+         + (header()->_bucket_array_length + header()->_entry_array_length) * sizeof(u4);
+  }
+  size_t payload_size() const { return header()->_payload_size; }
+};
+
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Read/Write the contents of a hashtable textual dump (created by
@@ -37,6 +37,8 @@
 #include "runtime/orderAccess.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/safepointVerifiers.hpp"
+#include "utilities/globalCounter.inline.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/hashtable.inline.hpp"
 
 // Optimization: if any dictionary needs resizing, we set this flag,
@@ -149,16 +151,18 @@ bool Dictionary::resize_if_needed() {
 }
 
 bool DictionaryEntry::contains_protection_domain(oop protection_domain) const {
-  // Lock the pd_set list.  This lock cannot safepoint since the caller holds
-  // a Dictionary entry, which can be moved if the Dictionary is resized.
-  MutexLocker ml(ProtectionDomainSet_lock, Mutex::_no_safepoint_check_flag);
+  // This is the repeat-validation fast path: walk the pd_set lock-free.
+  // The critical section keeps entries unlinked by the concurrent cleanup
+  // in Dictionary::clean_cached_protection_domains() from being freed
+  // under us; an unlinked entry still carries a usable next link.
+  GlobalCounter::CriticalSection cs(Thread::current());
 #ifdef ASSERT
   if (oopDesc::equals(protection_domain, instance_klass()->protection_domain())) {
     // Ensure this doesn't show up in the pd_set (invariant)
     bool in_pd_set = false;
-    for (ProtectionDomainEntry* current = pd_set();
+    for (ProtectionDomainEntry* current = pd_set_acquire();
                                 current != NULL;
-                                current = current->next()) {
+                                current = current->next_acquire()) {
       if (oopDesc::equals(current->object_no_keepalive(), protection_domain)) {
         in_pd_set = true;
         break;
@@ -176,9 +180,9 @@ bool DictionaryEntry::contains_protection_domain(oop protection_domain) const {
     return true;
   }
 
-  for (ProtectionDomainEntry* current = pd_set();
+  for (ProtectionDomainEntry* current = pd_set_acquire();
                               current != NULL;
-                              current = current->next()) {
+                              current = current->next_acquire()) {
     if (oopDesc::equals(current->object_no_keepalive(), protection_domain)) return true;
   }
   return false;
@@ -194,7 +198,8 @@ void DictionaryEntry::add_protection_domain(Dictionary* dict, Handle protection_
     MutexLocker ml(ProtectionDomainSet_lock, Mutex::_no_safepoint_check_flag);
     ProtectionDomainEntry* new_head =
                 new ProtectionDomainEntry(entry, pd_set());
-    set_pd_set(new_head);
+    // Publish the new head for the lock-free readers.
+    release_set_pd_set(new_head);
   }
   LogTarget(Trace, protectiondomain) lt;
   if (lt.is_enabled()) {
@@ -362,6 +367,11 @@ void Dictionary::clean_cached_protection_domains() {
     return;
   }
 
+  // Unlinked entries cannot be freed right away: readers may be walking
+  // the lists lock-free. Collect them and free them after a grace period.
+  ResourceMark rm;
+  GrowableArray<ProtectionDomainEntry*> delete_list;
+
   for (int index = 0; index < table_size(); index++) {
     for (DictionaryEntry* probe = bucket(index);
                           probe != NULL;
@@ -383,15 +393,17 @@ void Dictionary::clean_cached_protection_domains() {
             ls.print(" loading: "); probe->instance_klass()->print_value_on(&ls);
             ls.cr();
           }
+          // Unlink with release stores and leave the entry itself intact;
+          // a lock-free reader positioned on it can still follow its next
+          // link.
           if (probe->pd_set() == current) {
-            probe->set_pd_set(current->next());
+            probe->release_set_pd_set(current->next());
           } else {
             assert(prev != NULL, "should be set by alive entry");
-            prev->set_next(current->next());
+            prev->release_set_next(current->next());
           }
-          ProtectionDomainEntry* to_delete = current;
+          delete_list.push(current);
           current = current->next();
-          delete to_delete;
         } else {
           prev = current;
           current = current->next();
@@ -399,6 +411,15 @@ void Dictionary::clean_cached_protection_domains() {
       }
     }
   }
+
+  if (delete_list.length() > 0) {
+    // Wait for readers that might still be positioned on an unlinked
+    // entry, then free the lot.
+    GlobalCounter::write_synchronize();
+    for (int i = 0; i < delete_list.length(); i++) {
+      delete delete_list.at(i);
+    }
+  }
 }
 
 
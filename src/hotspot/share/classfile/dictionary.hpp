@@ -29,6 +29,7 @@
 #include "classfile/systemDictionary.hpp"
 #include "oops/instanceKlass.hpp"
 #include "oops/oop.hpp"
+#include "runtime/orderAccess.hpp"
 #include "utilities/hashtable.hpp"
 #include "utilities/ostream.hpp"
 
@@ -150,6 +151,12 @@ class DictionaryEntry : public HashtableEntry<InstanceKlass*, mtClass> {
     return (DictionaryEntry**)HashtableEntry<InstanceKlass*, mtClass>::next_addr();
   }
 
+  // Readers of the pd_set probe it lock-free inside a GlobalCounter
+  // critical section; writers hold ProtectionDomainSet_lock and publish
+  // new heads with a release store. Entries unlinked by the cleanup path
+  // are only freed after a GlobalCounter::write_synchronize().
+  ProtectionDomainEntry* pd_set_acquire() const    { return OrderAccess::load_acquire(&_pd_set); }
+  void release_set_pd_set(ProtectionDomainEntry* new_head) { OrderAccess::release_store(&_pd_set, new_head); }
   ProtectionDomainEntry* pd_set() const            { return _pd_set; }
   void set_pd_set(ProtectionDomainEntry* new_head) {  _pd_set = new_head; }
 
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/fieldLayoutHints.hpp"
+#include "classfile/symbolTable.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/java.hpp"
+
+FieldLayoutHints::Hint* FieldLayoutHints::_hints = NULL;
+
+void FieldLayoutHints::initialize() {
+  if (FieldLayoutHintsFile == NULL) {
+    return;
+  }
+
+  FILE* stream = fopen(FieldLayoutHintsFile, "rt");
+  if (stream == NULL) {
+    vm_exit_during_initialization("Could not open field layout hints file",
+                                  FieldLayoutHintsFile);
+  }
+
+  char line[1024];
+  int line_no = 0;
+  while (fgets(line, sizeof(line), stream) != NULL) {
+    line_no++;
+    if (line[0] == '#') { // comment
+      continue;
+    }
+    char class_name[512];
+    char field_name[512];
+    int matched = sscanf(line, "%511s %511s", class_name, field_name);
+    if (matched <= 0) { // blank line
+      continue;
+    }
+    if (matched != 2) {
+      warning("Ignoring malformed line %d in field layout hints file %s",
+              line_no, FieldLayoutHintsFile);
+      continue;
+    }
+    // The hints live for the lifetime of the VM, so permanent symbols are
+    // appropriate; they also make the layout-time lookups pointer compares.
+    Symbol* cls = SymbolTable::new_permanent_symbol(class_name);
+    Symbol* fld = SymbolTable::new_permanent_symbol(field_name);
+    _hints = new Hint(cls, fld, _hints);
+  }
+  fclose(stream);
+}
+
+bool FieldLayoutHints::has_hints_for(const Symbol* class_name) {
+  for (Hint* hint = _hints; hint != NULL; hint = hint->_next) {
+    if (hint->_class_name == class_name) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool FieldLayoutHints::is_hot_field(const Symbol* class_name, const Symbol* field_name) {
+  for (Hint* hint = _hints; hint != NULL; hint = hint->_next) {
+    if (hint->_class_name == class_name && hint->_field_name == field_name) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void fieldLayoutHints_init() {
+  FieldLayoutHints::initialize();
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_CLASSFILE_FIELDLAYOUTHINTS_HPP
+#define SHARE_CLASSFILE_FIELDLAYOUTHINTS_HPP
+
+#include "memory/allocation.hpp"
+
+class Symbol;
+
+// Hot-field hints for instance field layout, read from the file named by
+// -XX:FieldLayoutHintsFile.  Each line of the file names one hot field as
+// a "class field" pair, with the class in internal form:
+//
+//   com/example/Order status
+//   com/example/Order total
+//   # audit fields of Order are left unhinted and therefore laid out last
+//
+// ClassFileParser::layout_fields allocates hinted fields before unhinted
+// ones within each size class, so the fields a training run found hot pack
+// towards the start of the instance and the cold tail no longer interleaves
+// with them.  The hints are typically produced offline from profile data.
+class FieldLayoutHints : AllStatic {
+ private:
+  // One parsed hint line.  The list is small and read once per class
+  // layout, so a linked list with interned symbols is sufficient.
+  class Hint : public CHeapObj<mtClass> {
+   public:
+    Symbol* const _class_name;
+    Symbol* const _field_name;
+    Hint*   const _next;
+
+    Hint(Symbol* class_name, Symbol* field_name, Hint* next) :
+      _class_name(class_name), _field_name(field_name), _next(next) {}
+  };
+
+  static Hint* _hints;
+
+ public:
+  // Parse FieldLayoutHintsFile, if set.  Called once during VM
+  // initialization, after the symbol table exists and before any class
+  // is laid out.
+  static void initialize();
+
+  static bool has_hints_for(const Symbol* class_name);
+  static bool is_hot_field(const Symbol* class_name, const Symbol* field_name);
+};
+
+#endif // SHARE_CLASSFILE_FIELDLAYOUTHINTS_HPP
@@ -2277,6 +2277,19 @@ void java_lang_Throwable::java_printStackTrace(Handle throwable, TRAPS) {
                           THREAD);
 }
 
+// Note on the eager walk below: only the compact backtrace (method/bci/
+// mirror/name chunk arrays) is built at throw time; the expensive
+// StackTraceElement graph is already materialized lazily, on first access,
+// in get_stack_trace_elements().  Deferring the walk itself -- recording
+// into a per-thread (Method*, bci) ring at throw time -- is not possible,
+// because the frames must be captured before they are popped, and raw
+// Method* recorded without the mirror arrays would not keep their classes
+// from being unloaded.  Reusing the chunk arrays from a thread-local pool
+// is equally off the table: they are reachable from the Throwable's
+// backtrace field, so handing them to a second throwable would corrupt the
+// first's trace.  Workloads that throw for control flow should override
+// fillInStackTrace() or cap MaxJavaStackTraceDepth; hot implicit exceptions
+// are already elided by OmitStackTraceInFastThrow.
 void java_lang_Throwable::fill_in_stack_trace(Handle throwable, const methodHandle& method, TRAPS) {
   if (!StackTraceInThrowable) return;
   ResourceMark rm(THREAD);
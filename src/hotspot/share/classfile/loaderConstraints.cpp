@@ -41,6 +41,30 @@ void LoaderConstraintEntry::set_loader(int i, oop p) {
 LoaderConstraintTable::LoaderConstraintTable(int table_size)
   : Hashtable<InstanceKlass*, mtClass>(table_size, sizeof(LoaderConstraintEntry)) {};
 
+// The table starts small; an application that mixes many class loaders can
+// accumulate thousands of constraints, so the bucket array is grown rather
+// than walking ever longer chains on the class-loading path.
+bool LoaderConstraintTable::_needs_resizing = false;
+
+const int _resize_load_trigger = 5;       // load factor that will trigger the resize
+const int _resize_max_size     = 40423;   // the max table size allowed
+
+void LoaderConstraintTable::check_if_needs_resize() {
+  assert_lock_strong(SystemDictionary_lock);
+  if ((number_of_entries() / table_size()) > _resize_load_trigger &&
+      table_size() < _resize_max_size) {
+    _needs_resizing = true;
+  }
+}
+
+void LoaderConstraintTable::resize_if_needed() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  if (_needs_resizing) {
+    maybe_grow(_resize_max_size, _resize_load_trigger);
+    _needs_resizing = false;
+  }
+}
+
 
 LoaderConstraintEntry* LoaderConstraintTable::new_entry(
                                  unsigned int hash, Symbol* name,
@@ -246,6 +270,7 @@ bool LoaderConstraintTable::add_entry(Symbol* class_name,
     p->set_klass(klass);
     p->set_next(bucket(index));
     set_entry(index, p);
+    check_if_needs_resize();
     if (lt.is_enabled()) {
       ResourceMark rm;
       lt.print("adding new constraint for name: %s, loader[0]: %s,"
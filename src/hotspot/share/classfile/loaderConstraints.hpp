@@ -35,13 +35,24 @@ class Symbol;
 class LoaderConstraintTable : public Hashtable<InstanceKlass*, mtClass> {
 
 private:
+  static bool _needs_resizing;
+
   LoaderConstraintEntry** find_loader_constraint(Symbol* name,
                                                  Handle loader);
 
+  // Request growth of the bucket array if the table has become overloaded.
+  // Called on the class-loading path with the SystemDictionary lock held;
+  // the actual resize is deferred to the next safepoint cleanup because
+  // BasicHashtable::resize() must exclude all readers.
+  void check_if_needs_resize();
+
 public:
 
   LoaderConstraintTable(int table_size);
 
+  static bool needs_resizing() { return _needs_resizing; }
+  void resize_if_needed();
+
   LoaderConstraintEntry* new_entry(unsigned int hash, Symbol* name,
                                    InstanceKlass* klass, int num_loaders,
                                    int max_loaders);
@@ -126,6 +126,17 @@ bool ModuleEntry::can_read(ModuleEntry* m) const {
     return true;
   }
 
+  // Reflective and JNI access checks land here repeatedly for the same
+  // module pairs, so a target that was verified readable before can be
+  // accepted without taking Module_lock: readability is monotonic while
+  // the target module is alive.  Only the caller's pointer is compared
+  // against the cache, never dereferenced, so a racing update is benign.
+  for (int i = 0; i < READ_CACHE_SIZE; i++) {
+    if (_read_cache[i] == m) {
+      return true;
+    }
+  }
+
   MutexLocker m1(Module_lock);
   // This is a guard against possible race between agent threads that redefine
   // or retransform classes in this module. Only one of them is adding the
@@ -136,16 +147,29 @@ bool ModuleEntry::can_read(ModuleEntry* m) const {
   if (this->has_default_read_edges() && !m->is_named()) {
     ClassLoaderData* cld = m->loader_data();
     if (cld->is_the_null_class_loader_data() || cld->is_system_class_loader_data()) {
+      cache_readable(m);
       return true; // default read edge
     }
   }
   if (!has_reads_list()) {
     return false;
   } else {
-    return _reads->contains(m);
+    bool found = _reads->contains(m);
+    if (found) {
+      cache_readable(m);
+    }
+    return found;
   }
 }
 
+// Remember m as a verified readable target for the lock-free fast path
+// in can_read().
+void ModuleEntry::cache_readable(ModuleEntry* m) const {
+  assert_locked_or_safepoint(Module_lock);
+  _read_cache[_read_cache_next] = m;
+  _read_cache_next = (_read_cache_next + 1) % READ_CACHE_SIZE;
+}
+
 // Add a new module to this module's reads list
 void ModuleEntry::add_read(ModuleEntry* m) {
   // Unnamed module is special cased and can read all modules
@@ -208,6 +232,13 @@ bool ModuleEntry::has_reads_list() const {
 void ModuleEntry::purge_reads() {
   assert_locked_or_safepoint(Module_lock);
 
+  // Drop the readability cache unconditionally: a cached module may be
+  // about to be freed, and its address could later be reused for a module
+  // this one cannot read.
+  for (int i = 0; i < READ_CACHE_SIZE; i++) {
+    _read_cache[i] = NULL;
+  }
+
   if (_must_walk_reads && has_reads_list()) {
     // This module's _must_walk_reads flag will be reset based
     // on the remaining live modules on the reads list.
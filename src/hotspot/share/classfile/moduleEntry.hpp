@@ -76,6 +76,16 @@ private:
   bool _is_patched;                    // whether the module is patched via --patch-module
   JFR_ONLY(DEFINE_TRACE_ID_FIELD;)
   enum {MODULE_READS_SIZE = 101};      // Initial size of list of modules that the module can read.
+  enum {READ_CACHE_SIZE = 2};          // Number of recently verified readable modules remembered
+
+  // Lock-free cache of modules recently verified readable from this one.
+  // Read edges are only ever added, never removed, so a cached entry can
+  // only go stale when the cached module dies; purge_reads() clears the
+  // cache at that class unloading safepoint, before the entry is freed.
+  mutable ModuleEntry* volatile _read_cache[READ_CACHE_SIZE];
+  mutable int _read_cache_next;
+
+  void cache_readable(ModuleEntry* m) const;
 
 public:
   void init() {
@@ -90,6 +100,10 @@ public:
     _must_walk_reads = false;
     _is_patched = false;
     _is_open = false;
+    for (int i = 0; i < READ_CACHE_SIZE; i++) {
+      _read_cache[i] = NULL;
+    }
+    _read_cache_next = 0;
   }
 
   Symbol*          name() const                        { return literal(); }
@@ -28,6 +28,7 @@
 #include "oops/oop.hpp"
 #include "oops/weakHandle.hpp"
 #include "memory/iterator.hpp"
+#include "runtime/orderAccess.hpp"
 #include "utilities/hashtable.hpp"
 
 // This class caches the approved protection domains that can access loaded classes.
@@ -107,7 +108,7 @@ public:
 class ProtectionDomainEntry :public CHeapObj<mtClass> {
   friend class VMStructs;
  public:
-  ProtectionDomainEntry* _next;
+  ProtectionDomainEntry* volatile _next;
   ProtectionDomainCacheEntry* _pd_cache;
 
   ProtectionDomainEntry(ProtectionDomainCacheEntry* pd_cache, ProtectionDomainEntry* next) {
@@ -115,8 +116,12 @@ class ProtectionDomainEntry :public CHeapObj<mtClass> {
     _next     = next;
   }
 
+  // Readers walk a pd_set lock-free inside a GlobalCounter critical
+  // section, so links are published with release stores and unlinked
+  // entries stay intact until a grace period has passed.
+  ProtectionDomainEntry* next_acquire() { return OrderAccess::load_acquire(&_next); }
   ProtectionDomainEntry* next() { return _next; }
-  void set_next(ProtectionDomainEntry* entry) { _next = entry; }
+  void release_set_next(ProtectionDomainEntry* entry) { OrderAccess::release_store(&_next, entry); }
   oop object();
   oop object_no_keepalive();
 };
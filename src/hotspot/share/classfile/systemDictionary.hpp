@@ -350,6 +350,10 @@ public:
   // Applies "f->do_oop" to all root oops in the system dictionary.
   static void oops_do(OopClosure* f);
 
+  // Grow the loader constraint table if it has become overloaded. Called
+  // from the safepoint cleanup task (see LoaderConstraintTable::needs_resizing).
+  static void resize_loader_constraints();
+
   // System loader lock
   static oop system_loader_lock()           { return _system_loader_lock_obj; }
 
@@ -104,8 +104,17 @@ bool VerificationType::is_reference_assignable_from(
       }
     }
 
-    return resolve_and_check_assignability(klass, name(), from.name(),
-          from_field_is_protected, from.is_array(), from.is_object(), THREAD);
+    // Consult the memo table before resolving; verifying the other methods
+    // of this class has typically answered the same query already.
+    AssignabilityQuery query(name(), from.name(), from_field_is_protected);
+    bool* prev_result = context->assignability_table()->get(query);
+    if (prev_result != NULL) {
+      return *prev_result;
+    }
+    bool result = resolve_and_check_assignability(klass, name(), from.name(),
+          from_field_is_protected, from.is_array(), from.is_object(), CHECK_false);
+    context->assignability_table()->put(query, result);
+    return result;
   } else if (is_array() && from.is_array()) {
     VerificationType comp_this = get_component(context, CHECK_false);
     VerificationType comp_from = from.get_component(context, CHECK_false);
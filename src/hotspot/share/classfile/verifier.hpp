@@ -274,6 +274,41 @@ typedef ResourceHashtable<int, sig_as_verification_types*,
                           primitive_hash<int>, primitive_equals<int>, 1007>
                           method_signatures_table_type;
 
+// Key for one resolve-and-check assignability query.  The outcome of a query
+// depends only on the two class names (resolved in the context of the class
+// being verified) and on whether a protected field or method is being
+// accessed, so the same triple can recur across the methods of a class.
+class AssignabilityQuery {
+ public:
+  Symbol* _target;
+  Symbol* _from;
+  bool    _from_field_is_protected;
+
+  AssignabilityQuery() :
+    _target(NULL), _from(NULL), _from_field_is_protected(false) {}
+  AssignabilityQuery(Symbol* target, Symbol* from, bool from_field_is_protected) :
+    _target(target), _from(from),
+    _from_field_is_protected(from_field_is_protected) {}
+
+  static unsigned hash(AssignabilityQuery const& query) {
+    return primitive_hash<Symbol*>(query._target) * 31 +
+           primitive_hash<Symbol*>(query._from) +
+           (query._from_field_is_protected ? 1 : 0);
+  }
+  static bool equals(AssignabilityQuery const& q1, AssignabilityQuery const& q2) {
+    return q1._target == q2._target && q1._from == q2._from &&
+           q1._from_field_is_protected == q2._from_field_is_protected;
+  }
+};
+
+// Memoizes assignability queries for the duration of one class's
+// verification, saving the repeated resolution of the same class pairs.
+// The symbols used as keys are kept alive by the constant pool or by the
+// verifier's temporary symbol list, both of which outlive the table.
+typedef ResourceHashtable<AssignabilityQuery, bool,
+                          AssignabilityQuery::hash, AssignabilityQuery::equals, 109>
+                          assignability_table_type;
+
 // A new instance of this class is created for each class being verified
 class ClassVerifier : public StackObj {
  private:
@@ -286,6 +321,7 @@ class ClassVerifier : public StackObj {
   char* _message;
 
   method_signatures_table_type* _method_signatures_table;
+  assignability_table_type* _assignability_table;
 
   ErrorContext _error_context;  // contains information about an error
 
@@ -445,6 +481,14 @@ class ClassVerifier : public StackObj {
     _method_signatures_table = method_signatures_table;
   }
 
+  assignability_table_type* assignability_table() const {
+    return _assignability_table;
+  }
+
+  void set_assignability_table(assignability_table_type* assignability_table) {
+    _assignability_table = assignability_table;
+  }
+
   int change_sig_to_verificationType(
     SignatureStream* sig_type, VerificationType* inference_type);
 
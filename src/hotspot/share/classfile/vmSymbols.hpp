@@ -928,6 +928,9 @@
    do_signature(getCharStringU_signature,                        "([BI)C")                                              \
   do_intrinsic(_putCharStringU,           java_lang_StringUTF16, putChar_name, putCharStringU_signature,         F_S)   \
    do_signature(putCharStringU_signature,                        "([BII)V")                                             \
+  do_intrinsic(_hashCodeL,                java_lang_StringLatin1, hashCode_name, hashCodeB_signature,            F_S)   \
+  do_intrinsic(_hashCodeU,                java_lang_StringUTF16,  hashCode_name, hashCodeB_signature,            F_S)   \
+   do_signature(hashCodeB_signature,                             "([B)I")                                               \
   do_intrinsic(_compareToL,               java_lang_StringLatin1,compareTo_name, compareTo_indexOf_signature,    F_S)   \
   do_intrinsic(_compareToU,               java_lang_StringUTF16, compareTo_name, compareTo_indexOf_signature,    F_S)   \
   do_intrinsic(_compareToLU,              java_lang_StringLatin1,compareToLU_name, compareTo_indexOf_signature,  F_S)   \
@@ -314,6 +314,12 @@ void CodeCache::initialize_heaps() {
   add_heap(non_profiled_space, "CodeHeap 'non-profiled nmethods'", CodeBlobType::MethodNonProfiled);
 }
 
+// Large (huge) pages do not need any special request here: with
+// -XX:+UseLargePages this picks the biggest executable page size the
+// reservation can use, subject to leaving at least min_pages so that
+// an InitialCodeCacheSize smaller than the reservation can still be
+// committed incrementally.  On Linux a 240MB cache thus sits on 2MB
+// pages whenever large page execution is available.
 size_t CodeCache::page_size(bool aligned, size_t min_pages) {
   if (os::can_execute_large_page_memory()) {
     if (InitialCodeCacheSize < ReservedCodeCacheSize) {
@@ -899,6 +905,42 @@ double CodeCache::reverse_free_ratio(int code_blob_type) {
   return result;
 }
 
+/**
+ * Returns the size of the largest contiguous free block in the code heap
+ * for the given code blob type. When the heap is fragmented this can be
+ * far smaller than its total unallocated capacity.
+ */
+size_t CodeCache::largest_free_block(int code_blob_type) {
+  CodeHeap* heap = get_code_heap(code_blob_type);
+  if (heap == NULL) {
+    return 0;
+  }
+  MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+  return heap->largest_free_block();
+}
+
+/**
+ * Returns true if the code heap for the given code blob type is so
+ * fragmented that its largest contiguous free block holds only a few
+ * nmethods of the heap's current average size. In that state allocations
+ * can start failing although the free ratio still looks comfortable,
+ * because the free space is scattered into pieces that are individually
+ * too small to be allocated from.
+ */
+bool CodeCache::is_heap_fragmented(int code_blob_type) {
+  CodeHeap* heap = get_code_heap(code_blob_type);
+  if (heap == NULL || heap->blob_count() == 0) {
+    return false;
+  }
+  size_t largest_free;
+  {
+    MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    largest_free = heap->largest_free_block();
+  }
+  size_t avg_blob_size = heap->allocated_capacity() / heap->blob_count();
+  return largest_free < 4 * avg_blob_size;
+}
+
 size_t CodeCache::bytes_allocated_in_freelists() {
   size_t allocated_bytes = 0;
   FOR_ALL_ALLOCABLE_HEAPS(heap) {
@@ -214,6 +214,8 @@ class CodeCache : AllStatic {
   static size_t max_capacity();
 
   static double reverse_free_ratio(int code_blob_type);
+  static size_t largest_free_block(int code_blob_type);
+  static bool is_heap_fragmented(int code_blob_type);
 
   static void clear_inline_caches();                  // clear all inline caches
   static void cleanup_inline_caches();                // clean unloaded/zombie nmethods from inline caches
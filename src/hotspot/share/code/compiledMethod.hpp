@@ -101,6 +101,40 @@ class PcDescCache {
   PcDesc* last_pc_desc() { return _pc_descs[0]; }
 };
 
+// Caches the fixed-size header part of decoded debug info scopes, keyed by
+// decode offset. Repeated stack walks (JFR sampling, exception unwinding)
+// decode the same scopes of hot frames over and over; a hit lets
+// ScopeDesc::decode_body skip the DebugInfoReadStream pass. The table is
+// direct mapped and a slot is kept by the first scope decoded into it, which
+// bounds the cache without needing a replacement protocol: entries are
+// immutable once published and may be in use by concurrent readers, so they
+// are only freed when the whole compiled method is.
+class ScopeDescCache {
+ public:
+  class Entry : public CHeapObj<mtCode> {
+    friend class ScopeDescCache;
+    friend class ScopeDesc;
+    int     _decode_offset;
+    int     _sender_decode_offset;
+    int     _locals_decode_offset;
+    int     _expressions_decode_offset;
+    int     _monitors_decode_offset;
+    Method* _method;
+    int     _bci;
+  };
+ private:
+  enum { cache_size = 16 };
+  typedef Entry* EntryPtr;
+  volatile EntryPtr _entries[cache_size];
+  static int index_for(int decode_offset) { return decode_offset & (cache_size - 1); }
+ public:
+  ScopeDescCache();
+  const Entry* find(int decode_offset) const;
+  void add(int decode_offset, int sender_decode_offset, Method* method, int bci,
+           int locals_decode_offset, int expressions_decode_offset, int monitors_decode_offset);
+  void purge();
+};
+
 class PcDescSearch {
 private:
   address _code_begin;
@@ -170,6 +204,7 @@ protected:
   address _deopt_mh_handler_begin;
 
   PcDescContainer _pc_desc_container;
+  ScopeDescCache _scope_desc_cache;
   ExceptionCache * volatile _exception_cache;
 
   void* _gc_data;
@@ -242,6 +277,10 @@ public:
   ScopeDesc* scope_desc_at(address pc);
   ScopeDesc* scope_desc_near(address pc);
 
+  // Cache of decoded scope headers; ScopeDesc instances are created from
+  // logically const compiled methods, hence the cast.
+  ScopeDescCache* scope_desc_cache() const { return const_cast<ScopeDescCache*>(&_scope_desc_cache); }
+
   bool is_at_poll_return(address pc);
   bool is_at_poll_or_poll_return(address pc);
 
@@ -29,6 +29,17 @@
 
 // Simple interface for filing out and filing in basic types
 // Used for writing out and reading in debugging information.
+//
+// The encoding is sequential varints on purpose.  Random access into
+// debug info does not come from the stream format but from the layer
+// above: every serialized scope header stores direct decode offsets
+// for its sender and for its locals/expressions/monitors sections, and
+// DebugInformationRecorder shares identical sections between scopes by
+// offset.  A group-varint layout with skip tables was considered and
+// rejected -- the per-group tags and per-scope skip offsets cost more
+// bytes than linear decode costs time once the offsets above exist,
+// and they would defeat the section sharing that keeps debug info at
+// its current fraction of the code cache.
 
 class CompressedStream : public ResourceObj {
   friend class VMStructs;
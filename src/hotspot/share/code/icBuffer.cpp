@@ -36,12 +36,14 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 #include "runtime/stubRoutines.hpp"
 #include "runtime/thread.hpp"
 
 DEF_STUB_INTERFACE(ICStub);
 
-StubQueue* InlineCacheBuffer::_buffer    = NULL;
+StubQueue* InlineCacheBuffer::_buffers[max_stub_queues] = { NULL };
+int InlineCacheBuffer::_num_buffers = 0;
 
 CompiledICHolder* InlineCacheBuffer::_pending_released = NULL;
 int InlineCacheBuffer::_pending_count = 0;
@@ -138,14 +140,29 @@ void ICStub::print() {
 
 
 void InlineCacheBuffer::initialize() {
-  if (_buffer != NULL) return; // already initialized
-  _buffer = new StubQueue(new ICStubInterface, 10*K, InlineCacheBuffer_lock, "InlineCacheBuffer");
-  assert (_buffer != NULL, "cannot allocate InlineCacheBuffer");
+  if (_num_buffers > 0) return; // already initialized
+  _num_buffers = MIN2(os::initial_active_processor_count(), max_stub_queues);
+  for (int i = 0; i < _num_buffers; i++) {
+    Mutex* lock = new Mutex(Mutex::leaf, "InlineCacheBuffer", true, Monitor::_safepoint_check_never);
+    _buffers[i] = new StubQueue(new ICStubInterface, 10*K, lock, "InlineCacheBuffer");
+    assert (_buffers[i] != NULL, "cannot allocate InlineCacheBuffer");
+  }
 }
 
 
 ICStub* InlineCacheBuffer::new_ic_stub() {
-  return (ICStub*)buffer()->request_committed(ic_stub_code_size());
+  // Start at the current thread's home queue to spread lock traffic, but
+  // try the remaining queues before giving up: the buffer-full safepoint
+  // is only worth its cost once all queues are exhausted.
+  int home = (int)(((uintptr_t)Thread::current() >> 9) % (uintptr_t)_num_buffers);
+  for (int i = 0; i < _num_buffers; i++) {
+    StubQueue* q = _buffers[(home + i) % _num_buffers];
+    ICStub* ic_stub = (ICStub*)q->request_committed(ic_stub_code_size());
+    if (ic_stub != NULL) {
+      return ic_stub;
+    }
+  }
+  return NULL;
 }
 
 
@@ -171,23 +188,36 @@ void InlineCacheBuffer::refill_ic_stubs() {
 
 
 void InlineCacheBuffer::update_inline_caches() {
-  if (buffer()->number_of_stubs() > 0) {
-    if (TraceICBuffer) {
-      tty->print_cr("[updating inline caches with %d stubs]", buffer()->number_of_stubs());
+  for (int i = 0; i < _num_buffers; i++) {
+    StubQueue* q = _buffers[i];
+    if (q->number_of_stubs() > 0) {
+      if (TraceICBuffer) {
+        tty->print_cr("[updating inline caches with %d stubs]", q->number_of_stubs());
+      }
+      q->remove_all();
     }
-    buffer()->remove_all();
   }
   release_pending_icholders();
 }
 
 
 bool InlineCacheBuffer::contains(address instruction_address) {
-  return buffer()->contains(instruction_address);
+  for (int i = 0; i < _num_buffers; i++) {
+    if (_buffers[i]->contains(instruction_address)) {
+      return true;
+    }
+  }
+  return false;
 }
 
 
 bool InlineCacheBuffer::is_empty() {
-  return buffer()->number_of_stubs() == 0;
+  for (int i = 0; i < _num_buffers; i++) {
+    if (_buffers[i]->number_of_stubs() > 0) {
+      return false;
+    }
+  }
+  return true;
 }
 
 
@@ -139,13 +139,19 @@ class InlineCacheBuffer: public AllStatic {
 
   static int ic_stub_code_size();
 
-  static StubQueue* _buffer;
+  // The ICStubs are spread over a small number of stub queues, each
+  // guarded by its own lock, so that threads transitioning unrelated
+  // inline caches do not serialize on a single lock. A thread starts
+  // at its "home" queue and falls back to the others before declaring
+  // the buffer full (see new_ic_stub).
+  static const int max_stub_queues = 8;
+
+  static StubQueue* _buffers[max_stub_queues];
+  static int _num_buffers;
 
   static CompiledICHolder* _pending_released;
   static int _pending_count;
 
-  static StubQueue* buffer()                         { return _buffer;         }
-
   static ICStub* new_ic_stub();
 
   // Machine-dependent implementation of ICBuffer
@@ -388,6 +388,53 @@ void PcDescCache::add_pc_desc(PcDesc* pc_desc) {
   }
 }
 
+ScopeDescCache::ScopeDescCache() {
+  for (int i = 0; i < cache_size; i++) {
+    _entries[i] = NULL;
+  }
+}
+
+const ScopeDescCache::Entry* ScopeDescCache::find(int decode_offset) const {
+  const Entry* entry = OrderAccess::load_acquire(&_entries[index_for(decode_offset)]);
+  if (entry != NULL && entry->_decode_offset == decode_offset) {
+    return entry;
+  }
+  return NULL;
+}
+
+void ScopeDescCache::add(int decode_offset, int sender_decode_offset, Method* method, int bci,
+                         int locals_decode_offset, int expressions_decode_offset,
+                         int monitors_decode_offset) {
+  volatile EntryPtr* slot = &_entries[index_for(decode_offset)];
+  if (*slot != NULL) {
+    // The first scope decoded into a slot keeps it; a resident entry may be
+    // in use by a concurrent reader and cannot be replaced.
+    return;
+  }
+  Entry* entry = new Entry();
+  entry->_decode_offset             = decode_offset;
+  entry->_sender_decode_offset      = sender_decode_offset;
+  entry->_method                    = method;
+  entry->_bci                       = bci;
+  entry->_locals_decode_offset      = locals_decode_offset;
+  entry->_expressions_decode_offset = expressions_decode_offset;
+  entry->_monitors_decode_offset    = monitors_decode_offset;
+  if (Atomic::cmpxchg(entry, slot, (EntryPtr)NULL) != NULL) {
+    // Lost the race to publish this slot.
+    delete entry;
+  }
+}
+
+void ScopeDescCache::purge() {
+  // Called when the compiled method is flushed; no reader can still be
+  // walking its frames at that point.
+  for (int i = 0; i < cache_size; i++) {
+    Entry* entry = _entries[i];
+    _entries[i] = NULL;
+    delete entry;
+  }
+}
+
 // adjust pcs_size so that it is a multiple of both oopSize and
 // sizeof(PcDesc) (assumes that if sizeof(PcDesc) is not a multiple
 // of oopSize, then 2*sizeof(PcDesc) is)
@@ -1448,6 +1495,9 @@ void nmethod::flush() {
                   CodeCache::unallocated_capacity(CodeCache::get_code_blob_type(this))/1024);
   }
 
+  // Free the cached scope headers; nobody can be walking our frames anymore.
+  _scope_desc_cache.purge();
+
   // We need to deallocate any ExceptionCache data.
   // Note that we do not need to grab the nmethod lock for this, it
   // better be thread safe if we're disposing of it!
@@ -81,6 +81,20 @@ void ScopeDesc::decode_body() {
     _expressions_decode_offset = DebugInformationRecorder::serialized_null;
     _monitors_decode_offset = DebugInformationRecorder::serialized_null;
   } else {
+    // Check the per-method cache of decoded headers first; stack walks tend
+    // to revisit the same scopes many times.
+    ScopeDescCache* cache = _code->scope_desc_cache();
+    const ScopeDescCache::Entry* cached = cache->find(decode_offset());
+    if (cached != NULL) {
+      _sender_decode_offset      = cached->_sender_decode_offset;
+      _method                    = cached->_method;
+      _bci                       = cached->_bci;
+      _locals_decode_offset      = cached->_locals_decode_offset;
+      _expressions_decode_offset = cached->_expressions_decode_offset;
+      _monitors_decode_offset    = cached->_monitors_decode_offset;
+      return;
+    }
+
     // decode header
     DebugInfoReadStream* stream  = stream_at(decode_offset());
 
@@ -92,6 +106,9 @@ void ScopeDesc::decode_body() {
     _locals_decode_offset      = stream->read_int();
     _expressions_decode_offset = stream->read_int();
     _monitors_decode_offset    = stream->read_int();
+
+    cache->add(decode_offset(), _sender_decode_offset, _method, _bci,
+               _locals_decode_offset, _expressions_decode_offset, _monitors_decode_offset);
   }
 }
 
@@ -583,17 +583,27 @@ bool OopMap::equals(const OopMap* other) const {
 
 const ImmutableOopMap* ImmutableOopMapSet::find_map_at_offset(int pc_offset) const {
   ImmutableOopMapPair* pairs = get_pairs();
-  ImmutableOopMapPair* last  = NULL;
 
-  for (int i = 0; i < _count; ++i) {
-    if (pairs[i].pc_offset() >= pc_offset) {
-      last = &pairs[i];
-      break;
+  guarantee(_count > 0, "oopmap not found");
+
+  // The pairs are sorted by pc_offset (maps are added in emission
+  // order), so binary search for the first pair at or above the
+  // requested offset; this lookup runs once per compiled frame in
+  // every stack scan.
+  int lo = 0;
+  int hi = _count - 1;
+  while (lo < hi) {
+    int mid = lo + ((hi - lo) >> 1);
+    if (pairs[mid].pc_offset() < pc_offset) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
     }
   }
 
-  // Heal Coverity issue: potential index out of bounds access.
-  guarantee(last != NULL, "last may not be null");
+  ImmutableOopMapPair* last = &pairs[lo];
+
+  guarantee(last->pc_offset() >= pc_offset, "oopmap not found");
   assert(last->pc_offset() == pc_offset, "oopmap not found");
   return last->get_from(this);
 }
@@ -243,6 +243,13 @@
           "Maximum number of precleaning iteration passes")                 \
           range(0, 9)                                                       \
                                                                             \
+  product(size_t, CMSPrecleanBatchCards, 4096,                              \
+          "Maximum number of dirty cards claimed and scanned as a single "  \
+          "precleaning batch. The effective batch size adapts down when "   \
+          "abortable preclean batches are cut short, and recovers as "      \
+          "batches complete. 0 means batches are unbounded.")               \
+          range(0, SIZE_MAX / 4096)                                         \
+                                                                            \
   product(uintx, CMSPrecleanDenominator, 3,                                 \
           "CMSPrecleanNumerator:CMSPrecleanDenominator yields convergence " \
           "ratio")                                                          \
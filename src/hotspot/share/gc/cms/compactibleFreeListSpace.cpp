@@ -48,6 +48,7 @@
 #include "runtime/init.hpp"
 #include "runtime/java.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "runtime/vmThread.hpp"
 #include "utilities/align.hpp"
 #include "utilities/copy.hpp"
@@ -1113,6 +1114,9 @@ CompactibleFreeListSpace::object_iterate_careful_m(MemRegion mr,
   size_t size;
   for (addr = block_start_careful(mr.start()), end  = mr.end();
        addr < end; addr += size) {
+    // Prefetch beyond addr; the closure below reads the block header and,
+    // for live objects, scans the object's fields.
+    Prefetch::read(addr, PrefetchScanIntervalInBytes);
     FreeChunk* fc = (FreeChunk*)addr;
     if (fc->is_free()) {
       // Since we hold the free list lock, which protects direct
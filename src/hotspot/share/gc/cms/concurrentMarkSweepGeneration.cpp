@@ -494,6 +494,7 @@ CMSCollector::CMSCollector(ConcurrentMarkSweepGeneration* cmsGen,
   _between_prologue_and_epilogue(false),
   _abort_preclean(false),
   _start_sampling(false),
+  _preclean_batch_cards(CMSPrecleanBatchCards),
   _stats(cmsGen),
   _eden_chunk_lock(new Mutex(Mutex::leaf + 1, "CMS_eden_chunk_lock", true,
                              //verify that this lock should be acquired with safepoint check.
@@ -3936,6 +3937,39 @@ size_t CMSCollector::preclean_work(bool clean_refs, bool clean_survivor) {
 // the CMS collector on the one hand, and the VM thread and the
 // mutators on the other.
 
+// The minimum batch size we adapt down to when abortable preclean keeps
+// getting cut short mid-batch.
+static const size_t preclean_batch_cards_floor = 64;
+
+HeapWord* CMSCollector::preclean_batch_end(HeapWord* next_addr, HeapWord* end_addr) const {
+  if (_preclean_batch_cards == 0) {
+    return end_addr;
+  }
+  size_t batch_words = _preclean_batch_cards * CardTable::card_size_in_words;
+  if (pointer_delta(end_addr, next_addr) <= batch_words) {
+    return end_addr;
+  }
+  return next_addr + batch_words;
+}
+
+void CMSCollector::reduce_preclean_batch() {
+  // An abortable preclean batch was cut short; everything between the stop
+  // point and the batch end was redirtied and will be rescanned. Claim
+  // smaller batches to reduce the amount of wasted work next time.
+  if (_preclean_batch_cards > 0) {
+    _preclean_batch_cards = MAX2(_preclean_batch_cards / 2, preclean_batch_cards_floor);
+  }
+}
+
+void CMSCollector::grow_preclean_batch() {
+  // The batch completed without aborting; gradually recover towards the
+  // configured maximum.
+  if (_preclean_batch_cards > 0 && _preclean_batch_cards < CMSPrecleanBatchCards) {
+    _preclean_batch_cards = MIN2(_preclean_batch_cards + _preclean_batch_cards / 8 + 1,
+                                 CMSPrecleanBatchCards);
+  }
+}
+
 // NOTE: preclean_mod_union_table() and preclean_card_table()
 // further below are largely identical; if you need to modify
 // one of these methods, please check the other method too.
@@ -3971,6 +4005,10 @@ size_t CMSCollector::preclean_mod_union_table(
     ResourceMark rm;
     HandleMark   hm;
 
+    // Cap the range claimed in this iteration, so that an abort does not
+    // redirty (and later rescan) an arbitrarily large claimed region.
+    HeapWord* batchEnd = preclean_batch_end(nextAddr, endAddr);
+
     MemRegion dirtyRegion;
     {
       stopTimer();
@@ -3981,7 +4019,7 @@ size_t CMSCollector::preclean_mod_union_table(
       // Get dirty region starting at nextOffset (inclusive),
       // simultaneously clearing it.
       dirtyRegion =
-        _modUnionTable.getAndClearMarkedRegion(nextAddr, endAddr);
+        _modUnionTable.getAndClearMarkedRegion(nextAddr, batchEnd);
       assert(dirtyRegion.start() >= nextAddr,
              "returned region inconsistent?");
     }
@@ -4022,17 +4060,24 @@ size_t CMSCollector::preclean_mod_union_table(
                "Should only be AbortablePreclean.");
         _modUnionTable.mark_range(MemRegion(stop_point, dirtyRegion.end()));
         if (should_abort_preclean()) {
+          reduce_preclean_batch();
           break; // out of preclean loop
         } else {
           // Compute the next address at which preclean should pick up;
           // might need bitMapLock in order to read P-bits.
           lastAddr = next_card_start_after_block(stop_point);
         }
+      } else {
+        grow_preclean_batch();
       }
     } else {
-      assert(lastAddr == endAddr, "consistency check");
+      assert(lastAddr == batchEnd, "consistency check");
       assert(numDirtyCards == 0, "consistency check");
-      break;
+      if (batchEnd == endAddr) {
+        break;
+      }
+      // No dirty cards in this batch; move on to the next one.
+      lastAddr = batchEnd;
     }
   }
   verify_work_stacks_empty();
@@ -4065,6 +4110,10 @@ size_t CMSCollector::preclean_card_table(ConcurrentMarkSweepGeneration* old_gen,
     ResourceMark rm;
     HandleMark   hm;
 
+    // Cap the range claimed in this iteration, so that an abort does not
+    // invalidate (and later rescan) an arbitrarily large claimed region.
+    HeapWord* batchEnd = preclean_batch_end(nextAddr, endAddr);
+
     MemRegion dirtyRegion;
     {
       // See comments in "Precleaning notes" above on why we
@@ -4075,7 +4124,7 @@ size_t CMSCollector::preclean_card_table(ConcurrentMarkSweepGeneration* old_gen,
       startTimer();
       sample_eden();
       // Get and clear dirty region from card table
-      dirtyRegion = _ct->dirty_card_range_after_reset(MemRegion(nextAddr, endAddr),
+      dirtyRegion = _ct->dirty_card_range_after_reset(MemRegion(nextAddr, batchEnd),
                                                       true,
                                                       CardTable::precleaned_card_val());
 
@@ -4100,14 +4149,21 @@ size_t CMSCollector::preclean_card_table(ConcurrentMarkSweepGeneration* old_gen,
                "Should only be AbortablePreclean.");
         _ct->invalidate(MemRegion(stop_point, dirtyRegion.end()));
         if (should_abort_preclean()) {
+          reduce_preclean_batch();
           break; // out of preclean loop
         } else {
           // Compute the next address at which preclean should pick up.
           lastAddr = next_card_start_after_block(stop_point);
         }
+      } else {
+        grow_preclean_batch();
       }
     } else {
-      break;
+      if (batchEnd == endAddr) {
+        break;
+      }
+      // No dirty cards in this batch; move on to the next one.
+      lastAddr = batchEnd;
     }
   }
   verify_work_stacks_empty();
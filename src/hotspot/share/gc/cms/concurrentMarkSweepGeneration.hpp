@@ -685,6 +685,10 @@ class CMSCollector: public CHeapObj<mtGC> {
   bool _abort_preclean;
   bool _start_sampling;
 
+  // Current precleaning batch size in cards; adapts between a small floor
+  // and CMSPrecleanBatchCards based on abortable preclean aborts.
+  size_t _preclean_batch_cards;
+
   int    _numYields;
   size_t _numDirtyCards;
   size_t _sweep_count;
@@ -767,6 +771,11 @@ class CMSCollector: public CHeapObj<mtGC> {
                                   ScanMarkedObjectsAgainCarefullyClosure* cl);
   size_t preclean_card_table(ConcurrentMarkSweepGeneration* old_gen,
                              ScanMarkedObjectsAgainCarefullyClosure* cl);
+  // Batched precleaning support: cap on the dirty-card range claimed in
+  // one iteration, adapted from abortable preclean abort behavior.
+  HeapWord* preclean_batch_end(HeapWord* next_addr, HeapWord* end_addr) const;
+  void reduce_preclean_batch();
+  void grow_preclean_batch();
   // Does precleaning work, returning a quantity indicative of
   // the amount of "useful work" done.
   size_t preclean_work(bool clean_refs, bool clean_survivors);
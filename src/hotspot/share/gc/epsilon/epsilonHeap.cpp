@@ -28,9 +28,12 @@
 #include "gc/shared/gcArguments.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/padded.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/orderAccess.hpp"
 
 jint EpsilonHeap::initialize() {
   size_t align = HeapAlignment;
@@ -55,6 +58,23 @@ jint EpsilonHeap::initialize() {
   _step_heap_print = (EpsilonPrintHeapSteps == 0) ? SIZE_MAX : (max_byte_size / EpsilonPrintHeapSteps);
   _decay_time_ns = (int64_t) EpsilonTLABDecayTime * NANOSECS_PER_MILLISEC;
 
+  // Set up striped allocation
+  _stripes = NULL;
+  _num_stripes = 0;
+  _stripe_chunk_size = 0;
+  _next_stripe_id = 0;
+  if (EpsilonAllocationStripes >= 2) {
+    _num_stripes = 1u << log2_uint((uint)EpsilonAllocationStripes);
+    _stripe_chunk_size = 8 * _max_tlab_size;
+    _stripes = PaddedArray<AllocStripe, mtGC>::create_unfreeable(_num_stripes);
+    for (uint i = 0; i < _num_stripes; i++) {
+      // Start with a zero-capacity region, so that the first allocation
+      // refills the stripe (a NULL _top means a refill is in progress).
+      _stripes[i]._top = _space->bottom();
+      _stripes[i]._end = _space->bottom();
+    }
+  }
+
   // Enable monitoring
   _monitoring_support = new EpsilonMonitoringSupport(this);
   _last_counter_update = 0;
@@ -83,6 +103,11 @@ jint EpsilonHeap::initialize() {
     log_info(gc)("Not using TLAB allocation");
   }
 
+  if (_stripes != NULL) {
+    log_info(gc)("Striped allocation enabled; stripes: %u, chunk: " SIZE_FORMAT "K",
+                 _num_stripes, _stripe_chunk_size * HeapWordSize / K);
+  }
+
   return JNI_OK;
 }
 
@@ -120,10 +145,88 @@ EpsilonHeap* EpsilonHeap::heap() {
   return (EpsilonHeap*)heap;
 }
 
+HeapWord* EpsilonHeap::allocate_striped(size_t size) {
+  Thread* thread = Thread::current();
+  int id = EpsilonThreadLocalData::stripe_id(thread);
+  if (id < 0) {
+    // Assign stripes to threads round-robin on first use.
+    id = (int)(Atomic::add(1u, &_next_stripe_id) % _num_stripes);
+    EpsilonThreadLocalData::set_stripe_id(thread, id);
+  }
+  AllocStripe* stripe = &_stripes[id];
+
+  while (true) {
+    HeapWord* top = OrderAccess::load_acquire(&stripe->_top);
+    if (top == NULL) {
+      // Another thread is refilling this stripe. Do not wait for it;
+      // contend on the shared space cursor this one time instead.
+      return _space->par_allocate(size);
+    }
+
+    // Never allocate a chunk completely, so that the tail can always be
+    // filled with a dummy object when the stripe moves to the next chunk.
+    if (pointer_delta(stripe->_end, top) >= size + CollectedHeap::min_fill_size()) {
+      HeapWord* new_top = top + size;
+      if (Atomic::cmpxchg(new_top, &stripe->_top, top) == top) {
+        return top;
+      }
+      continue;
+    }
+
+    // Stripe is exhausted. Claim the refill by parking the cursor;
+    // concurrent allocations use the shared space cursor meanwhile.
+    if (Atomic::cmpxchg((HeapWord*)NULL, &stripe->_top, top) != top) {
+      continue;
+    }
+
+    HeapWord* chunk = _space->par_allocate(_stripe_chunk_size);
+    if (chunk == NULL) {
+      // No space for a full chunk. Unpark the cursor unchanged and let
+      // the caller expand the heap and use the shared space cursor.
+      OrderAccess::release_store(&stripe->_top, top);
+      return NULL;
+    }
+
+    // Fill the tail of the previous chunk to keep the space parseable.
+    if (top < stripe->_end) {
+      fill_with_objects(top, pointer_delta(stripe->_end, top));
+    }
+
+    // Serve the current allocation from the front of the new chunk and
+    // publish the remainder. The store to _end must be visible before the
+    // cursor is released.
+    stripe->_end = chunk + _stripe_chunk_size;
+    OrderAccess::release_store(&stripe->_top, chunk + size);
+    return chunk;
+  }
+}
+
+void EpsilonHeap::flush_stripes() {
+  if (_stripes == NULL) {
+    return;
+  }
+  assert(SafepointSynchronize::is_at_safepoint(), "Only at safepoint");
+  for (uint i = 0; i < _num_stripes; i++) {
+    AllocStripe* stripe = &_stripes[i];
+    assert(stripe->_top != NULL, "Stripe refill in progress at safepoint");
+    HeapWord* top = stripe->_top;
+    if (top < stripe->_end) {
+      fill_with_objects(top, pointer_delta(stripe->_end, top));
+    }
+    stripe->_top = _space->bottom();
+    stripe->_end = _space->bottom();
+  }
+}
+
 HeapWord* EpsilonHeap::allocate_work(size_t size) {
   assert(is_object_aligned(size), "Allocation size should be aligned: " SIZE_FORMAT, size);
 
-  HeapWord* res = _space->par_allocate(size);
+  HeapWord* res = NULL;
+  if (_stripes != NULL && (size + CollectedHeap::min_fill_size()) * 4 <= _stripe_chunk_size) {
+    res = allocate_striped(size);
+  } else {
+    res = _space->par_allocate(size);
+  }
 
   while (res == NULL) {
     // Allocation failed, attempt expansion, and retry:
@@ -152,7 +255,9 @@ HeapWord* EpsilonHeap::allocate_work(size_t size) {
 
   size_t used = _space->used();
 
-  // Allocation successful, update counters
+  // Allocation successful, update counters. The sampled occupancy counter
+  // is cheap (a plain store) and is therefore updated on every allocation.
+  _monitoring_support->update_sampled_used(used);
   {
     size_t last = _last_counter_update;
     if ((used - last >= _step_counter_update) && Atomic::cmpxchg(used, &_last_counter_update, last) == last) {
@@ -290,6 +395,9 @@ void EpsilonHeap::do_full_collection(bool clear_all_soft_refs) {
 }
 
 void EpsilonHeap::safe_object_iterate(ObjectClosure *cl) {
+  // Fill the unused stripe tails first, so that the walk below observes
+  // a contiguous run of parseable objects.
+  flush_stripes();
   _space->safe_object_iterate(cl);
 }
 
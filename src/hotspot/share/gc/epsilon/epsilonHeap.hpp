@@ -29,6 +29,7 @@
 #include "gc/shared/space.hpp"
 #include "gc/epsilon/epsilonMonitoringSupport.hpp"
 #include "gc/epsilon/epsilonBarrierSet.hpp"
+#include "memory/padded.hpp"
 #include "services/memoryManager.hpp"
 
 class EpsilonHeap : public CollectedHeap {
@@ -47,6 +48,27 @@ private:
   volatile size_t _last_counter_update;
   volatile size_t _last_heap_print;
 
+  // Striped allocation: threads bump private per-stripe cursors and only
+  // touch the shared space cursor to refill a stripe with a multi-TLAB
+  // chunk, taking the contention off the refill fast path.
+  struct AllocStripe {
+    // Allocation cursor. NULL while a stripe refill is in progress, in
+    // which case allocations fall back to the shared space cursor.
+    HeapWord* volatile _top;
+    // End of the current chunk. Only changes while _top is NULL.
+    HeapWord*          _end;
+  };
+
+  PaddedEnd<AllocStripe>* _stripes;
+  uint _num_stripes;
+  size_t _stripe_chunk_size;
+  volatile uint _next_stripe_id;
+
+  HeapWord* allocate_striped(size_t size);
+  // Fills the unused stripe tails and resets the stripes, keeping the
+  // space parseable. Called at safepoints before heap walks.
+  void flush_stripes();
+
 public:
   static EpsilonHeap* heap();
 
@@ -29,6 +29,7 @@
 #include "memory/allocation.inline.hpp"
 #include "memory/metaspaceCounters.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/perfData.hpp"
 #include "services/memoryService.hpp"
 
 class EpsilonSpaceCounters: public CHeapObj<mtGC> {
@@ -100,6 +101,19 @@ public:
 EpsilonMonitoringSupport::EpsilonMonitoringSupport(EpsilonHeap* heap) {
   _heap_counters  = new EpsilonGenerationCounters(heap);
   _space_counters = new EpsilonSpaceCounters("Heap", 0, heap->max_capacity(), 0, _heap_counters);
+
+  _sampled_used = NULL;
+  if (UsePerfData) {
+    EXCEPTION_MARK;
+    _sampled_used = PerfDataManager::create_variable(SUN_GC, "epsilon.sampledUsed",
+                                                     PerfData::U_Bytes, (jlong) 0, CHECK);
+  }
+}
+
+void EpsilonMonitoringSupport::update_sampled_used(size_t used) {
+  if (_sampled_used != NULL) {
+    _sampled_used->set_value((jlong) used);
+  }
 }
 
 void EpsilonMonitoringSupport::update_counters() {
@@ -29,15 +29,22 @@
 class GenerationCounters;
 class EpsilonSpaceCounters;
 class EpsilonHeap;
+class PerfVariable;
 
 class EpsilonMonitoringSupport : public CHeapObj<mtGC> {
 private:
   GenerationCounters*   _heap_counters;
   EpsilonSpaceCounters* _space_counters;
+  PerfVariable*         _sampled_used;
 
 public:
   EpsilonMonitoringSupport(EpsilonHeap* heap);
   void update_counters();
+
+  // Updates the lightweight occupancy counter with a plain store, so the
+  // allocation path can afford to call this on every allocation and
+  // external monitors can sample the value at high rates via perfdata.
+  void update_sampled_used(size_t used);
 };
 
 #endif // SHARE_GC_EPSILON_EPSILONMONITORINGSUPPORT_HPP
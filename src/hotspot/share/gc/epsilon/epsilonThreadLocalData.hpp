@@ -31,10 +31,12 @@ class EpsilonThreadLocalData {
 private:
   size_t _ergo_tlab_size;
   int64_t _last_tlab_time;
+  int _stripe_id;
 
   EpsilonThreadLocalData() :
           _ergo_tlab_size(0),
-          _last_tlab_time(0) {}
+          _last_tlab_time(0),
+          _stripe_id(-1) {}
 
   static EpsilonThreadLocalData* data(Thread* thread) {
     assert(UseEpsilonGC, "Sanity");
@@ -65,6 +67,14 @@ public:
   static void set_last_tlab_time(Thread *thread, int64_t time) {
     data(thread)->_last_tlab_time = time;
   }
+
+  static int stripe_id(Thread *thread) {
+    return data(thread)->_stripe_id;
+  }
+
+  static void set_stripe_id(Thread *thread, int id) {
+    data(thread)->_stripe_id = id;
+  }
 };
 
 #endif // SHARE_GC_EPSILON_EPSILONTHREADLOCALDATA_HPP
@@ -92,6 +92,14 @@
   experimental(size_t, EpsilonMinHeapExpand, 128 * M,                       \
           "Min expansion step for heap. Larger value improves performance " \
           "at the potential expense of memory waste.")                      \
-          range(1, max_intx)
+          range(1, max_intx)                                                \
+                                                                            \
+  experimental(uintx, EpsilonAllocationStripes, 4,                          \
+          "Number of striped allocation regions to carve refills from. "    \
+          "Each stripe has a private allocation cursor, which reduces "     \
+          "contention on the shared space cursor when many threads "        \
+          "allocate at once. Values are rounded down to a power of two. "   \
+          "0 disables striping.")                                           \
+          range(0, 1024)
 
 #endif // SHARE_GC_EPSILON_EPSILON_GLOBALS_HPP
@@ -38,6 +38,7 @@
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/thread.inline.hpp"
+#include "utilities/align.hpp"
 #include "utilities/macros.hpp"
 #ifdef COMPILER1
 #include "gc/g1/c1/g1BarrierSetC1.hpp"
@@ -117,13 +118,24 @@ void G1BarrierSet::invalidate(MemRegion mr) {
     // Enqueue if necessary.
     Thread* thr = Thread::current();
     G1DirtyCardQueue& queue = G1ThreadLocalData::dirty_card_queue(thr);
-    for (; byte <= last_byte; byte++) {
+    // Bulk invalidations mostly revisit card ranges that are already
+    // dirty, so skip over aligned groups of eight all-dirty cards with
+    // a single word-sized load instead of checking them byte by byte.
+    const size_t dirty_word_pattern = (~(size_t)0 / 0xff) * G1CardTable::dirty_card_val();
+    while (byte <= last_byte) {
+      if (is_aligned(byte, sizeof(size_t)) &&
+          byte + sizeof(size_t) - 1 <= last_byte &&
+          *(volatile size_t*)byte == dirty_word_pattern) {
+        byte += sizeof(size_t);
+        continue;
+      }
       CardValue bv = *byte;
       if ((bv != G1CardTable::g1_young_card_val()) &&
           (bv != G1CardTable::dirty_card_val())) {
         *byte = G1CardTable::dirty_card_val();
         queue.enqueue(byte);
       }
+      byte++;
     }
   }
 }
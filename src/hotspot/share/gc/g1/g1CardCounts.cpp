@@ -109,6 +109,16 @@ bool G1CardCounts::is_hot(uint count) {
   return (count >= G1ConcRSHotCardLimit);
 }
 
+void G1CardCounts::decay_card_count(CardValue* card_ptr) {
+  if (has_count_table()) {
+    size_t card_num = ptr_2_card_num(card_ptr);
+    assert(card_num < _reserved_max_card_num,
+           "Card " SIZE_FORMAT " outside of card counts table (max size " SIZE_FORMAT ")",
+           card_num, _reserved_max_card_num);
+    _card_counts[card_num] = (jubyte)(_card_counts[card_num] >> 1);
+  }
+}
+
 void G1CardCounts::clear_region(HeapRegion* hr) {
   MemRegion mr(hr->bottom(), hr->end());
   clear_range(mr);
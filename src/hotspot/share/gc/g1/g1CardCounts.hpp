@@ -122,6 +122,12 @@ private:
   // 'hot'; false otherwise.
   bool is_hot(uint count);
 
+  // Halves the refinement count for the given card. Applied when a card
+  // is evicted from the hot card cache, so that a card has to stay hot
+  // across several refinement intervals to be retained preferentially
+  // over cards that were only hot during a burst.
+  void decay_card_count(CardValue* card_ptr);
+
   // Clears the card counts for the cards spanned by the region
   void clear_region(HeapRegion* hr);
 
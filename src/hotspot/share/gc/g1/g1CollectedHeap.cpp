@@ -322,6 +322,19 @@ size_t G1CollectedHeap::humongous_obj_size_in_regions(size_t word_size) {
   return align_up(word_size, HeapRegion::GrainWords) / HeapRegion::GrainWords;
 }
 
+oop G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
+  assert(obj != NULL, "precondition");
+  assert(is_in(obj), "Object " PTR_FORMAT " must be in the heap", p2i(obj));
+  heap_region_containing(obj)->increment_pinned_count();
+  return obj;
+}
+
+void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
+  assert(obj != NULL, "precondition");
+  assert(is_in(obj), "Object " PTR_FORMAT " must be in the heap", p2i(obj));
+  heap_region_containing(obj)->decrement_pinned_count();
+}
+
 // If could fit into free regions w/o expansion, try.
 // Otherwise, if can expand, do so.
 // Otherwise, if using ex regions might help, try with ex given back.
@@ -1382,6 +1395,10 @@ bool G1CollectedHeap::expand(size_t expand_bytes, WorkGang* pretouch_workers, do
 }
 
 void G1CollectedHeap::shrink_helper(size_t shrink_bytes) {
+  // Include shrink work deferred from earlier pauses because of the
+  // uncommit time budget.
+  shrink_bytes += _deferred_shrink_bytes;
+
   size_t aligned_shrink_bytes =
     ReservedSpace::page_align_size_down(shrink_bytes);
   aligned_shrink_bytes = align_down(aligned_shrink_bytes,
@@ -1391,9 +1408,18 @@ void G1CollectedHeap::shrink_helper(size_t shrink_bytes) {
   uint num_regions_removed = _hrm->shrink_by(num_regions_to_remove);
   size_t shrunk_bytes = num_regions_removed * HeapRegion::GrainBytes;
 
+  if (num_regions_removed < num_regions_to_remove) {
+    // Ran out of either empty regions or uncommit time budget. Empty
+    // regions will not re-appear without another shrink request, so only
+    // carry over the budget-limited portion.
+    uint num_budget_limited = _hrm->last_shrink_budget_limited_regions();
+    _deferred_shrink_bytes = (size_t)num_budget_limited * HeapRegion::GrainBytes;
+  } else {
+    _deferred_shrink_bytes = 0;
+  }
 
-  log_debug(gc, ergo, heap)("Shrink the heap. requested shrinking amount: " SIZE_FORMAT "B aligned shrinking amount: " SIZE_FORMAT "B attempted shrinking amount: " SIZE_FORMAT "B",
-                            shrink_bytes, aligned_shrink_bytes, shrunk_bytes);
+  log_debug(gc, ergo, heap)("Shrink the heap. requested shrinking amount: " SIZE_FORMAT "B aligned shrinking amount: " SIZE_FORMAT "B attempted shrinking amount: " SIZE_FORMAT "B deferred shrinking amount: " SIZE_FORMAT "B",
+                            shrink_bytes, aligned_shrink_bytes, shrunk_bytes, _deferred_shrink_bytes);
   if (num_regions_removed > 0) {
     policy()->record_new_heap_size(num_regions());
   } else {
@@ -1497,6 +1523,7 @@ G1CollectedHeap::G1CollectedHeap() :
   _allocator(NULL),
   _verifier(NULL),
   _summary_bytes_used(0),
+  _deferred_shrink_bytes(0),
   _archive_allocator(NULL),
   _survivor_evac_stats("Young", YoungPLABSize, PLABWeight),
   _old_evac_stats("Old", OldPLABSize, PLABWeight),
@@ -1896,8 +1923,10 @@ void G1CollectedHeap::ref_processing_init() {
   //     discovered lists.
   //
   // * For the STW processor:
-  //   * Non MT discovery is enabled at the start of a full GC.
-  //   * Processing and enqueueing during a full GC is non-MT.
+  //   * MT discovery is enabled at the start of a full GC, so each
+  //     marking worker discovers onto its own list.
+  //   * Processing during a full GC uses the full GC work gang when
+  //     it has more than one worker.
   //   * During a full GC, references are processed after marking.
   //
   //   * Discovery (may or may not be MT) is enabled at the start
@@ -2220,6 +2249,30 @@ void G1CollectedHeap::object_iterate(ObjectClosure* cl) {
   heap_region_iterate(&blk);
 }
 
+class G1ParallelObjectIterator : public ParallelObjectIterator {
+private:
+  G1CollectedHeap*  _heap;
+  HeapRegionClaimer _claimer;
+
+public:
+  G1ParallelObjectIterator(uint thread_num) :
+      _heap(G1CollectedHeap::heap()),
+      _claimer(thread_num) {}
+
+  virtual void object_iterate(ObjectClosure* cl, uint worker_id) {
+    _heap->object_iterate_parallel(cl, worker_id, &_claimer);
+  }
+};
+
+ParallelObjectIterator* G1CollectedHeap::parallel_object_iterator(uint thread_num) {
+  return new G1ParallelObjectIterator(thread_num);
+}
+
+void G1CollectedHeap::object_iterate_parallel(ObjectClosure* cl, uint worker_id, HeapRegionClaimer* claimer) {
+  IterateObjectClosureRegionClosure blk(cl);
+  heap_region_par_iterate_from_worker_offset(&blk, claimer, worker_id);
+}
+
 void G1CollectedHeap::heap_region_iterate(HeapRegionClosure* cl) const {
   _hrm->iterate(cl);
 }
@@ -2235,6 +2288,12 @@ void G1CollectedHeap::heap_region_par_iterate_from_start(HeapRegionClosure* cl,
   _hrm->par_iterate(cl, hrclaimer, 0);
 }
 
+void G1CollectedHeap::heap_region_par_iterate_from_region_offset(HeapRegionClosure* cl,
+                                                                 HeapRegionClaimer *hrclaimer,
+                                                                 uint offset) const {
+  _hrm->par_iterate(cl, hrclaimer, offset);
+}
+
 void G1CollectedHeap::collection_set_iterate_all(HeapRegionClosure* cl) {
   _collection_set.iterate(cl);
 }
@@ -2649,6 +2708,11 @@ class RegisterRegionsWithRegionAttrTableClosure : public HeapRegionClosure {
     if (!region->rem_set()->is_complete()) {
       return false;
     }
+    // A pinned object may be referenced from native code and look dead to
+    // the GC, so it must never be eagerly reclaimed.
+    if (region->has_pinned_objects()) {
+      return false;
+    }
     // Candidate selection must satisfy the following constraints
     // while concurrent marking is in progress:
     //
@@ -4494,51 +4558,82 @@ void G1CollectedHeap::set_used(size_t bytes) {
   _summary_bytes_used = bytes;
 }
 
-class RebuildRegionSetsClosure : public HeapRegionClosure {
-private:
-  bool _free_list_only;
+class G1RebuildRegionSetsTask : public AbstractGangTask {
+  class RebuildRegionSetsClosure : public HeapRegionClosure {
+    bool _free_list_only;
 
-  HeapRegionSet* _old_set;
-  HeapRegionManager* _hrm;
+    HeapRegionSet* _old_set;
 
-  size_t _total_used;
+    // Free regions found by this worker, merged into the master free list
+    // when the worker is done with its share of the region space.
+    FreeRegionList _local_free_list;
 
-public:
-  RebuildRegionSetsClosure(bool free_list_only,
-                           HeapRegionSet* old_set,
-                           HeapRegionManager* hrm) :
-    _free_list_only(free_list_only),
-    _old_set(old_set), _hrm(hrm), _total_used(0) {
-    assert(_hrm->num_free_regions() == 0, "pre-condition");
-    if (!free_list_only) {
-      assert(_old_set->is_empty(), "pre-condition");
-    }
-  }
+    size_t _total_used;
 
-  bool do_heap_region(HeapRegion* r) {
-    if (r->is_empty()) {
-      assert(r->rem_set()->is_empty(), "Empty regions should have empty remembered sets.");
-      // Add free regions to the free list
-      r->set_free();
-      _hrm->insert_into_free_list(r);
-    } else if (!_free_list_only) {
-      assert(r->rem_set()->is_empty(), "At this point remembered sets must have been cleared.");
-
-      if (r->is_archive() || r->is_humongous()) {
-        // We ignore archive and humongous regions. We left these sets unchanged.
-      } else {
-        assert(r->is_young() || r->is_free() || r->is_old(), "invariant");
-        // We now move all (non-humongous, non-old, non-archive) regions to old gen, and register them as such.
-        r->move_to_old();
-        _old_set->add(r);
+  public:
+    RebuildRegionSetsClosure(bool free_list_only,
+                             HeapRegionSet* old_set) :
+      _free_list_only(free_list_only),
+      _old_set(old_set),
+      _local_free_list("Local Free List for G1RebuildRegionSetsTask"),
+      _total_used(0) { }
+
+    bool do_heap_region(HeapRegion* r) {
+      if (r->is_empty()) {
+        assert(r->rem_set()->is_empty(), "Empty regions should have empty remembered sets.");
+        // Add free regions to the local free list.
+        r->set_free();
+        _local_free_list.add_ordered(r);
+      } else if (!_free_list_only) {
+        assert(r->rem_set()->is_empty(), "At this point remembered sets must have been cleared.");
+
+        if (r->is_archive() || r->is_humongous()) {
+          // We ignore archive and humongous regions. We left these sets unchanged.
+        } else {
+          assert(r->is_young() || r->is_free() || r->is_old(), "invariant");
+          // We now move all (non-humongous, non-old, non-archive) regions to old gen, and register them as such.
+          r->move_to_old();
+          MutexLocker x(OldSets_lock, Mutex::_no_safepoint_check_flag);
+          _old_set->add(r);
+        }
+        _total_used += r->used();
       }
-      _total_used += r->used();
+
+      return false;
     }
 
-    return false;
+    void complete_work() {
+      G1CollectedHeap::heap()->prepend_to_freelist(&_local_free_list);
+    }
+
+    size_t total_used() const {
+      return _total_used;
+    }
+  };
+
+  bool _free_list_only;
+  HeapRegionSet* _old_set;
+  HeapRegionClaimer _hr_claimer;
+  volatile size_t _total_used;
+
+public:
+  G1RebuildRegionSetsTask(bool free_list_only,
+                          HeapRegionSet* old_set,
+                          uint num_workers) :
+    AbstractGangTask("G1 Rebuild Region Sets"),
+    _free_list_only(free_list_only),
+    _old_set(old_set),
+    _hr_claimer(num_workers),
+    _total_used(0) { }
+
+  void work(uint worker_id) {
+    RebuildRegionSetsClosure cl(_free_list_only, _old_set);
+    G1CollectedHeap::heap()->heap_region_par_iterate_from_worker_offset(&cl, &_hr_claimer, worker_id);
+    cl.complete_work();
+    Atomic::add(cl.total_used(), &_total_used);
   }
 
-  size_t total_used() {
+  size_t total_used() const {
     return _total_used;
   }
 };
@@ -4546,16 +4641,22 @@ public:
 void G1CollectedHeap::rebuild_region_sets(bool free_list_only) {
   assert_at_safepoint_on_vm_thread();
 
+  assert(_hrm->num_free_regions() == 0, "pre-condition");
   if (!free_list_only) {
+    assert(_old_set.is_empty(), "pre-condition");
     _eden.clear();
     _survivor.clear();
   }
 
-  RebuildRegionSetsClosure cl(free_list_only, &_old_set, _hrm);
-  heap_region_iterate(&cl);
+  // Rebuilding the region sets is dominated by walking the region space;
+  // on large heaps doing this serially is a significant part of the
+  // post-compaction pause, so spread it over the worker gang.
+  uint num_workers = workers()->active_workers();
+  G1RebuildRegionSetsTask task(free_list_only, &_old_set, num_workers);
+  workers()->run_task(&task, num_workers);
 
   if (!free_list_only) {
-    set_used(cl.total_used());
+    set_used(task.total_used());
     if (_archive_allocator != NULL) {
       _archive_allocator->clear_used();
     }
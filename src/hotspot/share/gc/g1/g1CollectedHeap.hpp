@@ -205,6 +205,10 @@ private:
   // than the current allocation region(s).
   volatile size_t _summary_bytes_used;
 
+  // Shrink work that could not be performed within the uncommit pause
+  // time budget; retried at the next shrink opportunity.
+  size_t _deferred_shrink_bytes;
+
   void increase_used(size_t bytes);
   void decrease_used(size_t bytes);
 
@@ -1140,6 +1144,12 @@ public:
   // Iterate over all objects, calling "cl.do_object" on each.
   virtual void object_iterate(ObjectClosure* cl);
 
+  virtual ParallelObjectIterator* parallel_object_iterator(uint thread_num);
+
+  // Iterate over the objects in the regions claimed from hrclaimer for the
+  // given worker; used by G1ParallelObjectIterator.
+  void object_iterate_parallel(ObjectClosure* cl, uint worker_id, HeapRegionClaimer* claimer);
+
   virtual void safe_object_iterate(ObjectClosure* cl) {
     object_iterate(cl);
   }
@@ -1175,6 +1185,11 @@ public:
   void heap_region_par_iterate_from_start(HeapRegionClosure* cl,
                                           HeapRegionClaimer* hrclaimer) const;
 
+  // As above, but starting the claiming at the given region offset.
+  void heap_region_par_iterate_from_region_offset(HeapRegionClosure* cl,
+                                                  HeapRegionClaimer* hrclaimer,
+                                                  uint offset) const;
+
   // Iterate over all regions currently in the current collection set.
   void collection_set_iterate_all(HeapRegionClosure* blk);
 
@@ -1242,6 +1257,18 @@ public:
   // requires.
   static size_t humongous_obj_size_in_regions(size_t word_size);
 
+  // Object pinning support. While an object is pinned the region containing
+  // it is excluded from collection set candidate selection and from eager
+  // reclaim, is treated as an evacuation failure if it is already in the
+  // collection set, and is skipped by full GC compaction, so the object is
+  // never relocated. Pins nest; a region becomes eligible for evacuation
+  // again once all pins on objects in it have been released. Used by JNI
+  // critical regions instead of the GCLocker, so a critical section pins
+  // one region instead of blocking all collection.
+  virtual bool supports_object_pinning() const { return true; }
+  virtual oop pin_object(JavaThread* thread, oop obj);
+  virtual void unpin_object(JavaThread* thread, oop obj);
+
   // Print the maximum heap capacity.
   virtual size_t max_capacity() const;
 
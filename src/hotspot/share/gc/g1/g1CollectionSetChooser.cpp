@@ -27,9 +27,9 @@
 #include "gc/g1/g1CollectionSetCandidates.hpp"
 #include "gc/g1/g1CollectionSetChooser.hpp"
 #include "gc/g1/heapRegionRemSet.hpp"
+#include "gc/shared/parallelSort.hpp"
 #include "gc/shared/space.inline.hpp"
 #include "runtime/atomic.hpp"
-#include "utilities/quickSort.hpp"
 
 // Order regions according to GC efficiency. This will cause regions with a lot
 // of live objects and large remembered sets to end up at the end of the array.
@@ -58,6 +58,15 @@ static int order_regions(HeapRegion* hr1, HeapRegion* hr2) {
   } if (gc_eff1 < gc_eff2) {
     return 1;
   } else {
+    // Break ties in favor of the region with the lower incoming reference
+    // density; its pause cost is less dominated by remembered set scanning.
+    double density1 = hr1->incoming_ref_density();
+    double density2 = hr2->incoming_ref_density();
+    if (density1 < density2) {
+      return -1;
+    } else if (density1 > density2) {
+      return 1;
+    }
     return 0;
   }
 }
@@ -127,14 +136,14 @@ class G1BuildCandidateRegionsTask : public AbstractGangTask {
       _data[idx] = hr;
     }
 
-    void sort_and_copy_into(HeapRegion** dest, uint num_regions) {
+    void sort_and_copy_into(HeapRegion** dest, uint num_regions, WorkGang* workers) {
       if (_cur_claim_idx == 0) {
         return;
       }
       for (uint i = _cur_claim_idx; i < _max_size; i++) {
         assert(_data[i] == NULL, "must be");
       }
-      QuickSort::sort(_data, _cur_claim_idx, order_regions, true);
+      ParallelSort::sort(workers, _data, _cur_claim_idx, order_regions, true);
       for (uint i = num_regions; i < _max_size; i++) {
         assert(_data[i] == NULL, "must be");
       }
@@ -236,9 +245,9 @@ public:
     update_totals(cl.regions_added(), cl.reclaimable_bytes_added());
   }
 
-  G1CollectionSetCandidates* get_sorted_candidates() {
+  G1CollectionSetCandidates* get_sorted_candidates(WorkGang* workers) {
     HeapRegion** regions = NEW_C_HEAP_ARRAY(HeapRegion*, _num_regions_added, mtGC);
-    _result.sort_and_copy_into(regions, _num_regions_added);
+    _result.sort_and_copy_into(regions, _num_regions_added, workers);
     return new G1CollectionSetCandidates(regions,
                                          _num_regions_added,
                                          _reclaimable_bytes_added);
@@ -253,6 +262,7 @@ uint G1CollectionSetChooser::calculate_work_chunk_size(uint num_workers, uint nu
 bool G1CollectionSetChooser::should_add(HeapRegion* hr) {
   return !hr->is_young() &&
          !hr->is_pinned() &&
+         !hr->has_pinned_objects() &&
          region_occupancy_low_enough_for_evac(hr->live_bytes()) &&
          hr->rem_set()->is_complete();
 }
@@ -264,7 +274,7 @@ G1CollectionSetCandidates* G1CollectionSetChooser::build(WorkGang* workers, uint
   G1BuildCandidateRegionsTask cl(max_num_regions, chunk_size, num_workers);
   workers->run_task(&cl, num_workers);
 
-  G1CollectionSetCandidates* result = cl.get_sorted_candidates();
+  G1CollectionSetCandidates* result = cl.get_sorted_candidates(workers);
   result->verify();
   return result;
 }
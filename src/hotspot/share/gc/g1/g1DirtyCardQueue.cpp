@@ -31,12 +31,14 @@
 #include "gc/g1/heapRegionRemSet.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/shared/workgroup.hpp"
+#include "memory/resourceArea.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/flags/flagSetting.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
+#include "utilities/quickSort.hpp"
 
 // Closure used for updating remembered sets and recording references that
 // point into the collection set while the mutator is running.
@@ -183,10 +185,92 @@ bool G1DirtyCardQueueSet::mut_process_buffer(BufferNode* node) {
 }
 
 bool G1DirtyCardQueueSet::refine_completed_buffer_concurrently(uint worker_i, size_t stop_at) {
+  if (G1CardRefinementBatchSize > 1) {
+    return refine_buffer_batch_concurrently(worker_i, stop_at);
+  }
   G1RefineCardConcurrentlyClosure cl;
   return apply_closure_to_completed_buffer(&cl, worker_i, stop_at, false);
 }
 
+static int compare_card_ptr(void* a, void* b) {
+  return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+// Claim a batch of completed buffers with a single lock acquisition, sort
+// and deduplicate their card pointers, and refine the remaining unique
+// cards.  Duplicate cards across adjacent buffers are common under
+// write-heavy workloads, and refining them repeatedly is wasted work.
+// The surviving cards are compacted back into the claimed buffers so the
+// usual partial-processing protocol (yielding to the suspendible thread
+// set mid-buffer and re-enqueueing the remainder) is unchanged.
+bool G1DirtyCardQueueSet::refine_buffer_batch_concurrently(uint worker_i, size_t stop_at) {
+  size_t num_claimed = 0;
+  BufferNode* batch = get_completed_buffers(stop_at, G1CardRefinementBatchSize, &num_claimed);
+  if (batch == NULL) {
+    return false;
+  }
+
+  if (num_claimed > 1) {
+    ResourceMark rm;
+    // Gather the active entries of all claimed buffers.
+    size_t total = 0;
+    for (BufferNode* cur = batch; cur != NULL; cur = cur->next()) {
+      total += buffer_size() - cur->index();
+    }
+    void** cards = NEW_RESOURCE_ARRAY(void*, total);
+    size_t n = 0;
+    for (BufferNode* cur = batch; cur != NULL; cur = cur->next()) {
+      void** buf = BufferNode::make_buffer_from_node(cur);
+      for (size_t i = cur->index(); i < buffer_size(); ++i) {
+        cards[n++] = buf[i];
+      }
+    }
+    assert(n == total, "invariant");
+
+    QuickSort::sort(cards, n, compare_card_ptr, false);
+    size_t unique = 0;
+    for (size_t i = 0; i < n; ++i) {
+      if (i == 0 || cards[i] != cards[i - 1]) {
+        cards[unique++] = cards[i];
+      }
+    }
+
+    // Compact the unique cards back into the buffers, front to back.
+    // Buffers emptied by deduplication end up fully consumed and are
+    // freed by the processing loop below.
+    size_t read = 0;
+    for (BufferNode* cur = batch; cur != NULL; cur = cur->next()) {
+      void** buf = BufferNode::make_buffer_from_node(cur);
+      size_t count = MIN2(unique - read, buffer_size());
+      size_t index = buffer_size() - count;
+      for (size_t i = 0; i < count; ++i) {
+        buf[index + i] = cards[read++];
+      }
+      cur->set_index(index);
+    }
+    assert(read == unique, "must have placed all unique cards");
+  }
+
+  // Process the (possibly compacted) chain buffer by buffer.
+  G1RefineCardConcurrentlyClosure cl;
+  bool interrupted = false;
+  for (BufferNode* cur = batch; cur != NULL; ) {
+    BufferNode* next = cur->next();
+    cur->set_next(NULL);
+    if (!interrupted && apply_closure_to_buffer(&cl, cur, true, worker_i)) {
+      assert_fully_consumed(cur, buffer_size());
+      deallocate_buffer(cur);
+      Atomic::inc(&_processed_buffers_rs_thread);
+    } else {
+      // Yielded mid-buffer; return this and the remaining buffers.
+      interrupted = true;
+      enqueue_completed_buffer(cur);
+    }
+    cur = next;
+  }
+  return true;
+}
+
 bool G1DirtyCardQueueSet::apply_closure_during_gc(G1CardTableEntryClosure* cl, uint worker_i) {
   assert_at_safepoint();
   return apply_closure_to_completed_buffer(cl, worker_i, 0, true);
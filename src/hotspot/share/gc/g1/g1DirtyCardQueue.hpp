@@ -107,6 +107,11 @@ class G1DirtyCardQueueSet: public PtrQueueSet {
 
   bool mut_process_buffer(BufferNode* node);
 
+  // Claim a batch of completed buffers, deduplicate their cards, and
+  // refine the remaining unique cards.  Used instead of the one-buffer
+  // path when G1CardRefinementBatchSize > 1.
+  bool refine_buffer_batch_concurrently(uint worker_i, size_t stop_at);
+
   // If the queue contains more buffers than configured here, the
   // mutator must start doing some of the concurrent refinement work,
   size_t _max_completed_buffers;
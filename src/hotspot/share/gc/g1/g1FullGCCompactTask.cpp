@@ -34,6 +34,71 @@
 #include "oops/oop.inline.hpp"
 #include "utilities/ticks.hpp"
 
+// Closure to scrub a region that was skipped by the compaction because
+// it contains pinned objects. The objects in such a region keep their
+// location, but the dead objects between them still hold stale
+// references and must not be parsed by later card scans and heap walks.
+// Overwrite the dead ranges with filler objects and update the BOT for
+// live objects and fillers alike; the latter also builds the BOT for
+// retained regions that were young at the start of the collection and
+// are moved to old by the region set rebuild.
+class G1ScrubPinnedRegionClosure : public StackObj {
+  HeapRegion* _hr;
+  HeapWord* _last_live_end;
+
+  // Fill the memory area from start to end with filler objects, and
+  // update the BOT accordingly.
+  void fill_dead_range(HeapWord* start, HeapWord* end) {
+    if (start == end) {
+      return;
+    }
+
+    size_t gap_size = pointer_delta(end, start);
+    if (gap_size >= CollectedHeap::min_fill_size()) {
+      CollectedHeap::fill_with_objects(start, gap_size);
+
+      HeapWord* end_first_obj = start + ((oop)start)->size();
+      _hr->cross_threshold(start, end_first_obj);
+      // Fill_with_objects() may have created multiple (i.e. two)
+      // objects, as the max_fill_size() is half a region.
+      // After updating the BOT for the first object, also update the
+      // BOT for the second object to make the BOT complete.
+      if (end_first_obj != end) {
+        _hr->cross_threshold(end_first_obj, end);
+#ifdef ASSERT
+        size_t size_second_obj = ((oop)end_first_obj)->size();
+        HeapWord* end_of_second_obj = end_first_obj + size_second_obj;
+        assert(end == end_of_second_obj,
+               "More than two objects were used to fill the area from " PTR_FORMAT " to " PTR_FORMAT ", "
+               "second objects size " SIZE_FORMAT " ends at " PTR_FORMAT,
+               p2i(start), p2i(end), size_second_obj, p2i(end_of_second_obj));
+#endif
+      }
+    }
+  }
+
+public:
+  G1ScrubPinnedRegionClosure(HeapRegion* hr) :
+      _hr(hr),
+      _last_live_end(hr->bottom()) { }
+
+  size_t apply(oop obj) {
+    HeapWord* obj_addr = (HeapWord*) obj;
+    size_t size = obj->size();
+    HeapWord* obj_end = obj_addr + size;
+
+    fill_dead_range(_last_live_end, obj_addr);
+    _hr->cross_threshold(obj_addr, obj_end);
+    _last_live_end = obj_end;
+
+    return size;
+  }
+
+  void scrub_remainder() {
+    fill_dead_range(_last_live_end, _hr->top());
+  }
+};
+
 class G1ResetHumongousClosure : public HeapRegionClosure {
   G1CMBitMap* _bitmap;
 
@@ -54,6 +119,17 @@ public:
         }
       }
       current->reset_during_compaction();
+    } else if (!current->is_pinned() && current->has_pinned_objects()) {
+      // Regions with pinned objects were skipped by the compaction prepare
+      // phase: their objects keep their location and mark words. Scrub the
+      // dead ranges between the live objects before the liveness
+      // information is cleared.
+      G1ScrubPinnedRegionClosure scrub(current);
+      current->apply_to_marked_objects(_bitmap, &scrub);
+      scrub.scrub_remainder();
+      _bitmap->clear_region(current);
+      current->zero_marked_bytes();
+      current->init_top_at_mark_start();
     }
     return false;
   }
@@ -49,7 +49,9 @@ bool G1FullGCPrepareTask::G1CalculatePointersClosure::do_heap_region(HeapRegion*
     } else {
       free_humongous_region(hr);
     }
-  } else if (!hr->is_pinned()) {
+  } else if (!hr->is_pinned() && !hr->has_pinned_objects()) {
+    // Regions with pinned objects are not compacted; their objects are not
+    // forwarded and keep their location, like humongous and archive regions.
     prepare_for_compaction(hr);
   }
 
@@ -36,7 +36,13 @@
 G1FullGCReferenceProcessingExecutor::G1FullGCReferenceProcessingExecutor(G1FullCollector* collector) :
     _collector(collector),
     _reference_processor(collector->reference_processor()),
-    _old_mt_degree(_reference_processor->num_queues()) {
+    _old_mt_degree(_reference_processor->num_queues()),
+    _old_mt_processing(_reference_processor->processing_is_mt()) {
+  // Marking discovers references multi-threaded, so the discovered lists are
+  // already per-worker. Always process them with the full GC work gang when it
+  // has more than one worker, independent of ParallelRefProcEnabled, so that
+  // all reference processing phases scale with the gang size.
+  _reference_processor->set_mt_processing(_collector->workers() > 1);
   if (_reference_processor->processing_is_mt()) {
     _reference_processor->set_active_mt_degree(_collector->workers());
   }
@@ -46,6 +52,7 @@ G1FullGCReferenceProcessingExecutor::~G1FullGCReferenceProcessingExecutor() {
   if (_reference_processor->processing_is_mt()) {
     _reference_processor->set_active_mt_degree(_old_mt_degree);
   }
+  _reference_processor->set_mt_processing(_old_mt_processing);
 }
 
 G1FullGCReferenceProcessingExecutor::G1RefProcTaskProxy::G1RefProcTaskProxy(ProcessTask& proc_task,
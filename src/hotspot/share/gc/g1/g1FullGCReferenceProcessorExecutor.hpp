@@ -42,6 +42,7 @@ class G1FullGCReferenceProcessingExecutor: public AbstractRefProcTaskExecutor {
   G1FullCollector*    _collector;
   ReferenceProcessor* _reference_processor;
   uint                _old_mt_degree;
+  bool                _old_mt_processing;
 
 public:
   G1FullGCReferenceProcessingExecutor(G1FullCollector* collector);
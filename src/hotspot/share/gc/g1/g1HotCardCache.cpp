@@ -23,14 +23,17 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/g1/g1Analytics.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1DirtyCardQueue.hpp"
 #include "gc/g1/g1HotCardCache.hpp"
+#include "gc/g1/g1Policy.hpp"
 #include "runtime/atomic.hpp"
 
 G1HotCardCache::G1HotCardCache(G1CollectedHeap *g1h):
   _g1h(g1h), _use_cache(false), _card_counts(g1h),
-  _hot_cache(NULL), _hot_cache_size(0), _hot_cache_par_chunk_size(0),
+  _hot_cache(NULL), _hot_cache_size(0), _max_hot_cache_size(0),
+  _hot_cache_par_chunk_size(0),
   _hot_cache_idx(0), _hot_cache_par_claimed_idx(0)
 {}
 
@@ -39,7 +42,10 @@ void G1HotCardCache::initialize(G1RegionToSpaceMapper* card_counts_storage) {
     _use_cache = true;
 
     _hot_cache_size = (size_t)1 << G1ConcRSLogCacheSize;
-    _hot_cache = ArrayAllocator<CardValue*>::allocate(_hot_cache_size, mtGC);
+    _max_hot_cache_size = _hot_cache_size << MaxAdaptiveGrowthLog;
+    // Allocate the backing array at the maximum size the adaptive sizing
+    // may grow to; only the first _hot_cache_size slots are in use.
+    _hot_cache = ArrayAllocator<CardValue*>::allocate(_max_hot_cache_size, mtGC);
 
     reset_hot_cache_internal();
 
@@ -54,7 +60,7 @@ void G1HotCardCache::initialize(G1RegionToSpaceMapper* card_counts_storage) {
 G1HotCardCache::~G1HotCardCache() {
   if (default_use_cache()) {
     assert(_hot_cache != NULL, "Logic");
-    ArrayAllocator<CardValue*>::free(_hot_cache, _hot_cache_size);
+    ArrayAllocator<CardValue*>::free(_hot_cache, _max_hot_cache_size);
     _hot_cache = NULL;
   }
 }
@@ -80,7 +86,35 @@ CardTable::CardValue* G1HotCardCache::insert(CardValue* card_ptr) {
   CardValue* previous_ptr = Atomic::cmpxchg(card_ptr,
                                             &_hot_cache[masked_index],
                                             current_ptr);
-  return (previous_ptr == current_ptr) ? previous_ptr : card_ptr;
+  if (previous_ptr == current_ptr) {
+    if (previous_ptr != NULL) {
+      // Decay the evicted card's count: a card must stay hot across
+      // several refinement intervals to keep its slot against bursts.
+      _card_counts.decay_card_count(previous_ptr);
+    }
+    return previous_ptr;
+  }
+  return card_ptr;
+}
+
+void G1HotCardCache::adjust_hot_cache_size() {
+  // _hot_cache_idx counts all insertions since the last reset.
+  size_t inserts = _hot_cache_idx;
+  size_t min_size = (size_t)1 << G1ConcRSLogCacheSize;
+  if (inserts > 2 * _hot_cache_size && _hot_cache_size < _max_hot_cache_size) {
+    // Entries are overwritten well before they can be drained, i.e. the
+    // cache thrashes. Grow it, but only if the additional time to scan
+    // the cache during the pause is predicted to remain a small part of
+    // the pause time goal.
+    double predicted_scan_hcc_ms = _g1h->policy()->analytics()->predict_scan_hcc_ms();
+    double budget_ms = MaxGCPauseMillis * 0.1;
+    if (predicted_scan_hcc_ms * 2.0 <= budget_ms) {
+      _hot_cache_size *= 2;
+    }
+  } else if (inserts < _hot_cache_size / 4 && _hot_cache_size > min_size) {
+    // Mostly unused; give the memory traffic back.
+    _hot_cache_size /= 2;
+  }
 }
 
 void G1HotCardCache::drain(G1CardTableEntryClosure* cl, uint worker_i) {
@@ -66,8 +66,16 @@ private:
   // The card cache table
   CardValue** _hot_cache;
 
+  // Current capacity of the cache. Adjusted between collections within
+  // [2^G1ConcRSLogCacheSize, _max_hot_cache_size] based on observed
+  // insertion traffic and the predicted pause-time cost of scanning the
+  // cache. Always a power of two.
   size_t            _hot_cache_size;
 
+  // Capacity the backing array was allocated with; upper bound for
+  // _hot_cache_size.
+  size_t            _max_hot_cache_size;
+
   size_t            _hot_cache_par_chunk_size;
 
   // Avoids false sharing when concurrently updating _hot_cache_idx or
@@ -84,6 +92,10 @@ private:
   // The number of cached cards a thread claims when flushing the cache
   static const int ClaimChunkSize = 32;
 
+  // Maximum number of doublings of the initial cache size the adaptive
+  // sizing is allowed to perform.
+  static const uint MaxAdaptiveGrowthLog = 4;
+
  public:
   static bool default_use_cache() {
     return (G1ConcRSLogCacheSize > 0);
@@ -120,11 +132,13 @@ private:
     _hot_cache_par_claimed_idx = 0;
   }
 
-  // Resets the hot card cache and discards the entries.
+  // Resets the hot card cache and discards the entries, re-sizing the
+  // cache first if the traffic since the last reset warrants it.
   void reset_hot_cache() {
     assert(SafepointSynchronize::is_at_safepoint(), "Should be at a safepoint");
     assert(Thread::current()->is_VM_thread(), "Current thread should be the VMthread");
     if (default_use_cache()) {
+        adjust_hot_cache_size();
         reset_hot_cache_internal();
     }
   }
@@ -133,6 +147,11 @@ private:
   void reset_card_counts(HeapRegion* hr);
 
  private:
+  // Grow or shrink the cache based on the number of insertions since the
+  // last reset and the predicted cost of scanning the cache during the
+  // pause. Must be called at a safepoint by the VM thread.
+  void adjust_hot_cache_size();
+
   void reset_hot_cache_internal() {
     assert(_hot_cache != NULL, "Logic");
     _hot_cache_idx = 0;
@@ -225,6 +225,12 @@ oop G1ParScanThreadState::copy_to_survivor_space(G1HeapRegionAttr const region_a
                                                  markOop const old_mark) {
   const size_t word_sz = old->size();
   HeapRegion* const from_region = _g1h->heap_region_containing(old);
+  // Objects in a region with pinned objects must not be moved. Treat them
+  // as evacuation failures, so they are self-forwarded and the region is
+  // retained in place. Pin counts cannot change during the pause.
+  if (from_region->has_pinned_objects()) {
+    return handle_evacuation_failure_par(old, old_mark);
+  }
   // +1 to make the -1 indexes valid...
   const int young_index = from_region->young_index_in_cset()+1;
   assert( (from_region->is_young() && young_index >  0) ||
@@ -277,7 +283,7 @@ oop G1ParScanThreadState::copy_to_survivor_space(G1HeapRegionAttr const region_a
   const oop obj = oop(obj_ptr);
   const oop forward_ptr = old->forward_to_atomic(obj, old_mark, memory_order_relaxed);
   if (forward_ptr == NULL) {
-    Copy::aligned_disjoint_words((HeapWord*) old, obj_ptr, word_sz);
+    Copy::aligned_disjoint_words_bulk((HeapWord*) old, obj_ptr, word_sz);
 
     if (dest_attr.is_young()) {
       if (age < markOopDesc::max_age) {
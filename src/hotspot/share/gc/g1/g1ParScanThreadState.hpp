@@ -186,6 +186,10 @@ private:
 
   inline void dispatch_reference(StarTask ref);
 
+  // Prefetch the referent of the given task ahead of its dispatch, so
+  // that the mark word load in do_oop_evac hits the cache.
+  inline void prefetch_referent(StarTask ref) const;
+
   // Tries to allocate word_sz in the PLAB of the next "generation" after trying to
   // allocate into dest. State is the original (source) cset state for the object
   // that is allocated for. Previous_plab_refill_failed indicates whether previously
@@ -31,6 +31,7 @@
 #include "gc/g1/g1RemSet.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/prefetch.inline.hpp"
 
 template <class T> void G1ParScanThreadState::do_oop_evac(T* p) {
   // Reference should not be NULL here as such are never pushed to the task queue.
@@ -149,6 +150,22 @@ inline void G1ParScanThreadState::dispatch_reference(StarTask ref) {
   }
 }
 
+inline void G1ParScanThreadState::prefetch_referent(StarTask ref) const {
+  oop obj;
+  if (ref.is_narrow()) {
+    obj = RawAccess<IS_NOT_NULL>::oop_load((narrowOop*)ref);
+  } else {
+    oop* p = (oop*)ref;
+    if (has_partial_array_mask(p)) {
+      return;
+    }
+    obj = RawAccess<IS_NOT_NULL>::oop_load(p);
+  }
+  // The mark word is inspected first, and copy_to_survivor_space reads
+  // the object front to back.
+  Prefetch::read((void*)obj, 0);
+}
+
 void G1ParScanThreadState::steal_and_trim_queue(RefToScanQueueSet *task_queues) {
   StarTask stolen_task;
   while (task_queues->steal(_worker_id, stolen_task)) {
@@ -179,8 +196,22 @@ inline void G1ParScanThreadState::trim_queue_to_threshold(uint threshold) {
     }
   }
 
+  // Software-pipelined drain of the local queue: the referent of the
+  // just-popped task is prefetched while its predecessor is copied and
+  // scanned, hiding the dependent cache miss on the referenced object
+  // behind the processing of the previous one.
+  StarTask pending;
+  bool has_pending = false;
   while (_refs->pop_local(ref, threshold)) {
-    dispatch_reference(ref);
+    prefetch_referent(ref);
+    if (has_pending) {
+      dispatch_reference(pending);
+    }
+    pending = ref;
+    has_pending = true;
+  }
+  if (has_pending) {
+    dispatch_reference(pending);
   }
 }
 
@@ -874,16 +874,21 @@ size_t G1Policy::predict_bytes_to_copy(HeapRegion* hr) const {
   return bytes_to_copy;
 }
 
-double G1Policy::predict_region_elapsed_time_ms(HeapRegion* hr,
+double G1Policy::predict_region_rs_scan_time_ms(HeapRegion* hr,
                                                 bool for_young_gc) const {
   size_t rs_length = hr->rem_set()->occupied();
   // Predicting the number of cards is based on which type of GC
   // we're predicting for.
   size_t card_num = _analytics->predict_card_num(rs_length, for_young_gc);
+  return _analytics->predict_rs_scan_time_ms(card_num, collector_state()->in_young_only_phase());
+}
+
+double G1Policy::predict_region_elapsed_time_ms(HeapRegion* hr,
+                                                bool for_young_gc) const {
   size_t bytes_to_copy = predict_bytes_to_copy(hr);
 
   double region_elapsed_time_ms =
-    _analytics->predict_rs_scan_time_ms(card_num, collector_state()->in_young_only_phase()) +
+    predict_region_rs_scan_time_ms(hr, for_young_gc) +
     _analytics->predict_object_copy_time_ms(bytes_to_copy, collector_state()->mark_or_rebuild_in_progress());
 
   // The prediction of the "other" time for this region is based
@@ -1259,8 +1264,16 @@ void G1Policy::calculate_old_collection_set_regions(G1CollectionSetCandidates* c
       log_debug(gc, ergo, cset)("Finish adding old regions to collection set (Region amount reached min).");
       break;
     } else {
+      // Regions whose predicted cost is dominated by remembered set
+      // scanning are moved to the optional set even when enough time
+      // remains: the incremental optional mechanism can abandon them if
+      // scanning turns out more expensive than predicted, spreading
+      // dense-remset regions over several mixed pauses.
+      bool scan_dominated =
+        predict_region_rs_scan_time_ms(hr, false) * 100.0 >
+        predicted_time_ms * G1RemSetScanDominatedPercent;
       // Keep adding regions to old set until we reach the optional threshold
-      if (time_remaining_ms > optional_threshold_ms) {
+      if (time_remaining_ms > optional_threshold_ms && !scan_dominated) {
         predicted_old_time_ms += predicted_time_ms;
         num_initial_regions++;
       } else if (time_remaining_ms > 0) {
@@ -140,6 +140,9 @@ public:
   size_t predict_bytes_to_copy(HeapRegion* hr) const;
   double predict_region_elapsed_time_ms(HeapRegion* hr, bool for_young_gc) const;
 
+  // Predicted time to scan the remembered set of the given region.
+  double predict_region_rs_scan_time_ms(HeapRegion* hr, bool for_young_gc) const;
+
   double predict_survivor_regions_evac_time() const;
 
   void cset_regions_freed() {
@@ -1082,7 +1082,17 @@ public:
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
 
     G1RebuildRemSetHeapRegionClosure cl(g1h, _cm, _worker_id_offset + worker_id);
-    g1h->heap_region_par_iterate_from_worker_offset(&cl, &_hr_claimer, worker_id);
+    uint num_nodes = UseNUMA ? (uint)os::numa_get_groups_num() : 1;
+    if (G1NUMARebuildRemSet && num_nodes > 1) {
+      // Partition the region space into per-node slices and start claiming
+      // in the slice whose backing memory is local to this worker's node.
+      // Remote slices are only touched once the local slice is exhausted.
+      uint node_index = MIN2((uint)os::numa_get_group_id(), num_nodes - 1);
+      uint offset = _hr_claimer.offset_for_worker_on_node(worker_id, node_index, num_nodes);
+      g1h->heap_region_par_iterate_from_region_offset(&cl, &_hr_claimer, offset);
+    } else {
+      g1h->heap_region_par_iterate_from_worker_offset(&cl, &_hr_claimer, worker_id);
+    }
   }
 };
 
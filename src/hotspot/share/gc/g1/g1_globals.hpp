@@ -259,6 +259,31 @@
           "Chunk size used for rebuilding the remembered set.")             \
           range(4 * K, 32 * M)                                              \
                                                                             \
+  experimental(uintx, G1RemSetScanDominatedPercent, 75,                     \
+          "Percent of a candidate old region's predicted evacuation time "  \
+          "attributable to remembered set scanning above which the "        \
+          "region is deferred to the optional collection set.")             \
+          range(0, 100)                                                     \
+                                                                            \
+  experimental(uintx, G1UncommitPauseTimeBudgetMS, 10,                      \
+          "Maximum time in milliseconds to spend uncommitting regions "     \
+          "within a single pause when shrinking the heap. Shrink work "     \
+          "exceeding the budget is deferred to the next shrink "            \
+          "opportunity. A value of 0 means the budget is unlimited.")       \
+          range(0, 1000)                                                    \
+                                                                            \
+  experimental(uintx, G1CardRefinementBatchSize, 1,                         \
+          "Number of completed dirty card buffers a refinement thread "     \
+          "claims per step. Batches larger than 1 are claimed with a "      \
+          "single lock acquisition and their cards are deduplicated "       \
+          "before refinement.")                                             \
+          range(1, 64)                                                      \
+                                                                            \
+  experimental(bool, G1NUMARebuildRemSet, true,                             \
+          "Partition remembered set rebuild work by NUMA node so that "    \
+          "workers preferentially claim regions whose backing memory is "   \
+          "local to their node. Only has an effect with UseNUMA.")          \
+                                                                            \
   experimental(uintx, G1OldCSetRegionThresholdPercent, 10,                  \
           "An upper bound for the number of old CSet regions expressed "    \
           "as a percentage of the heap size.")                              \
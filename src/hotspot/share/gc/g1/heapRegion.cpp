@@ -153,6 +153,10 @@ void HeapRegion::calc_gc_efficiency() {
   double region_elapsed_time_ms =
     policy->predict_region_elapsed_time_ms(this, false /* for_young_gc */);
   _gc_efficiency = (double) reclaimable_bytes() / region_elapsed_time_ms;
+
+  // Incoming reference density: remembered set cards per live byte.
+  size_t live = MAX2(live_bytes(), (size_t)1);
+  _incoming_ref_density = (double) rem_set()->occupied() / live;
 }
 
 void HeapRegion::set_free() {
@@ -237,11 +241,13 @@ HeapRegion::HeapRegion(uint hrm_index,
     _type(),
     _humongous_start_region(NULL),
     _evacuation_failed(false),
+    _pinned_object_count(0),
     _next(NULL), _prev(NULL),
 #ifdef ASSERT
     _containing_set(NULL),
 #endif
     _prev_marked_bytes(0), _next_marked_bytes(0), _gc_efficiency(0.0),
+    _incoming_ref_density(0.0),
     _index_in_opt_cset(InvalidCSetIndex), _young_index_in_cset(-1),
     _surv_rate_group(NULL), _age_index(-1),
     _prev_top_at_mark_start(NULL), _next_top_at_mark_start(NULL),
@@ -236,6 +236,11 @@ class HeapRegion: public G1ContiguousSpace {
   // True iff an attempt to evacuate an object in the region failed.
   bool _evacuation_failed;
 
+  // Number of outstanding pins on objects in this region. Incremented and
+  // decremented by mutator threads through the pinning API; regions with a
+  // non-zero count are skipped by the collection set chooser.
+  volatile size_t _pinned_object_count;
+
   // Fields used by the HeapRegionSetBase class and subclasses.
   HeapRegion* _next;
   HeapRegion* _prev;
@@ -251,6 +256,12 @@ class HeapRegion: public G1ContiguousSpace {
   // The calculated GC efficiency of the region.
   double _gc_efficiency;
 
+  // Incoming reference density of the region: remembered set cards per
+  // live byte, calculated together with the GC efficiency. Used by the
+  // collection set chooser to order scan-heavy regions later among
+  // regions of equal efficiency.
+  double _incoming_ref_density;
+
   static const uint InvalidCSetIndex = UINT_MAX;
 
   // The index in the optional regions array, if this region
@@ -438,6 +449,15 @@ class HeapRegion: public G1ContiguousSpace {
   // Humongous regions and archive regions are pinned.
   bool is_pinned() const { return _type.is_pinned(); }
 
+  // Explicit object pinning support. Unlike the type-based notion of a
+  // pinned region above, these pins are transient: a region is excluded
+  // from collection set candidate selection for as long as any object in
+  // it is pinned, and becomes eligible again once all pins are released.
+  inline size_t pinned_count() const;
+  inline bool has_pinned_objects() const;
+  inline void increment_pinned_count();
+  inline void decrement_pinned_count();
+
   // An archive region is a pinned region, also tagged as old, which
   // should not be marked during mark/sweep. This allows the address
   // space to be shared by JVM instances.
@@ -551,6 +571,7 @@ class HeapRegion: public G1ContiguousSpace {
 
   void calc_gc_efficiency(void);
   double gc_efficiency() const { return _gc_efficiency;}
+  double incoming_ref_density() const { return _incoming_ref_density; }
 
   uint index_in_opt_cset() const {
     assert(has_index_in_opt_cset(), "Opt cset index not set.");
@@ -362,4 +362,21 @@ bool HeapRegion::oops_on_card_seq_iterate_careful(MemRegion mr,
   return true;
 }
 
+inline size_t HeapRegion::pinned_count() const {
+  return Atomic::load(&_pinned_object_count);
+}
+
+inline bool HeapRegion::has_pinned_objects() const {
+  return pinned_count() > 0;
+}
+
+inline void HeapRegion::increment_pinned_count() {
+  Atomic::inc(&_pinned_object_count);
+}
+
+inline void HeapRegion::decrement_pinned_count() {
+  assert(pinned_count() > 0, "pin count underflow for region %u", hrm_index());
+  Atomic::dec(&_pinned_object_count);
+}
+
 #endif // SHARE_GC_G1_HEAPREGION_INLINE_HPP
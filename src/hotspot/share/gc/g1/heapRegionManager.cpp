@@ -32,6 +32,7 @@
 #include "gc/g1/heterogeneousHeapRegionManager.hpp"
 #include "memory/allocation.hpp"
 #include "utilities/bitMap.inline.hpp"
+#include "utilities/ticks.hpp"
 
 class MasterFreeRegionListChecker : public HeapRegionSetChecker {
 public:
@@ -62,6 +63,7 @@ HeapRegionManager::HeapRegionManager() :
   _available_map(mtGC),
   _num_committed(0),
   _allocated_heapregions_length(0),
+  _last_shrink_budget_limited_regions(0),
   _regions(), _heap_mapper(NULL),
   _prev_bitmap_mapper(NULL),
   _next_bitmap_mapper(NULL),
@@ -420,8 +422,19 @@ uint HeapRegionManager::shrink_by(uint num_regions_to_remove) {
   uint idx_last_found = 0;
   uint num_last_found = 0;
 
+  _last_shrink_budget_limited_regions = 0;
+  const Ticks start = Ticks::now();
+
   while ((removed < num_regions_to_remove) &&
       (num_last_found = find_empty_from_idx_reverse(cur, &idx_last_found)) > 0) {
+    if (G1UncommitPauseTimeBudgetMS > 0 &&
+        (Ticks::now() - start).milliseconds() >= G1UncommitPauseTimeBudgetMS) {
+      // Uncommitting (madvise/munmap) can be expensive; stop when the
+      // budget for this pause is used up and report the remainder so the
+      // caller can retry it at the next shrink opportunity.
+      _last_shrink_budget_limited_regions = num_regions_to_remove - removed;
+      break;
+    }
     uint to_remove = MIN2(num_regions_to_remove - removed, num_last_found);
 
     shrink_at(idx_last_found + num_last_found - to_remove, to_remove);
@@ -541,6 +554,19 @@ uint HeapRegionClaimer::offset_for_worker(uint worker_id) const {
   return _n_regions * worker_id / _n_workers;
 }
 
+uint HeapRegionClaimer::offset_for_worker_on_node(uint worker_id, uint node_index, uint num_nodes) const {
+  assert(worker_id < _n_workers, "Invalid worker_id.");
+  assert(num_nodes > 0 && node_index < num_nodes, "Invalid node_index.");
+  uint slice_start = _n_regions * node_index / num_nodes;
+  uint slice_end = _n_regions * (node_index + 1) / num_nodes;
+  uint slice_len = slice_end - slice_start;
+  if (slice_len == 0) {
+    return offset_for_worker(worker_id);
+  }
+  // Spread workers mapped to the same node across their slice.
+  return slice_start + (slice_len * worker_id / _n_workers) % slice_len;
+}
+
 bool HeapRegionClaimer::is_region_claimed(uint region_index) const {
   assert(region_index < _n_regions, "Invalid index.");
   return _claims[region_index] == Claimed;
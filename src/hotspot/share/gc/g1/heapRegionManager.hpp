@@ -85,6 +85,10 @@ class HeapRegionManager: public CHeapObj<mtGC> {
   // Internal only. The highest heap region +1 we allocated a HeapRegion instance for.
   uint _allocated_heapregions_length;
 
+  // Number of regions the last shrink_by call could not uncommit because
+  // the pause time budget (G1UncommitPauseTimeBudgetMS) was exhausted.
+  uint _last_shrink_budget_limited_regions;
+
   HeapWord* heap_bottom() const { return _regions.bottom_address_mapped(); }
   HeapWord* heap_end() const {return _regions.end_address_mapped(); }
 
@@ -253,9 +257,13 @@ public:
   void par_iterate(HeapRegionClosure* blk, HeapRegionClaimer* hrclaimer, const uint start_index) const;
 
   // Uncommit up to num_regions_to_remove regions that are completely free.
-  // Return the actual number of uncommitted regions.
+  // Return the actual number of uncommitted regions. Stops early when the
+  // uncommit pause time budget is exhausted; the remainder is reported by
+  // last_shrink_budget_limited_regions().
   virtual uint shrink_by(uint num_regions_to_remove);
 
+  uint last_shrink_budget_limited_regions() const { return _last_shrink_budget_limited_regions; }
+
   // Uncommit a number of regions starting at the specified index, which must be available,
   // empty, and free.
   void shrink_at(uint index, size_t num_regions);
@@ -287,6 +295,12 @@ class HeapRegionClaimer : public StackObj {
   // Return a start offset given a worker id.
   uint offset_for_worker(uint worker_id) const;
 
+  // Return a start offset for a worker running on the given NUMA node.
+  // The region space is partitioned into num_nodes consecutive slices;
+  // the returned offset lies within the slice for node_index so that
+  // workers preferentially claim regions whose backing memory is local.
+  uint offset_for_worker_on_node(uint worker_id, uint node_index, uint num_nodes) const;
+
   // Check if region has been claimed with this HRClaimer.
   bool is_region_claimed(uint region_index) const;
 
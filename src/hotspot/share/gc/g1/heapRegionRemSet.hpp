@@ -65,6 +65,20 @@ class nmethod;
 //      it's _coarse_map bit is set, so the that we were attempting to add
 //      is represented.  If a deleted PRT is re-used, a thread adding a bit,
 //      thinking the PRT is for a different region, does no harm.
+//
+// On memory footprint: the jump from a sparse entry to a full fine-grain
+// PRT (one bit per card in the referencing region) is the expensive step
+// on very large heaps, and an intermediate granularity -- arrays of small
+// bitmaps covering slices of a region, promoted and demoted by occupancy,
+// with PRT storage carved from arenas instead of individual C-heap blocks
+// -- would shrink it considerably.  That is a redesign of this whole
+// container stack, including the lock-free find/delete protocol above and
+// the iterator and scan code, not an incremental change; it is noted here
+// as the known direction rather than attempted piecemeal.  Until then the
+// working levers are G1RSetSparseRegionEntries / G1RSetRegionEntries
+// (when to leave sparse and when to coarsen) and a larger
+// G1HeapRegionSize, which cuts cross-region references and with them the
+// number of PRTs outright.
 
 class OtherRegionsTable {
   friend class HeapRegionRemSetIterator;
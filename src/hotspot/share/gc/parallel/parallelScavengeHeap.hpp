@@ -141,6 +141,13 @@ class ParallelScavengeHeap : public CollectedHeap {
   void post_initialize();
   void update_counters();
 
+  virtual void stop();
+
+  virtual void safepoint_synchronize_begin();
+  virtual void safepoint_synchronize_end();
+
+  virtual void deduplicate_string(oop str);
+
   size_t capacity() const;
   size_t used() const;
 
@@ -45,6 +45,7 @@
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/isGCActiveMark.hpp"
+#include "gc/shared/parallelCleaning.hpp"
 #include "gc/shared/referencePolicy.hpp"
 #include "gc/shared/referenceProcessor.hpp"
 #include "gc/shared/referenceProcessorPhaseTimes.hpp"
@@ -572,6 +573,15 @@ void PSMarkSweep::mark_sweep_phase1(bool clear_all_softrefs) {
     JVMCI_ONLY(JVMCI::do_unloading(purged_class));
   }
 
+  if (StringDedup::is_enabled()) {
+    GCTraceTime(Debug, gc, phases) t("String Dedup Cleaning", _gc_timer);
+    // Prune string deduplication queue/table entries for strings that
+    // died during marking. References to surviving strings are updated
+    // later in mark_sweep_phase3().
+    StringDedupCleaningTask dedup_cleaning_task(is_alive_closure(), NULL, true);
+    dedup_cleaning_task.work(0);
+  }
+
   _gc_tracer->report_object_count_after_gc(is_alive_closure());
 }
 
@@ -621,6 +631,13 @@ void PSMarkSweep::mark_sweep_phase3() {
   // Global (weak) JNI handles
   WeakProcessor::oops_do(adjust_pointer_closure());
 
+  if (StringDedup::is_enabled()) {
+    // Adjust string deduplication queue/table entries to point to the
+    // new object locations. Dead entries were already pruned after marking.
+    StringDedupCleaningTask dedup_cleaning_task(NULL, adjust_pointer_closure(), false);
+    dedup_cleaning_task.work(0);
+  }
+
   CodeBlobToOopClosure adjust_from_blobs(adjust_pointer_closure(), CodeBlobToOopClosure::FixRelocations);
   CodeCache::blobs_do(&adjust_from_blobs);
   AOT_ONLY(AOTLoader::oops_do(adjust_pointer_closure());)
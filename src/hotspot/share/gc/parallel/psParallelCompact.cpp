@@ -50,6 +50,7 @@
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/isGCActiveMark.hpp"
+#include "gc/shared/parallelCleaning.hpp"
 #include "gc/shared/referencePolicy.hpp"
 #include "gc/shared/referenceProcessor.hpp"
 #include "gc/shared/referenceProcessorPhaseTimes.hpp"
@@ -2187,6 +2188,15 @@ void PSParallelCompact::marking_phase(ParCompactionManager* cm,
     JVMCI_ONLY(JVMCI::do_unloading(purged_class));
   }
 
+  if (StringDedup::is_enabled()) {
+    GCTraceTime(Debug, gc, phases) tm("String Dedup Cleaning", &_gc_timer);
+    // Prune string deduplication queue/table entries for strings that
+    // died during marking. References to surviving strings are updated
+    // later by adjust_roots().
+    StringDedupCleaningTask dedup_cleaning_task(is_alive_closure(), NULL, true);
+    dedup_cleaning_task.work(0);
+  }
+
   _gc_tracer.report_object_count_after_gc(is_alive_closure());
 }
 
@@ -2214,6 +2224,13 @@ void PSParallelCompact::adjust_roots(ParCompactionManager* cm) {
   // have been cleared if they pointed to non-surviving objects.)
   WeakProcessor::oops_do(&oop_closure);
 
+  if (StringDedup::is_enabled()) {
+    // Adjust string deduplication queue/table entries to point to the
+    // new object locations. Dead entries were already pruned after marking.
+    StringDedupCleaningTask dedup_cleaning_task(NULL, &oop_closure, false);
+    dedup_cleaning_task.work(0);
+  }
+
   CodeBlobToOopClosure adjust_from_blobs(&oop_closure, CodeBlobToOopClosure::FixRelocations);
   CodeCache::blobs_do(&adjust_from_blobs);
   AOT_ONLY(AOTLoader::oops_do(&oop_closure);)
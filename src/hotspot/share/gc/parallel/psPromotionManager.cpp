@@ -42,6 +42,11 @@
 #include "memory/resourceArea.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/compressedOops.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/align.hpp"
 
 PaddedEnd<PSPromotionManager>* PSPromotionManager::_manager_array = NULL;
 OopStarTaskQueueSet*           PSPromotionManager::_stack_array_depth = NULL;
@@ -49,6 +54,15 @@ PreservedMarksSet*             PSPromotionManager::_preserved_marks_set = NULL;
 PSOldGen*                      PSPromotionManager::_old_gen = NULL;
 MutableSpace*                  PSPromotionManager::_young_space = NULL;
 
+PaddedEnd<PSPromotionManager::OldPLABPool>* PSPromotionManager::_old_plab_pools = NULL;
+int                            PSPromotionManager::_num_old_plab_pools = 0;
+size_t                         PSPromotionManager::_old_plab_pool_chunk_size = 0;
+
+// Initial contents of the per-node promotion pools: a zero-capacity region
+// at a non-NULL address, so that the first allocation attempt takes the
+// refill path (a NULL _top means a refill is in progress).
+static HeapWord _initial_pool_cursor;
+
 void PSPromotionManager::initialize() {
   ParallelScavengeHeap* heap = ParallelScavengeHeap::heap();
 
@@ -78,8 +92,123 @@ void PSPromotionManager::initialize() {
   guarantee(_preserved_marks_set != NULL, "Could not initialize preserved marks set");
   _preserved_marks_set->init(promotion_manager_num);
   for (uint i = 0; i < promotion_manager_num; i += 1) {
+    _manager_array[i].set_manager_id(i);
     _manager_array[i].register_preserved_marks(_preserved_marks_set->get(i));
   }
+
+  if (UseNUMA && os::numa_get_groups_num() > 1) {
+    size_t num_nodes = os::numa_get_groups_num();
+    int* lgrp_ids = NEW_C_HEAP_ARRAY(int, num_nodes, mtGC);
+    _num_old_plab_pools = (int)os::numa_get_leaf_groups(lgrp_ids, num_nodes);
+    if (_num_old_plab_pools > 1) {
+      _old_plab_pools = PaddedArray<OldPLABPool, mtGC>::create_unfreeable((uint)_num_old_plab_pools);
+      for (int i = 0; i < _num_old_plab_pools; i++) {
+        _old_plab_pools[i]._top = &_initial_pool_cursor;
+        _old_plab_pools[i]._end = &_initial_pool_cursor;
+        _old_plab_pools[i]._lgrp_id = lgrp_ids[i];
+      }
+      _old_plab_pool_chunk_size = align_object_size(8 * OldPLABSize);
+    } else {
+      _num_old_plab_pools = 0;
+    }
+    FREE_C_HEAP_ARRAY(int, lgrp_ids);
+  }
+}
+
+HeapWord* PSPromotionManager::old_gen_cas_allocate(size_t word_size) {
+  // Large allocations are served directly from the shared top pointer;
+  // carving them out of a pool chunk would waste most of the chunk.
+  if (_old_plab_pools == NULL || word_size * 4 > _old_plab_pool_chunk_size) {
+    return old_gen()->cas_allocate(word_size);
+  }
+
+  Thread* thr = Thread::current();
+  int lgrp_id = thr->lgrp_id();
+  if (lgrp_id == -1 || !os::numa_has_group_homing()) {
+    lgrp_id = os::numa_get_group_id();
+    thr->set_lgrp_id(lgrp_id);
+  }
+
+  int i = 0;
+  while (i < _num_old_plab_pools && _old_plab_pools[i]._lgrp_id != lgrp_id) {
+    i++;
+  }
+  if (i == _num_old_plab_pools) {
+    i = os::random() % _num_old_plab_pools;
+  }
+  return pool_allocate(&_old_plab_pools[i], word_size);
+}
+
+HeapWord* PSPromotionManager::pool_allocate(OldPLABPool* pool, size_t word_size) {
+  while (true) {
+    HeapWord* top = OrderAccess::load_acquire(&pool->_top);
+    if (top == NULL) {
+      // Another worker is refilling the pool. Do not wait for it; contend
+      // on the shared top pointer this one time instead.
+      return old_gen()->cas_allocate(word_size);
+    }
+
+    // Never allocate the chunk completely, so that the tail can always be
+    // filled with a dummy object when the pool is retired.
+    if (pointer_delta(pool->_end, top) >= word_size + CollectedHeap::min_fill_size()) {
+      HeapWord* new_top = top + word_size;
+      if (Atomic::cmpxchg(new_top, &pool->_top, top) == top) {
+        old_gen()->start_array()->allocate_block(top);
+        return top;
+      }
+      continue;
+    }
+
+    // The pool is exhausted. Claim the refill by parking the cursor;
+    // concurrent allocations use the shared top pointer meanwhile.
+    if (Atomic::cmpxchg((HeapWord*)NULL, &pool->_top, top) != top) {
+      continue;
+    }
+
+    HeapWord* chunk = old_gen()->cas_allocate(_old_plab_pool_chunk_size);
+    if (chunk == NULL) {
+      // The old generation could not fit a full chunk. Unpark the cursor
+      // unchanged and try the (smaller) requested size directly.
+      OrderAccess::release_store(&pool->_top, top);
+      return old_gen()->cas_allocate(word_size);
+    }
+
+    // Bind the chunk's fresh pages to this pool's node. Pages that are
+    // already backed keep their current placement.
+    size_t page_size = os::vm_page_size();
+    char* bind_start = align_up((char*)chunk, page_size);
+    char* bind_end = align_down((char*)(chunk + _old_plab_pool_chunk_size), page_size);
+    if (bind_start < bind_end) {
+      os::numa_make_local(bind_start, pointer_delta(bind_end, bind_start, 1), pool->_lgrp_id);
+    }
+
+    // Serve the current allocation from the front of the new chunk and
+    // publish the remainder. The store to _end must be visible before the
+    // cursor is released.
+    old_gen()->start_array()->allocate_block(chunk);
+    pool->_end = chunk + _old_plab_pool_chunk_size;
+    OrderAccess::release_store(&pool->_top, chunk + word_size);
+    return chunk;
+  }
+}
+
+void PSPromotionManager::retire_old_plab_pools() {
+  if (_old_plab_pools == NULL) {
+    return;
+  }
+  for (int i = 0; i < _num_old_plab_pools; i++) {
+    OldPLABPool* pool = &_old_plab_pools[i];
+    assert(pool->_top != NULL, "refill in progress after scavenge");
+    HeapWord* top = pool->_top;
+    if (top != &_initial_pool_cursor && top < pool->_end) {
+      // Fill the unused tail of the current chunk to keep the old
+      // generation parseable.
+      CollectedHeap::fill_with_objects(top, pointer_delta(pool->_end, top));
+      old_gen()->start_array()->allocate_block(top);
+    }
+    pool->_top = &_initial_pool_cursor;
+    pool->_end = &_initial_pool_cursor;
+  }
 }
 
 // Helper functions to get around the circular dependency between
@@ -126,6 +255,7 @@ bool PSPromotionManager::post_scavenge(YoungGCTracer& gc_tracer) {
     }
     manager->flush_labs();
   }
+  retire_old_plab_pools();
   if (!promotion_failure_occurred) {
     // If there was no promotion failure, the preserved mark stacks
     // should be empty.
@@ -209,6 +339,7 @@ PSPromotionManager::PSPromotionManager() {
   // let's choose 1.5x the chunk size
   _min_array_size_for_chunking = 3 * _array_chunk_size / 2;
 
+  _manager_id = 0;
   _preserved_marks = NULL;
 
   reset();
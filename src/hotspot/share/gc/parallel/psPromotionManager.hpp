@@ -59,6 +59,33 @@ class PSPromotionManager {
   static PSOldGen*                      _old_gen;
   static MutableSpace*                  _young_space;
 
+  // NUMA support: when UseNUMA is enabled, old generation allocations for
+  // promotion are served from per-node pools. Each pool strides over chunks
+  // claimed from the shared old generation top, so PLAB refills by workers
+  // on different nodes do not contend on the same top pointer, and each
+  // newly claimed chunk is bound to the pool's node so promoted objects
+  // land on memory local to the promoting worker.
+  struct OldPLABPool {
+    // The allocation cursor. NULL while a chunk refill is in progress, in
+    // which case allocations fall back to the shared top pointer.
+    HeapWord* volatile _top;
+    // End of the current chunk. Only changes while _top is NULL.
+    HeapWord*          _end;
+    int                _lgrp_id;
+  };
+
+  static PaddedEnd<OldPLABPool>*        _old_plab_pools;
+  static int                            _num_old_plab_pools;
+  static size_t                         _old_plab_pool_chunk_size;
+
+  // Allocates in the old generation, through the pool of the calling
+  // thread's node when the pools are enabled.
+  static HeapWord* old_gen_cas_allocate(size_t word_size);
+  static HeapWord* pool_allocate(OldPLABPool* pool, size_t word_size);
+  // Fills the unused tail of each pool's current chunk, keeping the old
+  // generation parseable. Called serially after a scavenge.
+  static void retire_old_plab_pools();
+
 #if TASKQUEUE_STATS
   size_t                              _masked_pushes;
   size_t                              _masked_steals;
@@ -82,6 +109,10 @@ class PSPromotionManager {
   bool                                _totally_drain;
   uint                                _target_stack_size;
 
+  // Index of this manager in _manager_array, also used as the worker id
+  // when pushing string deduplication candidates.
+  uint                                _manager_id;
+
   uint                                _array_chunk_size;
   uint                                _min_array_size_for_chunking;
 
@@ -92,6 +123,8 @@ class PSPromotionManager {
   static PSOldGen* old_gen()         { return _old_gen; }
   static MutableSpace* young_space() { return _young_space; }
 
+  void set_manager_id(uint id) { _manager_id = id; }
+
   inline static PSPromotionManager* manager_array(uint index);
   template <class T> inline void claim_or_forward_internal_depth(T* p);
 
@@ -42,6 +42,7 @@
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/isGCActiveMark.hpp"
+#include "gc/shared/parallelCleaning.hpp"
 #include "gc/shared/referencePolicy.hpp"
 #include "gc/shared/referenceProcessor.hpp"
 #include "gc/shared/referenceProcessorPhaseTimes.hpp"
@@ -111,6 +112,21 @@ public:
   virtual void do_oop(narrowOop* p) { PSKeepAliveClosure::do_oop_work(p); }
 };
 
+// The string deduplication queue may contain strings enqueued during the
+// current scavenge, which already point into to-space. Unlike other weak
+// references those are alive even though they are not forwarded.
+class PSStringDedupIsAliveClosure: public BoolObjectClosure {
+private:
+  MutableSpace* _to_space;
+
+public:
+  PSStringDedupIsAliveClosure(MutableSpace* to_space) : _to_space(to_space) { }
+
+  bool do_object_b(oop p) {
+    return (!PSScavenge::is_obj_in_young(p)) || _to_space->contains(p) || p->is_forwarded();
+  }
+};
+
 class PSEvacuateFollowersClosure: public VoidClosure {
  private:
   PSPromotionManager* _promotion_manager;
@@ -431,6 +447,18 @@ bool PSScavenge::invoke_no_policy() {
       WeakProcessor::weak_oops_do(&_is_alive_closure, &root_closure);
     }
 
+    if (StringDedup::is_enabled()) {
+      GCTraceTime(Debug, gc, phases) tm("String Dedup Cleaning", &_gc_timer);
+      // Clean the string deduplication queue/table of strings that died
+      // during the scavenge, and update references to strings that moved.
+      // All surviving strings have already been copied, so the keep alive
+      // closure only updates references to their new locations.
+      PSStringDedupIsAliveClosure dedup_is_alive(young_gen->to_space());
+      PSKeepAliveClosure dedup_keep_alive(promotion_manager);
+      StringDedupCleaningTask dedup_cleaning_task(&dedup_is_alive, &dedup_keep_alive, true);
+      dedup_cleaning_task.work(0);
+    }
+
     // Verify that usage of root_closure didn't copy any objects.
     assert(promotion_manager->stacks_empty(),"stacks should be empty at this point");
 
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/javaClasses.inline.hpp"
+#include "gc/parallel/psStringDedup.hpp"
+#include "gc/parallel/psStringDedupQueue.hpp"
+#include "gc/shared/stringdedup/stringDedup.inline.hpp"
+#include "gc/shared/stringdedup/stringDedupQueue.inline.hpp"
+#include "gc/shared/stringdedup/stringDedupStat.hpp"
+#include "gc/shared/stringdedup/stringDedupThread.inline.hpp"
+#include "oops/oop.inline.hpp"
+
+void PSStringDedup::initialize() {
+  assert(UseParallelGC, "String deduplication available with Parallel GC");
+  StringDedup::initialize_impl<PSStringDedupQueue, StringDedupStat>();
+}
+
+bool PSStringDedup::is_candidate(oop obj, bool obj_is_tenured) {
+  if (java_lang_String::is_instance_inlined(obj)) {
+    if (!obj_is_tenured && obj->age() == StringDeduplicationAgeThreshold) {
+      // Candidate found. String stays in the young generation and just
+      // reached the deduplication age threshold.
+      return true;
+    }
+    if (obj_is_tenured && obj->age() < StringDeduplicationAgeThreshold) {
+      // Candidate found. String is being promoted to the old generation
+      // but has not reached the deduplication age threshold, i.e. has not
+      // previously been a candidate during its life in the young generation.
+      return true;
+    }
+  }
+
+  // Not a candidate
+  return false;
+}
+
+void PSStringDedup::enqueue_from_evacuation(bool obj_is_tenured, uint worker_id, oop java_string) {
+  assert(is_enabled(), "String deduplication not enabled");
+  if (is_candidate(java_string, obj_is_tenured)) {
+    StringDedupQueue::push(worker_id, java_string);
+  }
+}
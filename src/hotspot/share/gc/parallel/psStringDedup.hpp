@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_PARALLEL_PSSTRINGDEDUP_HPP
+#define SHARE_GC_PARALLEL_PSSTRINGDEDUP_HPP
+
+//
+// Parallel GC string deduplication candidate selection
+//
+// An object is considered a deduplication candidate if all of the following
+// statements are true:
+//
+// - The object is an instance of java.lang.String
+//
+// - The object is being scavenged and stays in the young generation with an
+//   age equal to the deduplication age threshold
+//
+//   or
+//
+//   The object is being promoted to the old generation with an age less
+//   than the deduplication age threshold
+//
+// Once a string object has been promoted to the old generation, or its age
+// is higher than the deduplication age threshold, it will never become a
+// candidate again. This mirrors the candidate selection used by G1's
+// evacuation path.
+//
+
+#include "gc/shared/stringdedup/stringDedup.hpp"
+#include "memory/allocation.hpp"
+#include "oops/oop.hpp"
+
+//
+// Parallel GC interface for interacting with string deduplication.
+//
+class PSStringDedup : public StringDedup {
+private:
+  // Candidate selection policy, returns true if the given object is a
+  // candidate for string deduplication.
+  static bool is_candidate(oop obj, bool obj_is_tenured);
+
+public:
+  // Initialize string deduplication.
+  static void initialize();
+
+  // Enqueues a deduplication candidate for later processing by the
+  // deduplication thread. Before enqueuing, this function applies the
+  // candidate selection policy to filter out non-candidates.
+  static void enqueue_from_evacuation(bool obj_is_tenured, uint worker_id,
+                                      oop java_string);
+};
+
+#endif // SHARE_GC_PARALLEL_PSSTRINGDEDUP_HPP
@@ -215,6 +215,15 @@ void ClearNoncleanCardWrapper::do_MemRegion(MemRegion mr) {
       // fast forward through potential continuous whole-word range of clean cards beginning at a word-boundary
       if (is_word_aligned(cur_entry)) {
         CardValue* cur_row = cur_entry - BytesPerWord;
+        // Four words at a time while the run of clean cards lasts. A clean
+        // row is all-ones, so the AND of several rows is all-ones only when
+        // every row is clean. Mostly-clean card tables are then traversed
+        // with a few wide loads per 32 cards instead of a load per card.
+        while (cur_row - 3 * BytesPerWord >= limit &&
+               (((intptr_t*)cur_row)[0] & ((intptr_t*)cur_row)[-1] &
+                ((intptr_t*)cur_row)[-2] & ((intptr_t*)cur_row)[-3]) == CardTableRS::clean_card_row_val()) {
+          cur_row -= 4 * BytesPerWord;
+        }
         while (cur_row >= limit && *((intptr_t*)cur_row) ==  CardTableRS::clean_card_row_val()) {
           cur_row -= BytesPerWord;
         }
@@ -68,6 +68,15 @@ class GCMessage : public FormatBuffer<1024> {
 
 class CollectedHeap;
 
+// Helper for partitioning the objects of a heap among a set of workers;
+// created by CollectedHeap::parallel_object_iterator(). Together the
+// workers visit every object in the heap exactly once.
+class ParallelObjectIterator : public CHeapObj<mtGC> {
+ public:
+  virtual void object_iterate(ObjectClosure* cl, uint worker_id) = 0;
+  virtual ~ParallelObjectIterator() {}
+};
+
 class GCHeapLog : public EventLogBase<GCMessage> {
  private:
   void log_heap(CollectedHeap* heap, bool before);
@@ -398,6 +407,13 @@ class CollectedHeap : public CHeapObj<mtInternal> {
   // Iterate over all objects, calling "cl.do_object" on each.
   virtual void object_iterate(ObjectClosure* cl) = 0;
 
+  // Return an iterator that partitions the heap's objects among worker_num
+  // workers, or NULL if this heap does not support parallel iteration.
+  // The caller is responsible for deleting the returned iterator.
+  virtual ParallelObjectIterator* parallel_object_iterator(uint worker_num) {
+    return NULL;
+  }
+
   // Similar to object_iterate() except iterates only
   // over live objects.
   virtual void safe_object_iterate(ObjectClosure* cl) = 0;
@@ -223,6 +223,12 @@
           "Force dynamic selection of the number of "                       \
           "parallel threads parallel gc will use to aid debugging")         \
                                                                             \
+  experimental(bool, UseGCPhaseWorkerScaling, false,                        \
+          "Scale the number of workers for each parallel GC phase based "   \
+          "on measured durations of earlier runs of that phase. Phases "    \
+          "with little inherent parallelism then leave the excess "         \
+          "workers parked instead of spinning in termination.")             \
+                                                                            \
   product(size_t, HeapSizePerGCThread, ScaleForWordSize(32*M),              \
           "Size of heap (bytes) per GC thread used in calculating the "     \
           "number of GC threads")                                           \
@@ -330,6 +336,11 @@
   product(bool, ParallelRefProcBalancingEnabled, true,                      \
           "Enable balancing of reference processing queues")                \
                                                                             \
+  diagnostic(uintx, RefPendingListGrowthWarningThreshold, 5,                \
+          "Emit a JFR warning event when the java.lang.ref pending list "   \
+          "has grown for this many consecutive garbage collections "        \
+          "(0 disables the detection)")                                     \
+                                                                            \
   experimental(size_t, ReferencesPerThread, 1000,                           \
                "Ergonomically start one thread for this amount of "         \
                "references for reference processing if "                    \
@@ -769,6 +780,11 @@
           "of blocks to attempt to claim when refilling CMS LAB's")         \
           constraint(OldPLABSizeConstraintFunc,AfterMemoryInit)             \
                                                                             \
+  product(size_t, NonTemporalCopyThreshold, 0,                              \
+          "Object size in bytes from which GC evacuation copies use "       \
+          "cache-bypassing streaming stores, on platforms that support "    \
+          "them (0 means never)")                                           \
+                                                                            \
   product(uintx, TLABAllocationWeight, 35,                                  \
           "Allocation averaging weight")                                    \
           range(0, 100)                                                     \
@@ -28,6 +28,7 @@
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/memAllocator.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "memory/universe.hpp"
 #include "oops/arrayOop.hpp"
 #include "oops/oop.inline.hpp"
@@ -183,11 +184,19 @@ void MemAllocator::Allocation::check_for_valid_allocation_state() const {
 }
 #endif
 
+// The thread heap sampler drives both the JVMTI SampledObjectAlloc event
+// and the JFR ObjectAllocationSample event; the latter does not depend on
+// JVMTI being in use.
+static bool should_sample_allocation() {
+  return JvmtiExport::should_post_sampled_object_alloc() ||
+         EventObjectAllocationSample::is_enabled();
+}
+
 void MemAllocator::Allocation::notify_allocation_jvmti_sampler() {
   // support for JVMTI VMObjectAlloc event (no-op if not enabled)
   JvmtiExport::vm_object_alloc_event_collector(obj());
 
-  if (!JvmtiExport::should_post_sampled_object_alloc()) {
+  if (!should_sample_allocation()) {
     // Sampling disabled
     return;
   }
@@ -289,7 +298,7 @@ HeapWord* MemAllocator::allocate_inside_tlab_slow(Allocation& allocation) const
   HeapWord* mem = NULL;
   ThreadLocalAllocBuffer& tlab = _thread->tlab();
 
-  if (JvmtiExport::should_post_sampled_object_alloc()) {
+  if (should_sample_allocation()) {
     tlab.set_back_allocation_end();
     mem = tlab.allocate(_word_size);
 
@@ -972,6 +972,18 @@ bool OopStorage::BasicParState::claim_next_segment(IterationData* data) {
   // threads to do.  But too small a step can lead to contention
   // over _next_block, esp. when the work per block is small.
   size_t max_step = 10;
+  // Adapt the claim size to the observed fill ratio.  A sparse storage
+  // (e.g. a large JNI global handle storage after churn) consists mostly
+  // of empty or nearly-empty blocks, each iterated in a few loads, so
+  // fixed-size claims make threads contend over _next_block instead of
+  // doing work.  Scale the claim up as the average number of entries per
+  // processed block drops; dense storages keep the small step and its
+  // load balancing properties.
+  if (data->_processed > 0) {
+    size_t avg_entries = data->_entries / data->_processed;
+    size_t scale = MAX2((size_t)1, (size_t)BitsPerWord / (avg_entries + 1));
+    max_step = MIN2<size_t>(max_step * scale, 160);
+  }
   size_t remaining = _block_count - start;
   size_t step = MIN2(max_step, 1 + (remaining / _estimated_thread_count));
   // Atomic::add with possible overshoot.  This can perform better
@@ -29,6 +29,7 @@
 #include "gc/shared/oopStorageParState.hpp"
 #include "metaprogramming/conditional.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/population_count.hpp"
 
 template<typename F>
 class OopStorage::BasicParState::AlwaysTrueFn {
@@ -45,6 +46,7 @@ struct OopStorage::BasicParState::IterationData {
   size_t _segment_start;
   size_t _segment_end;
   size_t _processed;
+  size_t _entries;              // entries seen in processed blocks
 };
 
 template<bool is_const, typename F>
@@ -59,6 +61,13 @@ inline void OopStorage::BasicParState::iterate(F f) {
     size_t i = data._segment_start;
     do {
       BlockPtr block = _active_array->at(i);
+      // Track the number of entries seen; claim_next_segment uses the
+      // fill ratio to size subsequent claims.
+      uintx bitmask = block->allocated_bitmask();
+      data._entries += population_count((uint32_t)bitmask);
+#ifdef _LP64
+      data._entries += population_count((uint32_t)(bitmask >> 32));
+#endif
       block->iterate(atf_f);
     } while (++i < data._segment_end);
   }
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_PARALLELSORT_HPP
+#define SHARE_GC_SHARED_PARALLELSORT_HPP
+
+#include "gc/shared/workgroup.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/quickSort.hpp"
+
+// Parallel sort for use by GC policy code that sorts large arrays inside
+// pauses with a worker gang at hand. The array is split into a power-of-two
+// number of chunks which the workers quick-sort concurrently; the sorted
+// chunks are then merged pairwise, one merge per claiming worker, in
+// log2(chunks) gang passes. The comparator contract is the same as for
+// QuickSort::sort. Arrays below the sequential cutoff, or sorts without a
+// gang, fall back to a plain quick sort on the calling thread, where the
+// gang dispatch overhead would exceed the sort itself.
+class ParallelSort : public AllStatic {
+
+  // Quick-sorts the chunks of the input array concurrently. Chunk bounds
+  // are precalculated by the caller; workers claim chunks by atomically
+  // incrementing the claim counter.
+  template <typename T, typename C>
+  class SortChunksTask : public AbstractGangTask {
+    T* const _array;
+    const size_t* const _bounds;  // _chunks + 1 chunk boundary indices.
+    const size_t _chunks;
+    C _comparator;
+    const bool _idempotent;
+    volatile size_t _claim;
+
+  public:
+    SortChunksTask(T* array, const size_t* bounds, size_t chunks, C comparator, bool idempotent) :
+      AbstractGangTask("Parallel Sort Chunks"),
+      _array(array), _bounds(bounds), _chunks(chunks),
+      _comparator(comparator), _idempotent(idempotent), _claim(0) { }
+
+    void work(uint worker_id) {
+      for (size_t i = Atomic::add((size_t)1, &_claim) - 1; i < _chunks;
+           i = Atomic::add((size_t)1, &_claim) - 1) {
+        QuickSort::sort(_array + _bounds[i], _bounds[i + 1] - _bounds[i],
+                        _comparator, _idempotent);
+      }
+    }
+  };
+
+  // Merges pairs of adjacent sorted runs of the given width (in chunks)
+  // from the source array into the destination array. Workers claim pairs
+  // by atomically incrementing the claim counter.
+  template <typename T, typename C>
+  class MergeRunsTask : public AbstractGangTask {
+    const T* const _src;
+    T* const _dst;
+    const size_t* const _bounds;
+    const size_t _chunks;
+    const size_t _width;    // Current run length in chunks.
+    C _comparator;
+    volatile size_t _claim;
+
+    void merge(size_t first_chunk) {
+      size_t lo  = _bounds[first_chunk];
+      size_t mid = _bounds[MIN2(first_chunk + _width, _chunks)];
+      size_t hi  = _bounds[MIN2(first_chunk + 2 * _width, _chunks)];
+      size_t a = lo;
+      size_t b = mid;
+      for (size_t out = lo; out < hi; out++) {
+        if (b == hi || (a < mid && _comparator(_src[a], _src[b]) <= 0)) {
+          _dst[out] = _src[a++];
+        } else {
+          _dst[out] = _src[b++];
+        }
+      }
+    }
+
+  public:
+    MergeRunsTask(const T* src, T* dst, const size_t* bounds, size_t chunks, size_t width, C comparator) :
+      AbstractGangTask("Parallel Sort Merge"),
+      _src(src), _dst(dst), _bounds(bounds), _chunks(chunks),
+      _width(width), _comparator(comparator), _claim(0) { }
+
+    void work(uint worker_id) {
+      for (size_t i = Atomic::add((size_t)1, &_claim) - 1; i * 2 * _width < _chunks;
+           i = Atomic::add((size_t)1, &_claim) - 1) {
+        merge(i * 2 * _width);
+      }
+    }
+  };
+
+public:
+  // Minimum number of elements per worker before going parallel. Below
+  // this the scratch allocation and gang dispatch dominate.
+  static const size_t SequentialCutoff = 4096;
+
+  template <typename T, typename C>
+  static void sort(WorkGang* workers, T* array, size_t length, C comparator, bool idempotent) {
+    uint num_workers = workers != NULL ? workers->active_workers() : 1;
+    size_t max_chunks = MIN2((size_t)num_workers, length / SequentialCutoff);
+    if (max_chunks < 2) {
+      QuickSort::sort(array, length, comparator, idempotent);
+      return;
+    }
+
+    // A power-of-two chunk count makes every merge pass pair up runs evenly.
+    size_t chunks = 1;
+    while (chunks * 2 <= max_chunks) {
+      chunks *= 2;
+    }
+
+    size_t* bounds = NEW_C_HEAP_ARRAY(size_t, chunks + 1, mtGC);
+    for (size_t i = 0; i <= chunks; i++) {
+      bounds[i] = length / chunks * i;
+    }
+    bounds[chunks] = length;
+
+    {
+      SortChunksTask<T, C> task(array, bounds, chunks, comparator, idempotent);
+      workers->run_task(&task);
+    }
+
+    // Merge passes ping-pong between the input array and a scratch buffer.
+    T* scratch = NEW_C_HEAP_ARRAY(T, length, mtGC);
+    T* src = array;
+    T* dst = scratch;
+    for (size_t width = 1; width < chunks; width *= 2) {
+      MergeRunsTask<T, C> task(src, dst, bounds, chunks, width, comparator);
+      workers->run_task(&task);
+      T* tmp = src;
+      src = dst;
+      dst = tmp;
+    }
+    if (src != array) {
+      // An odd number of merge passes left the result in the scratch buffer.
+      for (size_t i = 0; i < length; i++) {
+        array[i] = src[i];
+      }
+    }
+    FREE_C_HEAP_ARRAY(T, scratch);
+    FREE_C_HEAP_ARRAY(size_t, bounds);
+  }
+};
+
+#endif // SHARE_GC_SHARED_PARALLELSORT_HPP
@@ -26,26 +26,52 @@
 #include "gc/shared/preservedMarks.inline.hpp"
 #include "gc/shared/workgroup.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/arena.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "utilities/macros.hpp"
 
+void PreservedMarks::push_new_segment() {
+  if (_arena == NULL) {
+    // Marks are only preserved on evacuation failure, so the arena is
+    // created lazily. Start with a full-sized chunk, since a segment
+    // does not fit in the default initial chunk.
+    _arena = new (mtGC) Arena(mtGC, Chunk::size);
+  }
+  Segment* seg = (Segment*) _arena->Amalloc(sizeof(Segment));
+  seg->_next = _current;
+  seg->_used = 0;
+  _current = seg;
+}
+
 void PreservedMarks::restore() {
-  while (!_stack.is_empty()) {
-    const OopAndMarkOop elem = _stack.pop();
-    elem.set_mark();
+  for (Segment* seg = _current; seg != NULL; seg = seg->_next) {
+    for (size_t i = 0; i < seg->_used; i += 1) {
+      seg->_elems[i].set_mark();
+    }
   }
+
+  // Reclaim the segment memory in bulk by deleting the arena. Its
+  // chunks are returned to the global chunk pool for reuse.
+  if (_arena != NULL) {
+    delete _arena;
+    _arena = NULL;
+  }
+  _current = NULL;
+  _size = 0;
+
   assert_empty();
 }
 
 void PreservedMarks::adjust_during_full_gc() {
-  StackIterator<OopAndMarkOop, mtGC> iter(_stack);
-  while (!iter.is_empty()) {
-    OopAndMarkOop* elem = iter.next_addr();
-
-    oop obj = elem->get_oop();
-    if (obj->is_forwarded()) {
-      elem->set_oop(obj->forwardee());
+  for (Segment* seg = _current; seg != NULL; seg = seg->_next) {
+    for (size_t i = 0; i < seg->_used; i += 1) {
+      OopAndMarkOop* elem = &seg->_elems[i];
+
+      oop obj = elem->get_oop();
+      if (obj->is_forwarded()) {
+        elem->set_oop(obj->forwardee());
+      }
     }
   }
 }
@@ -61,11 +87,9 @@ void PreservedMarks::restore_and_increment(volatile size_t* const total_size_add
 
 #ifndef PRODUCT
 void PreservedMarks::assert_empty() {
-  assert(_stack.is_empty(), "stack expected to be empty, size = " SIZE_FORMAT,
-         _stack.size());
-  assert(_stack.cache_size() == 0,
-         "stack expected to have no cached segments, cache size = " SIZE_FORMAT,
-         _stack.cache_size());
+  assert(_size == 0, "expected no preserved marks, size = " SIZE_FORMAT, _size);
+  assert(_current == NULL && _arena == NULL,
+         "expected no segments or arena when empty");
 }
 #endif // ndef PRODUCT
 
@@ -28,8 +28,8 @@
 #include "memory/allocation.hpp"
 #include "memory/padded.hpp"
 #include "oops/oop.hpp"
-#include "utilities/stack.hpp"
 
+class Arena;
 class PreservedMarksSet;
 class WorkGang;
 
@@ -47,30 +47,49 @@ private:
     inline void set_mark() const;
     void set_oop(oop obj) { _o = obj; }
   };
-  typedef Stack<OopAndMarkOop, mtGC> OopAndMarkOopStack;
 
-  OopAndMarkOopStack _stack;
+  // Preserved marks are buffered in fixed-size segments, allocated from
+  // a lazily created arena whose chunks are served from (and returned to)
+  // the global chunk pool. This avoids a malloc/free per segment during
+  // an evacuation failure and makes reclaiming the buffers on restore a
+  // cheap bulk operation.
+  struct Segment {
+    // Sized so that a handful of segments fill a standard arena chunk.
+    static const size_t _capacity = 256;
+
+    Segment*      _next;
+    size_t        _used;
+    OopAndMarkOop _elems[_capacity];
+  };
+
+  Arena*   _arena;
+  // Head of the segment list. This is the only segment that may not be
+  // full; all others are.
+  Segment* _current;
+  size_t   _size;
 
   inline bool should_preserve_mark(oop obj, markOop m) const;
+  // Allocate a new segment, creating the arena first if necessary.
+  void push_new_segment();
 
 public:
-  size_t size() const { return _stack.size(); }
+  size_t size() const { return _size; }
   inline void push(oop obj, markOop m);
   inline void push_if_necessary(oop obj, markOop m);
-  // Iterate over the stack, restore all preserved marks, and
-  // reclaim the memory taken up by the stack segments.
+  // Iterate over all preserved marks, restore them, and
+  // reclaim the memory taken up by the segments.
   void restore();
-  // Iterate over the stack, adjust all preserved marks according
-  // to their forwarding location stored in the mark.
+  // Iterate over all preserved marks, adjust each one according
+  // to the forwarding location stored in the mark.
   void adjust_during_full_gc();
 
   void restore_and_increment(volatile size_t* const _total_size_addr);
   inline static void init_forwarded_mark(oop obj);
 
-  // Assert the stack is empty and has no cached segments.
+  // Assert no marks are preserved and no segments are allocated.
   void assert_empty() PRODUCT_RETURN;
 
-  inline PreservedMarks();
+  PreservedMarks() : _arena(NULL), _current(NULL), _size(0) { }
   ~PreservedMarks() { assert_empty(); }
 };
 
@@ -135,7 +154,7 @@ public:
   // Reclaim stack array.
   void reclaim();
 
-  // Assert all the stacks are empty and have no cached segments.
+  // Assert all the stacks are empty and have no segments allocated.
   void assert_empty() PRODUCT_RETURN;
 
   PreservedMarksSet(bool in_c_heap)
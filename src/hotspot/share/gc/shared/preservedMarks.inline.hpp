@@ -28,7 +28,6 @@
 #include "gc/shared/preservedMarks.hpp"
 #include "logging/log.hpp"
 #include "oops/oop.inline.hpp"
-#include "utilities/stack.inline.hpp"
 
 inline bool PreservedMarks::should_preserve_mark(oop obj, markOop m) const {
   return m->must_be_preserved_for_promotion_failure(obj);
@@ -36,8 +35,11 @@ inline bool PreservedMarks::should_preserve_mark(oop obj, markOop m) const {
 
 inline void PreservedMarks::push(oop obj, markOop m) {
   assert(should_preserve_mark(obj, m), "pre-condition");
-  OopAndMarkOop elem(obj, m);
-  _stack.push(elem);
+  if (_current == NULL || _current->_used == Segment::_capacity) {
+    push_new_segment();
+  }
+  _current->_elems[_current->_used++] = OopAndMarkOop(obj, m);
+  _size++;
 }
 
 inline void PreservedMarks::push_if_necessary(oop obj, markOop m) {
@@ -71,14 +73,6 @@ inline void PreservedMarksSet::restore(RestorePreservedMarksTaskExecutor* execut
   log_trace(gc)("Restored " SIZE_FORMAT " marks", total_size);
 }
 
-inline PreservedMarks::PreservedMarks()
-    : _stack(OopAndMarkOopStack::default_segment_size(),
-             // This stack should be used very infrequently so there's
-             // no point in caching stack segments (there will be a
-             // waste of space most of the time). So we set the max
-             // cache size to 0.
-             0 /* max_cache_size */) { }
-
 void PreservedMarks::OopAndMarkOop::set_mark() const {
   _o->set_mark_raw(_m);
 }
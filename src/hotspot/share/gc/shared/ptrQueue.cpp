@@ -331,6 +331,38 @@ BufferNode* PtrQueueSet::get_completed_buffer(size_t stop_at) {
   return bn;
 }
 
+BufferNode* PtrQueueSet::get_completed_buffers(size_t stop_at, size_t max_batch, size_t* actual) {
+  assert(max_batch > 0, "precondition");
+  MutexLocker x(_cbl_mon, Mutex::_no_safepoint_check_flag);
+
+  if (_n_completed_buffers <= stop_at) {
+    *actual = 0;
+    return NULL;
+  }
+
+  assert(_n_completed_buffers > 0, "invariant");
+  assert(_completed_buffers_head != NULL, "invariant");
+  assert(_completed_buffers_tail != NULL, "invariant");
+
+  size_t take = MIN2(max_batch, _n_completed_buffers - stop_at);
+  BufferNode* head = _completed_buffers_head;
+  BufferNode* last = head;
+  for (size_t i = 1; i < take; ++i) {
+    last = last->next();
+  }
+  _n_completed_buffers -= take;
+  _completed_buffers_head = last->next();
+  if (_completed_buffers_head == NULL) {
+    assert(_n_completed_buffers == 0, "invariant");
+    _completed_buffers_tail = NULL;
+    _process_completed_buffers = false;
+  }
+  assert_completed_buffers_list_len_correct_locked();
+  last->set_next(NULL);
+  *actual = take;
+  return head;
+}
+
 void PtrQueueSet::abandon_completed_buffers() {
   BufferNode* buffers_to_delete = NULL;
   {
@@ -345,6 +345,15 @@ public:
   // return a completed buffer from the list.  Otherwise, return NULL.
   BufferNode* get_completed_buffer(size_t stop_at = 0);
 
+  // If the number of completed buffers is > stop_at, then remove and
+  // return a chain of up to max_batch completed buffers, linked through
+  // their next fields and NULL-terminated, leaving at least stop_at
+  // buffers on the list.  The number of buffers removed is returned in
+  // *actual.  Otherwise, set *actual to zero and return NULL.  Claiming
+  // a batch takes the list lock only once, reducing contention on the
+  // lock for consumers that process several buffers at a time.
+  BufferNode* get_completed_buffers(size_t stop_at, size_t max_batch, size_t* actual);
+
   bool process_completed_buffers() { return _process_completed_buffers; }
   void set_process_completed_buffers(bool x) { _process_completed_buffers = x; }
 
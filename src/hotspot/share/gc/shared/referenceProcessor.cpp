@@ -31,6 +31,7 @@
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/referencePolicy.hpp"
 #include "gc/shared/referenceProcessor.inline.hpp"
+#include "gc/shared/referenceProcessorCounters.hpp"
 #include "gc/shared/referenceProcessorPhaseTimes.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
@@ -46,6 +47,7 @@ jlong            ReferenceProcessor::_soft_ref_timestamp_clock = 0;
 
 void referenceProcessor_init() {
   ReferenceProcessor::init_statics();
+  ReferenceProcessorCounters::initialize();
 }
 
 void ReferenceProcessor::init_statics() {
@@ -257,6 +259,8 @@ ReferenceProcessorStats ReferenceProcessor::process_discovered_references(
 
   phase_times->set_total_time_ms((os::elapsedTime() - start_time) * 1000);
 
+  ReferenceProcessorCounters::update(stats, phase_times);
+
   return stats;
 }
 
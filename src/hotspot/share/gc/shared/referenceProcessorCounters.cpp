@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jvm.h"
+#include "gc/shared/gcId.hpp"
+#include "gc/shared/referenceProcessorCounters.hpp"
+#include "gc/shared/referenceProcessorPhaseTimes.hpp"
+#include "gc/shared/referenceProcessorStats.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
+#include "runtime/perfData.hpp"
+#include "utilities/exceptions.hpp"
+
+PerfCounter*  ReferenceProcessorCounters::_discovered[number_of_subclasses_of_ref] = { NULL };
+PerfCounter*  ReferenceProcessorCounters::_enqueued[number_of_subclasses_of_ref] = { NULL };
+PerfVariable* ReferenceProcessorCounters::_pending_list_depth = NULL;
+
+size_t ReferenceProcessorCounters::_previous_depth = 0;
+uint   ReferenceProcessorCounters::_growths = 0;
+
+// indexed by ReferenceType - REF_SOFT
+static const char* const ref_type_names[] = { "soft", "weak", "final", "phantom" };
+
+// A pathological backlog can hold millions of references; the pending list
+// walk saturates at this depth so that sampling cannot meaningfully extend
+// the pause.
+static const size_t max_sampled_pending_list_depth = 1000000;
+
+void ReferenceProcessorCounters::initialize() {
+  if (!UsePerfData) {
+    return;
+  }
+
+  EXCEPTION_MARK;
+  ResourceMark rm;
+
+  for (int i = 0; i < number_of_subclasses_of_ref; i++) {
+    char name[64];
+    jio_snprintf(name, sizeof(name), "refProc.%sDiscovered", ref_type_names[i]);
+    _discovered[i] = PerfDataManager::create_counter(SUN_GC, name,
+                                                     PerfData::U_Events, CHECK);
+    jio_snprintf(name, sizeof(name), "refProc.%sEnqueued", ref_type_names[i]);
+    _enqueued[i] = PerfDataManager::create_counter(SUN_GC, name,
+                                                   PerfData::U_Events, CHECK);
+  }
+
+  _pending_list_depth = PerfDataManager::create_variable(SUN_GC,
+                                                         "refProc.pendingListDepth",
+                                                         PerfData::U_Events, CHECK);
+}
+
+void ReferenceProcessorCounters::update_type(ReferenceType ref_type,
+                                             size_t discovered,
+                                             size_t enqueued) {
+  const int index = ref_type - REF_SOFT;
+  assert(index >= 0 && index < number_of_subclasses_of_ref, "invariant");
+
+  if (UsePerfData && _discovered[index] != NULL) {
+    _discovered[index]->inc((jlong)discovered);
+    _enqueued[index]->inc((jlong)enqueued);
+  }
+
+  EventGCReferenceProcessing event;
+  if (event.should_commit()) {
+    event.set_gcId(GCId::current());
+    event.set_type((u1)ref_type);
+    event.set_discovered(discovered);
+    event.set_enqueued(enqueued);
+    event.commit();
+  }
+}
+
+void ReferenceProcessorCounters::sample_pending_list() {
+  const size_t depth = Universe::reference_pending_list_depth(max_sampled_pending_list_depth);
+
+  if (UsePerfData && _pending_list_depth != NULL) {
+    _pending_list_depth->set_value((jlong)depth);
+  }
+
+  if (depth > _previous_depth) {
+    _growths++;
+  } else {
+    _growths = 0;
+  }
+  _previous_depth = depth;
+
+  if (RefPendingListGrowthWarningThreshold != 0 &&
+      _growths >= RefPendingListGrowthWarningThreshold) {
+    EventReferencePendingListBacklog event;
+    if (event.should_commit()) {
+      event.set_gcId(GCId::current());
+      event.set_depth(depth);
+      event.set_growths(_growths);
+      event.commit();
+    }
+  }
+}
+
+void ReferenceProcessorCounters::update(const ReferenceProcessorStats& stats,
+                                        const ReferenceProcessorPhaseTimes* phase_times) {
+  // References dropped from the discovered lists are counted as cleared;
+  // the remainder were enqueued onto the java.lang.ref pending list.
+  const size_t counts[number_of_subclasses_of_ref] = {
+    stats.soft_count(), stats.weak_count(), stats.final_count(), stats.phantom_count()
+  };
+  for (int i = 0; i < number_of_subclasses_of_ref; i++) {
+    const ReferenceType ref_type = (ReferenceType)(REF_SOFT + i);
+    const size_t discovered = counts[i];
+    const size_t cleared = phase_times->ref_cleared(ref_type);
+    const size_t enqueued = discovered >= cleared ? discovered - cleared : 0;
+    update_type(ref_type, discovered, enqueued);
+  }
+  sample_pending_list();
+}
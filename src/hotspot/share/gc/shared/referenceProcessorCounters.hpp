@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_REFERENCEPROCESSORCOUNTERS_HPP
+#define SHARE_GC_SHARED_REFERENCEPROCESSORCOUNTERS_HPP
+
+#include "memory/allocation.hpp"
+#include "memory/referenceType.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class PerfCounter;
+class PerfVariable;
+class ReferenceProcessorPhaseTimes;
+class ReferenceProcessorStats;
+
+// Instrumentation surface for reference processing. Exports per reference
+// kind discovered/enqueued counts and the depth of the java.lang.ref
+// pending list via perfdata counters and JFR events, and emits a warning
+// event when the pending list keeps growing across garbage collections -
+// a sign that java-side reference processing, including finalization, is
+// not keeping up with the rate at which references become pending.
+class ReferenceProcessorCounters : public AllStatic {
+ private:
+  static const int number_of_subclasses_of_ref = REF_PHANTOM - REF_OTHER; // 5 - 1 = 4
+
+  static PerfCounter*  _discovered[number_of_subclasses_of_ref];
+  static PerfCounter*  _enqueued[number_of_subclasses_of_ref];
+  static PerfVariable* _pending_list_depth;
+
+  static size_t _previous_depth;
+  static uint   _growths;    // consecutive collections with a deeper pending list
+
+  static void update_type(ReferenceType ref_type, size_t discovered, size_t enqueued);
+  static void sample_pending_list();
+
+ public:
+  // creates the perfdata counters; called from referenceProcessor_init()
+  static void initialize();
+
+  // called at the end of reference processing, while still at a safepoint
+  static void update(const ReferenceProcessorStats& stats,
+                     const ReferenceProcessorPhaseTimes* phase_times);
+};
+
+#endif // SHARE_GC_SHARED_REFERENCEPROCESSORCOUNTERS_HPP
@@ -254,6 +254,16 @@ void ReferenceProcessorPhaseTimes::set_ref_discovered(ReferenceType ref_type, si
   _ref_discovered[ref_type_2_index(ref_type)] = count;
 }
 
+size_t ReferenceProcessorPhaseTimes::ref_cleared(ReferenceType ref_type) const {
+  ASSERT_REF_TYPE(ref_type);
+  return _ref_cleared[ref_type_2_index(ref_type)];
+}
+
+size_t ReferenceProcessorPhaseTimes::ref_discovered(ReferenceType ref_type) const {
+  ASSERT_REF_TYPE(ref_type);
+  return _ref_discovered[ref_type_2_index(ref_type)];
+}
+
 double ReferenceProcessorPhaseTimes::balance_queues_time_ms(ReferenceProcessor::RefProcPhases phase) const {
   ASSERT_PHASE(phase);
   return _balance_queues_time_ms[phase];
@@ -91,6 +91,9 @@ public:
   void add_ref_cleared(ReferenceType ref_type, size_t count);
   void set_ref_discovered(ReferenceType ref_type, size_t count);
 
+  size_t ref_cleared(ReferenceType ref_type) const;
+  size_t ref_discovered(ReferenceType ref_type) const;
+
   void set_balance_queues_time_ms(ReferenceProcessor::RefProcPhases phase, double time_ms);
 
   void set_processing_is_mt(bool processing_is_mt) { _processing_is_mt = processing_is_mt; }
@@ -163,24 +163,22 @@ inline void SATBMarkQueue::apply_filter(Filter filter_out) {
     return;
   }
 
-  // Two-fingered compaction toward the end.
-  void** src = &buf[this->index()];
-  void** dst = &buf[this->capacity()];
-  assert(src <= dst, "invariant");
-  for ( ; src < dst; ++src) {
-    // Search low to high for an entry to keep.
-    void* entry = *src;
-    if (!filter_out(entry)) {
-      // Found keeper.  Search high to low for an entry to discard.
-      while (src < --dst) {
-        if (filter_out(*dst)) {
-          *dst = entry;         // Replace discard with keeper.
-          break;
-        }
-      }
-      // If discard search failed (src == dst), the outer loop will also end.
-    }
+  // Single-pass compaction toward the end. Each entry is unconditionally
+  // stored at the destination finger, and the finger only advances when the
+  // entry is retained. Filtering decisions are near random with respect to
+  // the branch predictor, so a conditional increment is cheaper here than
+  // branching around the store. The destination never passes the source:
+  // their distance is the number of entries filtered out so far.
+  void** const begin = &buf[this->index()];
+  void** src = &buf[this->capacity()];
+  void** dst = src;
+  while (src > begin) {
+    void* entry = *--src;
+    --dst;
+    *dst = entry;
+    dst += filter_out(entry) ? 1 : 0;
   }
+  assert(begin <= dst, "invariant");
   // dst points to the lowest retained entry, or the end of the buffer
   // if all the entries were filtered out.
   this->set_index(dst - buf);
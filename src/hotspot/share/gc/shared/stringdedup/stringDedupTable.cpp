@@ -35,6 +35,7 @@
 #include "oops/arrayOop.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/typeArrayOop.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/safepointVerifiers.hpp"
 
@@ -207,6 +208,7 @@ StringDedupEntryCache*   StringDedupTable::_entry_cache = NULL;
 
 const size_t             StringDedupTable::_min_size = (1 << 10);   // 1024
 const size_t             StringDedupTable::_max_size = (1 << 24);   // 16777216
+const size_t             StringDedupTable::_num_stripes = 16;       // Power of 2, not larger than _min_size
 const double             StringDedupTable::_grow_load_factor = 2.0; // Grow table at 200% load
 const double             StringDedupTable::_shrink_load_factor = _grow_load_factor / 3.0; // Shrink table at 67% load
 const double             StringDedupTable::_max_cache_factor = 0.1; // Cache a maximum of 10% of the table size
@@ -221,6 +223,7 @@ uintx                    StringDedupTable::_rehash_count = 0;
 StringDedupTable*        StringDedupTable::_resized_table = NULL;
 StringDedupTable*        StringDedupTable::_rehashed_table = NULL;
 volatile size_t          StringDedupTable::_claimed_index = 0;
+Mutex**                  StringDedupTable::_stripe_locks = NULL;
 
 StringDedupTable::StringDedupTable(size_t size, jint hash_seed) :
   _size(size),
@@ -240,18 +243,30 @@ StringDedupTable::~StringDedupTable() {
 
 void StringDedupTable::create() {
   assert(_table == NULL, "One string deduplication table allowed");
+  assert(is_power_of_2(_num_stripes), "Stripe count must be a power of 2");
+  assert(_num_stripes <= _min_size, "More stripes than buckets");
+  _stripe_locks = NEW_C_HEAP_ARRAY(Mutex*, _num_stripes, mtGC);
+  for (size_t i = 0; i < _num_stripes; i++) {
+    _stripe_locks[i] = new Mutex(Mutex::leaf + 1, "StringDedupTableStripe", true, Monitor::_safepoint_check_never);
+  }
   _entry_cache = new StringDedupEntryCache(_min_size * _max_cache_factor);
   _table = new StringDedupTable(_min_size);
 }
 
 void StringDedupTable::add(typeArrayOop value, bool latin1, unsigned int hash, StringDedupEntry** list) {
-  StringDedupEntry* entry = _entry_cache->alloc();
+  StringDedupEntry* entry;
+  {
+    // The entry cache only supports single-threaded allocations, which the
+    // bucket stripe locks do not guarantee.
+    MutexLocker ml(StringDedupTable_lock, Mutex::_no_safepoint_check_flag);
+    entry = _entry_cache->alloc();
+  }
   entry->set_obj(value);
   entry->set_hash(hash);
   entry->set_latin1(latin1);
   entry->set_next(*list);
   *list = entry;
-  _entries++;
+  Atomic::inc(&_entries);
 }
 
 void StringDedupTable::remove(StringDedupEntry** pentry, uint worker_id) {
@@ -306,7 +321,7 @@ typeArrayOop StringDedupTable::lookup_or_add_inner(typeArrayOop value, bool lati
     add(value, latin1, hash, list);
 
     // Update statistics
-    _entries_added++;
+    Atomic::inc(&_entries_added);
   }
 
   return existing_value;
@@ -476,11 +491,10 @@ void StringDedupTable::unlink_or_oops_do(StringDedupUnlinkOrOopsDoClosure* cl, u
     removed += unlink_or_oops_do(cl, table_half + partition_begin, table_half + partition_end, worker_id);
   }
 
-  // Delayed update to avoid contention on the table lock
+  // Delayed update to avoid contention on the counters
   if (removed > 0) {
-    MutexLocker ml(StringDedupTable_lock, Mutex::_no_safepoint_check_flag);
-    _table->_entries -= removed;
-    _entries_removed += removed;
+    Atomic::sub(removed, &_table->_entries);
+    Atomic::add(removed, &_entries_removed);
   }
 }
 
@@ -105,10 +105,14 @@ public:
 // The table is also dynamically rehashed (using a new hash seed) if it becomes severely
 // unbalanced, i.e., a hash chain is significantly longer than average.
 //
-// All access to the table is protected by the StringDedupTable_lock, except under
-// safepoints in which case GC workers are allowed to access a table partitions they
-// have claimed without first acquiring the lock. Note however, that this applies only
-// the table partition (i.e. a range of elements in _buckets), not other parts of the
+// Access to the hash buckets is protected by a set of striped locks, where a
+// bucket is protected by the lock corresponding to its index modulo the number
+// of stripes. This allows multiple threads to deduplicate concurrently, as long
+// as their strings hash to different stripes. Allocation of table entries is
+// still serialized by the StringDedupTable_lock. Under safepoints GC workers
+// are allowed to access table partitions they have claimed without first
+// acquiring any lock. Note however, that this applies only to the table
+// partition (i.e. a range of elements in _buckets), not other parts of the
 // table such as the _entries field, statistics counters, etc.
 //
 class StringDedupTable : public CHeapObj<mtGC> {
@@ -150,6 +154,12 @@ private:
 
   static volatile size_t          _claimed_index;
 
+  // Striped locks protecting the hash buckets. Since the table size is
+  // always a power of two not smaller than the number of stripes, the
+  // stripe a bucket maps to is invariant across resizing.
+  static const size_t             _num_stripes;
+  static Mutex**                  _stripe_locks;
+
   static StringDedupTable*        _resized_table;
   static StringDedupTable*        _rehashed_table;
 
@@ -166,6 +176,11 @@ private:
     return (size_t)hash & (_size - 1);
   }
 
+  // Returns the lock protecting the hash bucket for the given hash code.
+  static Mutex* stripe_lock(unsigned int hash) {
+    return _stripe_locks[(size_t)hash & (_num_stripes - 1)];
+  }
+
   // Adds a new table entry to the given hash bucket.
   void add(typeArrayOop value, bool latin1, unsigned int hash, StringDedupEntry** list);
 
@@ -186,10 +201,11 @@ private:
 
   // Thread safe lookup or add of table entry
   static typeArrayOop lookup_or_add(typeArrayOop value, bool latin1, unsigned int hash) {
-    // Protect the table from concurrent access. Also note that this lock
-    // acts as a fence for _table, which could have been replaced by a new
-    // instance if the table was resized or rehashed.
-    MutexLocker ml(StringDedupTable_lock, Mutex::_no_safepoint_check_flag);
+    // Protect the hash bucket from concurrent access. _table could have been
+    // replaced by a new instance if the table was resized or rehashed, but
+    // that only happens inside safepoints, which act as a fence for threads
+    // resuming after them.
+    MutexLocker ml(stripe_lock(hash), Mutex::_no_safepoint_check_flag);
     return _table->lookup_or_add_inner(value, latin1, hash);
   }
 
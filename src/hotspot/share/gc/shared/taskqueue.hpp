@@ -312,6 +312,13 @@ private:
   int _seed; // Current random seed used for selecting a random queue during stealing.
 
   DEFINE_PAD_MINUS_SIZE(2, DEFAULT_CACHE_LINE_SIZE, sizeof(uint) + sizeof(int));
+
+  // NUMA node the owning thread last observed itself running on. Written by
+  // the owner when it enters stealing, racily read by other threads for
+  // locality-aware steal victim selection.
+  volatile int _owner_numa_id;
+
+  DEFINE_PAD_MINUS_SIZE(3, DEFAULT_CACHE_LINE_SIZE, sizeof(int));
 public:
   int next_random_queue_id();
 
@@ -319,10 +326,13 @@ public:
   uint last_stolen_queue_id() const          { return _last_stolen_queue_id; }
   bool is_last_stolen_queue_id_valid() const { return _last_stolen_queue_id != InvalidQueueId; }
   void invalidate_last_stolen_queue_id()     { _last_stolen_queue_id = InvalidQueueId; }
+
+  void set_owner_numa_id(int numa_id)        { _owner_numa_id = numa_id; }
+  int owner_numa_id() const                  { return _owner_numa_id; }
 };
 
 template<class E, MEMFLAGS F, unsigned int N>
-GenericTaskQueue<E, F, N>::GenericTaskQueue() : _last_stolen_queue_id(InvalidQueueId), _seed(17 /* random number */) {
+GenericTaskQueue<E, F, N>::GenericTaskQueue() : _last_stolen_queue_id(InvalidQueueId), _seed(17 /* random number */), _owner_numa_id(-1) {
   assert(sizeof(Age) == sizeof(size_t), "Depends on this.");
 }
 
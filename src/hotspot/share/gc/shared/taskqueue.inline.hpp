@@ -30,6 +30,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/stack.inline.hpp"
 
@@ -274,6 +275,25 @@ GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
     uint sz1 = _queues[k1]->size();
     uint sz2 = _queues[k2]->size();
 
+    // On NUMA machines, when both candidates have work, prefer the victim
+    // whose owner was last seen running on the same node as this thread:
+    // cross-node steals pull the task data over the interconnect. Remote
+    // victims are still taken when the local candidate has no work, so
+    // remote queues get drained once the local ones are exhausted.
+    if (UseNUMA && sz1 > 0 && sz2 > 0) {
+      const int numa_id = local_queue->owner_numa_id();
+      const bool k1_local = _queues[k1]->owner_numa_id() == numa_id;
+      const bool k2_local = _queues[k2]->owner_numa_id() == numa_id;
+      if (k1_local != k2_local) {
+        // Pretend the remote victim has no work for the selection below
+        if (k1_local) {
+          sz2 = 0;
+        } else {
+          sz1 = 0;
+        }
+      }
+    }
+
     uint sel_k = 0;
     bool suc = false;
 
@@ -304,6 +324,12 @@ GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
 
 template<class T, MEMFLAGS F> bool
 GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
+  // Refresh our own location, both for other stealers and for our victim
+  // selection. This is cheap enough to do once per steal cycle, which only
+  // starts after the local queue has run dry.
+  if (UseNUMA) {
+    queue(queue_num)->set_owner_numa_id(os::numa_get_group_id());
+  }
   for (uint i = 0; i < 2 * _n; i++) {
     TASKQUEUE_STATS_ONLY(queue(queue_num)->stats.record_steal_attempt());
     if (steal_best_of_2(queue_num, t)) {
@@ -82,6 +82,16 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
     assert(_number_of_refills == 0 && _fast_refill_waste == 0 &&
            _slow_refill_waste == 0 && _gc_waste          == 0,
            "tlab stats == 0");
+
+    // The thread had no refills this interval. Without a sample, the
+    // allocation fraction stays frozen at whatever an earlier allocation
+    // burst earned, and resize() keeps granting this thread a large TLAB
+    // that sits mostly empty until it is retired at GC. Decay the fraction
+    // toward zero for threads that stopped allocating, so idle threads
+    // shrink to small TLABs while persistent allocators keep their size.
+    if (ResizeTLAB && allocated_since_last_gc == 0) {
+      _allocation_fraction.sample(0.0);
+    }
   }
 
   stats->update_slow_allocations(_slow_allocations);
@@ -31,6 +31,7 @@
 #include "gc/shared/weakProcessorPhaseTimes.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/iterator.hpp"
+#include "prims/jvmtiExport.hpp"
 #include "prims/resolvedMethodTable.hpp"
 #include "runtime/globals.hpp"
 #include "utilities/macros.hpp"
@@ -116,6 +117,7 @@ void WeakProcessor::Task::initialize() {
   }
   StringTable::reset_dead_counter();
   ResolvedMethodTable::reset_dead_counter();
+  JVMTI_ONLY(JvmtiExport::weak_oops_do_prologue();)
 }
 
 WeakProcessor::Task::Task(uint nworkers) :
@@ -147,6 +149,16 @@ WeakProcessor::Task::~Task() {
   }
   StringTable::finish_dead_counter();
   ResolvedMethodTable::finish_dead_counter();
+#if INCLUDE_JVMTI
+  // All workers have finished sweeping the JVMTI tag maps; dispose of the
+  // entries they unlinked and record the summary for the phase.
+  size_t num_dead = 0;
+  size_t num_total = 0;
+  JvmtiExport::weak_oops_do_epilogue(&num_dead, &num_total);
+  if (_phase_times != NULL) {
+    _phase_times->record_phase_items(WeakProcessorPhases::jvmti, num_dead, num_total);
+  }
+#endif // INCLUDE_JVMTI
 }
 
 void WeakProcessor::GangTask::work(uint worker_id) {
@@ -32,6 +32,7 @@
 #include "gc/shared/weakProcessorPhases.hpp"
 #include "gc/shared/weakProcessorPhaseTimes.hpp"
 #include "gc/shared/workgroup.hpp"
+#include "prims/jvmtiExport.hpp"
 #include "prims/resolvedMethodTable.hpp"
 #include "utilities/debug.hpp"
 
@@ -96,6 +97,18 @@ void WeakProcessor::Task::work(uint worker_id,
 
   FOR_EACH_WEAK_PROCESSOR_PHASE(phase) {
     if (WeakProcessorPhases::is_serial(phase)) {
+#if INCLUDE_JVMTI
+      if (phase == WeakProcessorPhases::jvmti) {
+        // Every worker helps sweep the JVMTI tag maps; the work is claimed
+        // internally in chunks of hash buckets, so all participants finish
+        // within one chunk of each other and worker 0's elapsed time is a
+        // good approximation of the phase time. Dead and total counts are
+        // recorded once the sweep is completed, in the Task destructor.
+        WeakProcessorPhaseTimeTracker pt((worker_id == 0) ? _phase_times : NULL, phase);
+        JvmtiExport::weak_oops_do_parallel(is_alive, keep_alive);
+        continue;
+      }
+#endif // INCLUDE_JVMTI
       CountingIsAliveClosure<IsAlive> cl(is_alive);
       uint serial_index = WeakProcessorPhases::serial_index(phase);
       if (_serial_phases_done.try_claim_task(serial_index)) {
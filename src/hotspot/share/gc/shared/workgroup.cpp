@@ -246,6 +246,75 @@ class MutexGangTaskDispatcher : public GangTaskDispatcher {
   }
 };
 
+WorkGangPhaseScaler::WorkGangPhaseScaler() : _nphases(0) {}
+
+WorkGangPhaseScaler::Phase* WorkGangPhaseScaler::phase_for(const char* name) {
+  for (uint i = 0; i < _nphases; i++) {
+    if (strcmp(_phases[i]._name, name) == 0) {
+      return &_phases[i];
+    }
+  }
+  if (_nphases < MaxPhases) {
+    Phase* p = &_phases[_nphases++];
+    p->_name = name;
+    p->_workers = 0;
+    p->_probe = 0;
+    p->_runs = 0;
+    p->_avg_ms = 0.0;
+    return p;
+  }
+  // Table full, leave the remaining phases unscaled
+  return NULL;
+}
+
+uint WorkGangPhaseScaler::recommend_workers(const char* name, uint max_workers) {
+  Phase* p = phase_for(name);
+  if (p == NULL) {
+    return max_workers;
+  }
+  if (p->_workers == 0 || p->_workers > max_workers) {
+    // First run, or the active worker cap shrank: restart from the maximum
+    p->_workers = max_workers;
+    p->_avg_ms = 0.0;
+  }
+  p->_probe = 0;
+  if (p->_avg_ms > 0.0) {
+    if ((p->_runs % ProbeUpInterval) == (ProbeUpInterval - 1) && p->_workers < max_workers) {
+      p->_probe = p->_workers + 1;
+    } else if ((p->_runs % ProbeDownInterval) == (ProbeDownInterval - 1) && p->_workers > 1) {
+      p->_probe = p->_workers - 1;
+    }
+  }
+  return (p->_probe != 0) ? p->_probe : p->_workers;
+}
+
+void WorkGangPhaseScaler::report_duration(const char* name, uint num_workers, double duration_ms) {
+  Phase* p = phase_for(name);
+  if (p == NULL) {
+    return;
+  }
+  p->_runs++;
+  if (num_workers == p->_probe) {
+    // Probe run. Adopt the probed worker count if the duration did not
+    // regress noticeably. The 5% slack absorbs run-to-run noise; a bad
+    // adoption is corrected by subsequent probes in the other direction.
+    if (duration_ms <= p->_avg_ms * 1.05) {
+      log_debug(gc, task)("%s: scaling workers %u -> %u (%.3lfms vs %.3lfms avg)",
+                          name, p->_workers, num_workers, duration_ms, p->_avg_ms);
+      p->_workers = num_workers;
+      p->_avg_ms = duration_ms;
+    }
+    p->_probe = 0;
+    return;
+  }
+  // Decaying average duration at the selected worker count, favoring recent runs
+  if (p->_avg_ms == 0.0) {
+    p->_avg_ms = duration_ms;
+  } else {
+    p->_avg_ms = p->_avg_ms * 0.7 + duration_ms * 0.3;
+  }
+}
+
 static GangTaskDispatcher* create_dispatcher() {
   if (UseSemaphoreGCThreadsSynchronization) {
     return new SemaphoreGangTaskDispatcher();
@@ -259,11 +328,13 @@ WorkGang::WorkGang(const char* name,
                    bool  are_GC_task_threads,
                    bool  are_ConcurrentGC_threads) :
     AbstractWorkGang(name, workers, are_GC_task_threads, are_ConcurrentGC_threads),
-    _dispatcher(create_dispatcher())
+    _dispatcher(create_dispatcher()),
+    _phase_scaler(UseGCPhaseWorkerScaling ? new WorkGangPhaseScaler() : NULL)
 { }
 
 WorkGang::~WorkGang() {
   delete _dispatcher;
+  delete _phase_scaler;
 }
 
 AbstractGangWorker* WorkGang::allocate_worker(uint worker_id) {
@@ -271,6 +342,16 @@ AbstractGangWorker* WorkGang::allocate_worker(uint worker_id) {
 }
 
 void WorkGang::run_task(AbstractGangTask* task) {
+  if (_phase_scaler != NULL) {
+    // Let per-phase history cap the worker count: workers that are not
+    // dispatched stay parked on the dispatcher and leave their cores to
+    // the application.
+    uint num_workers = _phase_scaler->recommend_workers(task->name(), active_workers());
+    double start = os::elapsedTime();
+    run_task(task, num_workers);
+    _phase_scaler->report_duration(task->name(), num_workers, (os::elapsedTime() - start) * 1000.0);
+    return;
+  }
   run_task(task, active_workers());
 }
 
@@ -197,6 +197,43 @@ class AbstractWorkGang : public CHeapObj<mtInternal> {
   virtual AbstractGangWorker* allocate_worker(uint which) = 0;
 };
 
+// Scales the number of active workers per task (phase), based on measured
+// durations of earlier runs of the same task. Parallel phases differ vastly
+// in available parallelism, and running a low-parallelism phase with all
+// workers only burns cycles in the termination protocol. The scaler hill
+// climbs per phase: it periodically probes a lower or higher worker count,
+// and adopts it when the measured duration does not regress. State is only
+// accessed by the coordinator thread running the gang, so no synchronization
+// is needed.
+class WorkGangPhaseScaler : public CHeapObj<mtGC> {
+  struct Phase {
+    const char* _name;       // Task name, identifies the phase
+    uint        _workers;    // Currently selected number of workers
+    uint        _probe;      // Worker count being probed, 0 if none
+    uint        _runs;       // Number of runs observed for this phase
+    double      _avg_ms;     // Decaying average duration at _workers
+  };
+
+  static const uint MaxPhases = 32;
+  // Probe a lower/higher worker count every this many runs
+  static const uint ProbeDownInterval = 8;
+  static const uint ProbeUpInterval   = 32;
+
+  Phase _phases[MaxPhases];
+  uint  _nphases;
+
+  Phase* phase_for(const char* name);
+
+public:
+  WorkGangPhaseScaler();
+
+  // Returns the number of workers to run the named task with, at most max_workers.
+  uint recommend_workers(const char* name, uint max_workers);
+
+  // Report the measured duration of running the named task with num_workers.
+  void report_duration(const char* name, uint num_workers, double duration_ms);
+};
+
 // An class representing a gang of workers.
 class WorkGang: public AbstractWorkGang {
   // To get access to the GangTaskDispatcher instance.
@@ -207,6 +244,9 @@ class WorkGang: public AbstractWorkGang {
     return _dispatcher;
   }
 
+  // Per-phase worker scaling, NULL unless UseGCPhaseWorkerScaling.
+  WorkGangPhaseScaler* const _phase_scaler;
+
 public:
   WorkGang(const char* name,
            uint workers,
@@ -23,13 +23,13 @@
 
 #include "precompiled.hpp"
 
+#include "gc/shared/parallelSort.hpp"
 #include "gc/shenandoah/heuristics/shenandoahAdaptiveHeuristics.hpp"
 #include "gc/shenandoah/shenandoahCollectionSet.hpp"
 #include "gc/shenandoah/shenandoahFreeSet.hpp"
 #include "gc/shenandoah/shenandoahHeapRegion.hpp"
 #include "logging/log.hpp"
 #include "logging/logTag.hpp"
-#include "utilities/quickSort.hpp"
 
 ShenandoahAdaptiveHeuristics::ShenandoahAdaptiveHeuristics() :
   ShenandoahHeuristics(),
@@ -82,7 +82,7 @@ void ShenandoahAdaptiveHeuristics::choose_collection_set_from_regiondata(Shenand
                      free_target / M, actual_free / M, max_cset / M, min_garbage / M);
 
   // Better select garbage-first regions
-  QuickSort::sort<RegionData>(data, (int)size, compare_by_garbage, false);
+  ParallelSort::sort<RegionData>(ShenandoahHeap::heap()->workers(), data, size, compare_by_garbage, false);
 
   size_t cur_cset = 0;
   size_t cur_garbage = 0;
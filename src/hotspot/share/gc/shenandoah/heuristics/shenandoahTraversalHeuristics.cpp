@@ -23,6 +23,7 @@
 
 #include "precompiled.hpp"
 
+#include "gc/shared/parallelSort.hpp"
 #include "gc/shenandoah/heuristics/shenandoahTraversalHeuristics.hpp"
 #include "gc/shenandoah/shenandoahCollectionSet.hpp"
 #include "gc/shenandoah/shenandoahFreeSet.hpp"
@@ -31,7 +32,6 @@
 #include "gc/shenandoah/shenandoahTraversalGC.hpp"
 #include "logging/log.hpp"
 #include "logging/logTag.hpp"
-#include "utilities/quickSort.hpp"
 
 ShenandoahTraversalHeuristics::ShenandoahTraversalHeuristics() : ShenandoahHeuristics(),
   _last_cset_select(0)
@@ -128,7 +128,7 @@ void ShenandoahTraversalHeuristics::choose_collection_set(ShenandoahCollectionSe
                      free_target / M, actual_free / M, max_cset / M, min_garbage / M);
 
   // Better select garbage-first regions, and then older ones
-  QuickSort::sort<RegionData>(data, (int) cnt, compare_by_garbage_then_alloc_seq_ascending, false);
+  ParallelSort::sort<RegionData>(heap->workers(), data, cnt, compare_by_garbage_then_alloc_seq_ascending, false);
 
   size_t cur_cset = 0;
   size_t cur_garbage = 0;
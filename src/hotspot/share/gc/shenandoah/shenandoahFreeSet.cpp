@@ -27,6 +27,7 @@
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegionSet.hpp"
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
+#include "gc/shenandoah/shenandoahThreadLocalData.hpp"
 #include "gc/shenandoah/shenandoahTraversalGC.hpp"
 #include "logging/logStream.hpp"
 
@@ -76,11 +77,27 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
     case ShenandoahAllocRequest::_alloc_tlab:
     case ShenandoahAllocRequest::_alloc_shared: {
 
+      // Try the thread affinity region first. Threads keep refilling from the same
+      // region until it retires, which takes the bitmap scan off the common refill
+      // path. Stale hints are benign: the mutator free bit guards against regions
+      // that were retired, flipped to the collector view, or put in the collection
+      // set since the hint was recorded.
+      Thread* thread = Thread::current();
+      size_t hint = ShenandoahThreadLocalData::alloc_region_hint(thread);
+      if (hint < _max && is_mutator_free(hint)) {
+        HeapWord* result = try_allocate_in(_heap->get_region(hint), req, in_new_region);
+        if (result != NULL) {
+          return result;
+        }
+      }
+
       // Try to allocate in the mutator view
       for (size_t idx = _mutator_leftmost; idx <= _mutator_rightmost; idx++) {
         if (is_mutator_free(idx)) {
           HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
           if (result != NULL) {
+            // Remember the region for subsequent refills by this thread
+            ShenandoahThreadLocalData::set_alloc_region_hint(thread, idx);
             return result;
           }
         }
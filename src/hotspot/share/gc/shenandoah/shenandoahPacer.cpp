@@ -26,6 +26,7 @@
 #include "gc/shenandoah/shenandoahFreeSet.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahPacer.hpp"
+#include "gc/shenandoah/shenandoahThreadLocalData.hpp"
 
 /*
  * In normal concurrent cycle, we have to pace the application to let GC finish.
@@ -183,11 +184,7 @@ void ShenandoahPacer::restart_with(size_t non_taxable_bytes, double tax_rate) {
   Atomic::inc(&_epoch);
 }
 
-bool ShenandoahPacer::claim_for_alloc(size_t words, bool force) {
-  assert(ShenandoahPacing, "Only be here when pacing is enabled");
-
-  intptr_t tax = MAX2<intptr_t>(1, words * Atomic::load(&_tax_rate));
-
+bool ShenandoahPacer::claim_tax(intptr_t tax, bool force) {
   intptr_t cur = 0;
   intptr_t new_val = 0;
   do {
@@ -201,6 +198,13 @@ bool ShenandoahPacer::claim_for_alloc(size_t words, bool force) {
   return true;
 }
 
+bool ShenandoahPacer::claim_for_alloc(size_t words, bool force) {
+  assert(ShenandoahPacing, "Only be here when pacing is enabled");
+
+  intptr_t tax = MAX2<intptr_t>(1, words * Atomic::load(&_tax_rate));
+  return claim_tax(tax, force);
+}
+
 void ShenandoahPacer::unpace_for_alloc(intptr_t epoch, size_t words) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
@@ -210,6 +214,16 @@ void ShenandoahPacer::unpace_for_alloc(intptr_t epoch, size_t words) {
   }
 
   intptr_t tax = MAX2<intptr_t>(1, words * Atomic::load(&_tax_rate));
+
+  // Prefer returning the tax to the thread-local claim: it is exact in the same
+  // epoch, and it saves the atomic update on the global budget.
+  Thread* current = Thread::current();
+  if (ShenandoahThreadLocalData::pacing_epoch(current) == epoch) {
+    intptr_t local = ShenandoahThreadLocalData::pacing_budget(current);
+    ShenandoahThreadLocalData::set_pacing_budget(current, local + tax);
+    return;
+  }
+
   Atomic::add(tax, &_budget);
 }
 
@@ -220,8 +234,39 @@ intptr_t ShenandoahPacer::epoch() {
 void ShenandoahPacer::pace_for_alloc(size_t words) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
-  // Fast path: try to allocate right away
-  if (claim_for_alloc(words, false)) {
+  intptr_t tax = MAX2<intptr_t>(1, words * Atomic::load(&_tax_rate));
+
+  // Fast path: spend the thread-local claim, replenished in batches from the
+  // global budget below. This keeps the common allocation path off the heavily
+  // contended global budget cache line.
+  Thread* current = Thread::current();
+  intptr_t cur_epoch = epoch();
+  if (ShenandoahThreadLocalData::pacing_epoch(current) == cur_epoch) {
+    intptr_t local = ShenandoahThreadLocalData::pacing_budget(current);
+    if (local >= tax) {
+      ShenandoahThreadLocalData::set_pacing_budget(current, local - tax);
+      return;
+    }
+  } else {
+    // Claims from the previous phase are stale: drop them. The matching global
+    // budget was already discarded when the phase restarted the pacer.
+    ShenandoahThreadLocalData::set_pacing_budget(current, 0);
+    ShenandoahThreadLocalData::set_pacing_epoch(current, cur_epoch);
+  }
+
+  // Replenish: claim the tax for this allocation, plus a batch for subsequent
+  // ones. Claiming more than the exact tax keeps the thread on the local fast
+  // path most of the time. Never force the batched claim: when the budget runs
+  // low, threads fall back to exact claims, so the leftovers are still usable.
+  intptr_t batch = MAX2<intptr_t>(1, ShenandoahPacingClaimBatch * Atomic::load(&_tax_rate));
+  if (claim_tax(tax + batch, false)) {
+    intptr_t local = ShenandoahThreadLocalData::pacing_budget(current);
+    ShenandoahThreadLocalData::set_pacing_budget(current, local + batch);
+    return;
+  }
+
+  // Not enough budget for a batch, try to claim for this allocation only
+  if (claim_tax(tax, false)) {
     return;
   }
 
@@ -91,6 +91,8 @@ private:
   inline void report_internal(size_t words);
   inline void report_progress_internal(size_t words);
 
+  bool claim_tax(intptr_t tax, bool force);
+
   void restart_with(size_t non_taxable_bytes, double tax_rate);
 
   size_t update_and_get_progress_history();
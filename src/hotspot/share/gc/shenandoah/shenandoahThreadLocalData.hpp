@@ -34,6 +34,7 @@
 class ShenandoahThreadLocalData {
 public:
   static const uint INVALID_WORKER_ID = uint(-1);
+  static const size_t INVALID_REGION = size_t(-1);
 
 private:
   char _gc_state;
@@ -43,6 +44,9 @@ private:
   size_t _gclab_size;
   uint  _worker_id;
   bool _force_satb_flush;
+  size_t _alloc_region_hint;
+  intptr_t _pacing_budget;
+  intptr_t _pacing_epoch;
 
   ShenandoahThreadLocalData() :
     _gc_state(0),
@@ -51,7 +55,10 @@ private:
     _gclab(NULL),
     _gclab_size(0),
     _worker_id(INVALID_WORKER_ID),
-    _force_satb_flush(false) {
+    _force_satb_flush(false),
+    _alloc_region_hint(INVALID_REGION),
+    _pacing_budget(0),
+    _pacing_epoch(0) {
   }
 
   ~ShenandoahThreadLocalData() {
@@ -112,6 +119,30 @@ public:
     return data(thread)->_worker_id;
   }
 
+  static size_t alloc_region_hint(Thread* thread) {
+    return data(thread)->_alloc_region_hint;
+  }
+
+  static void set_alloc_region_hint(Thread* thread, size_t region) {
+    data(thread)->_alloc_region_hint = region;
+  }
+
+  static intptr_t pacing_budget(Thread* thread) {
+    return data(thread)->_pacing_budget;
+  }
+
+  static void set_pacing_budget(Thread* thread, intptr_t budget) {
+    data(thread)->_pacing_budget = budget;
+  }
+
+  static intptr_t pacing_epoch(Thread* thread) {
+    return data(thread)->_pacing_epoch;
+  }
+
+  static void set_pacing_epoch(Thread* thread, intptr_t epoch) {
+    data(thread)->_pacing_epoch = epoch;
+  }
+
   static void set_force_satb_flush(Thread* thread, bool v) {
     data(thread)->_force_satb_flush = v;
   }
@@ -269,6 +269,12 @@
           "uniform during the cycle.")                                      \
           range(0, 100)                                                     \
                                                                             \
+  experimental(uintx, ShenandoahPacingClaimBatch, 32*K,                     \
+          "How many words worth of pacing budget to claim at once into "    \
+          "the thread-local claim cache. Larger values reduce contention "  \
+          "on the global pacing budget, but strand more budget in "         \
+          "inactive threads, making the pacing less accurate.")             \
+                                                                            \
   experimental(double, ShenandoahPacingSurcharge, 1.1,                      \
           "Additional pacing tax surcharge to help unclutter the heap. "    \
           "Larger values makes the pacing more aggressive. Lower values "   \
@@ -49,6 +49,7 @@ ZCollectedHeap::ZCollectedHeap() :
     _director(new ZDirector()),
     _driver(new ZDriver()),
     _uncommitter(new ZUncommitter()),
+    _pre_toucher(new ZPreToucher()),
     _stat(new ZStat()),
     _runtime_workers() {}
 
@@ -79,6 +80,7 @@ void ZCollectedHeap::stop() {
   _director->stop();
   _driver->stop();
   _uncommitter->stop();
+  _pre_toucher->stop();
   _stat->stop();
 }
 
@@ -275,6 +277,7 @@ void ZCollectedHeap::gc_threads_do(ThreadClosure* tc) const {
   tc->do_thread(_director);
   tc->do_thread(_driver);
   tc->do_thread(_uncommitter);
+  tc->do_thread(_pre_toucher);
   tc->do_thread(_stat);
   _heap.worker_threads_do(tc);
   _runtime_workers.threads_do(tc);
@@ -336,6 +339,8 @@ void ZCollectedHeap::print_gc_threads_on(outputStream* st) const {
   st->cr();
   _uncommitter->print_on(st);
   st->cr();
+  _pre_toucher->print_on(st);
+  st->cr();
   _stat->print_on(st);
   st->cr();
   _heap.print_worker_threads_on(st);
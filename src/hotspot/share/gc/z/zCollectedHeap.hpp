@@ -31,6 +31,7 @@
 #include "gc/z/zDriver.hpp"
 #include "gc/z/zHeap.hpp"
 #include "gc/z/zInitialize.hpp"
+#include "gc/z/zPreToucher.hpp"
 #include "gc/z/zRuntimeWorkers.hpp"
 #include "gc/z/zStat.hpp"
 #include "gc/z/zUncommitter.hpp"
@@ -46,6 +47,7 @@ private:
   ZDirector*        _director;
   ZDriver*          _driver;
   ZUncommitter*     _uncommitter;
+  ZPreToucher*      _pre_toucher;
   ZStat*            _stat;
   ZRuntimeWorkers   _runtime_workers;
 
@@ -48,7 +48,9 @@ ZForwarding::ZForwarding(ZPage* page, uint32_t nentries) :
     _entries(nentries),
     _page(page),
     _refcount(1),
-    _pinned(false) {}
+    _pinned(false),
+    _in_place_state(unclaimed),
+    _in_place_waiters(0) {}
 
 void ZForwarding::verify() const {
   guarantee(_refcount > 0, "Invalid refcount");
@@ -39,12 +39,23 @@ class ZForwarding {
 private:
   typedef ZAttachedArray<ZForwarding, ZForwardingEntry> AttachedArray;
 
+  // In-place compaction states. A forwarding starts out unclaimed. A thread
+  // failing to allocate a destination page claims the forwarding and compacts
+  // the page in place. A thread completing normal relocation of all objects
+  // instead seals the forwarding, which keeps in-place compaction from
+  // starting after the page has been released.
+  static const uint32_t unclaimed = 0;
+  static const uint32_t claimed   = 1;
+  static const uint32_t sealed    = 2;
+
   const ZVirtualMemory _virtual;
   const size_t         _object_alignment_shift;
   const AttachedArray  _entries;
   ZPage*               _page;
   volatile uint32_t    _refcount;
   volatile bool        _pinned;
+  volatile uint32_t    _in_place_state;
+  volatile uint32_t    _in_place_waiters;
 
   bool inc_refcount();
   bool dec_refcount();
@@ -68,6 +79,12 @@ public:
   bool is_pinned() const;
   void set_pinned();
 
+  bool is_in_place() const;
+  bool claim_in_place();
+  bool seal_relocation();
+  void in_place_wait_exclusive();
+  uintptr_t in_place_wait_forwarded(uintptr_t from_index);
+
   bool retain_page();
   void release_page();
 
@@ -31,6 +31,7 @@
 #include "gc/z/zHeap.hpp"
 #include "gc/z/zVirtualMemory.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 
 inline uintptr_t ZForwarding::start() const {
@@ -57,6 +58,49 @@ inline void ZForwarding::set_pinned() {
   Atomic::store(true, &_pinned);
 }
 
+inline bool ZForwarding::is_in_place() const {
+  return Atomic::load(&_in_place_state) == claimed;
+}
+
+inline bool ZForwarding::claim_in_place() {
+  return Atomic::cmpxchg(claimed, &_in_place_state, unclaimed) == unclaimed;
+}
+
+inline bool ZForwarding::seal_relocation() {
+  return Atomic::cmpxchg(sealed, &_in_place_state, unclaimed) == unclaimed;
+}
+
+inline void ZForwarding::in_place_wait_exclusive() {
+  assert(Atomic::load(&_in_place_state) == claimed, "Invalid state");
+
+  // Wait for concurrently started relocations of objects in this page to
+  // complete or become waiters, so that the page contents can be modified
+  // without racing with copying. Threads relocating objects hold a page
+  // reference, so exclusive access is reached when the only unaccounted
+  // references left are the relocation set reference and our own.
+  while (Atomic::load(&_refcount) - Atomic::load(&_in_place_waiters) != 2) {
+    os::naked_yield();
+  }
+}
+
+inline uintptr_t ZForwarding::in_place_wait_forwarded(uintptr_t from_index) {
+  // Wait for the in-place compacting thread to forward this object. Announce
+  // ourselves as a waiter so that the page reference we hold does not keep
+  // the compacting thread from gaining exclusive access.
+  Atomic::inc(&_in_place_waiters);
+
+  ZForwardingEntry entry = find(from_index);
+  while (!entry.populated()) {
+    os::naked_yield();
+    entry = find(from_index);
+  }
+
+  Atomic::dec(&_in_place_waiters);
+
+  assert(entry.from_index() == from_index, "Invalid entry");
+  return entry.to_offset();
+}
+
 inline bool ZForwarding::inc_refcount() {
   uint32_t refcount = Atomic::load(&_refcount);
 
@@ -258,6 +258,10 @@ void ZHeap::free_page(ZPage* page, bool reclaimed) {
   _page_allocator.free_page(page, reclaimed);
 }
 
+void ZHeap::warm_page_cache() {
+  _page_allocator.warm_cache();
+}
+
 uint64_t ZHeap::uncommit(uint64_t delay) {
   return _page_allocator.uncommit(delay);
 }
@@ -410,8 +414,24 @@ void ZHeap::select_relocation_set() {
   // Allow pages to be deleted
   _page_allocator.disable_deferred_delete();
 
+  // Calculate the number of live bytes we can expect to copy before the
+  // application is predicted to run out of free memory, using the copy
+  // bandwidth measured over previous relocations and the same max
+  // allocation rate estimate as the directing heuristics. Until a copy
+  // bandwidth has been measured the relocation set is not limited.
+  size_t relocating_limit = SIZE_MAX;
+  if (ZStatRelocation::has_bandwidth()) {
+    const double one_in_1000 = 3.290527;
+    const size_t max_capacity = soft_max_capacity();
+    const size_t free_with_reserve = max_capacity - MIN2(max_capacity, used());
+    const size_t free = free_with_reserve - MIN2(free_with_reserve, max_reserve());
+    const double max_alloc_rate = (ZStatAllocRate::avg() * ZAllocationSpikeTolerance) + (ZStatAllocRate::avg_sd() * one_in_1000);
+    const double time_until_oom = free / (max_alloc_rate + 1.0); // Plus 1.0B/s to avoid division by zero
+    relocating_limit = (size_t)(ZStatRelocation::bandwidth() * time_until_oom);
+  }
+
   // Select pages to relocate
-  selector.select(&_relocation_set);
+  selector.select(&_relocation_set, relocating_limit);
 
   // Setup forwarding table
   ZRelocationSetIterator rs_iter(&_relocation_set);
@@ -458,6 +478,9 @@ void ZHeap::relocate_start() {
 }
 
 void ZHeap::relocate() {
+  // Update statistics
+  ZStatRelocation::set_at_relocate_start();
+
   // Relocate relocation set
   const bool success = _relocate.relocate(&_relocation_set);
 
@@ -130,6 +130,9 @@ public:
   void undo_alloc_page(ZPage* page);
   void free_page(ZPage* page, bool reclaimed);
 
+  // Page cache warm-up
+  void warm_page_cache();
+
   // Uncommit memory
   uint64_t uncommit(uint64_t delay);
 
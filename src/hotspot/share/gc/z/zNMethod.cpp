@@ -27,6 +27,7 @@
 #include "code/icBuffer.hpp"
 #include "gc/shared/barrierSet.hpp"
 #include "gc/shared/barrierSetNMethod.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zNMethod.hpp"
@@ -323,8 +324,13 @@ public:
   }
 
   virtual void work() {
+    // Join the suspendible thread set while cleaning nmethods, since
+    // inline caches are otherwise mutated without the per-nmethod lock
+    // by safepoint operations. Yielding between table partitions keeps
+    // safepoints from being held off for the duration of the walk.
+    SuspendibleThreadSetJoiner sts_joiner;
     ICRefillVerifierMark mark(_verifier);
-    ZNMethodTable::nmethods_do(&_cl);
+    ZNMethodTable::nmethods_do(&_cl, &sts_joiner);
   }
 
   bool success() const {
@@ -346,8 +352,8 @@ void ZNMethod::unlink(ZWorkers* workers, bool unloading_occurred) {
 
     // Cleaning failed because we ran out of transitional IC stubs,
     // so we have to refill and try again. Refilling requires taking
-    // a safepoint, so we temporarily leave the suspendible thread set.
-    SuspendibleThreadSetLeaver sts;
+    // a safepoint. The workers have left the suspendible thread set
+    // at this point, so the safepoint will not deadlock.
     InlineCacheBuffer::refill_ic_stubs();
   }
 }
@@ -377,7 +383,11 @@ public:
   }
 
   virtual void work() {
-    ZNMethodTable::nmethods_do(&_cl);
+    // Join the suspendible thread set while purging, yielding between
+    // table partitions so that safepoints are not held off for the
+    // duration of the walk
+    SuspendibleThreadSetJoiner sts_joiner;
+    ZNMethodTable::nmethods_do(&_cl, &sts_joiner);
   }
 };
 
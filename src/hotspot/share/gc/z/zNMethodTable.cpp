@@ -231,6 +231,6 @@ void ZNMethodTable::nmethods_do_end() {
   CodeCache_lock->notify_all();
 }
 
-void ZNMethodTable::nmethods_do(NMethodClosure* cl) {
-  _iteration.nmethods_do(cl);
+void ZNMethodTable::nmethods_do(NMethodClosure* cl, SuspendibleThreadSetJoiner* sts_joiner) {
+  _iteration.nmethods_do(cl, sts_joiner);
 }
@@ -30,6 +30,7 @@
 
 class nmethod;
 class NMethodClosure;
+class SuspendibleThreadSetJoiner;
 class ZNMethodTableEntry;
 class ZWorkers;
 
@@ -65,7 +66,7 @@ public:
 
   static void nmethods_do_begin();
   static void nmethods_do_end();
-  static void nmethods_do(NMethodClosure* cl);
+  static void nmethods_do(NMethodClosure* cl, SuspendibleThreadSetJoiner* sts_joiner = NULL);
 
   static void unlink(ZWorkers* workers, bool unloading_occurred);
   static void purge(ZWorkers* workers);
@@ -22,6 +22,7 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/z/zNMethodTableEntry.hpp"
 #include "gc/z/zNMethodTableIteration.hpp"
 #include "memory/iterator.hpp"
@@ -53,8 +54,15 @@ void ZNMethodTableIteration::nmethods_do_end() {
   _table = NULL;
 }
 
-void ZNMethodTableIteration::nmethods_do(NMethodClosure* cl) {
+void ZNMethodTableIteration::nmethods_do(NMethodClosure* cl, SuspendibleThreadSetJoiner* sts_joiner) {
   for (;;) {
+    // Yield to pending safepoints before claiming the next partition.
+    // The claim cursor makes the iteration resumable, so the walk
+    // continues where it left off once the safepoint has completed.
+    if (sts_joiner != NULL && sts_joiner->should_yield()) {
+      sts_joiner->yield();
+    }
+
     // Claim table partition. Each partition is currently sized to span
     // two cache lines. This number is just a guess, but seems to work well.
     const size_t partition_size = (ZCacheLineSize * 2) / sizeof(ZNMethodTableEntry);
@@ -27,6 +27,7 @@
 #include "gc/z/zGlobals.hpp"
 
 class NMethodClosure;
+class SuspendibleThreadSetJoiner;
 class ZNMethodTableEntry;
 
 class ZNMethodTableIteration {
@@ -42,7 +43,7 @@ public:
 
   void nmethods_do_begin(ZNMethodTableEntry* table, size_t size);
   void nmethods_do_end();
-  void nmethods_do(NMethodClosure* cl);
+  void nmethods_do(NMethodClosure* cl, SuspendibleThreadSetJoiner* sts_joiner = NULL);
 };
 
 #endif // SHARE_GC_Z_ZNMETHODTABLEITERATION_HPP
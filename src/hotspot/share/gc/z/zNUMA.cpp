@@ -40,6 +40,15 @@ bool ZNUMA::is_enabled() {
   return _enabled;
 }
 
+void ZNUMA::memory_bind(uintptr_t addr, size_t size, uint32_t numa_id) {
+  if (!_enabled) {
+    // NUMA support not enabled
+    return;
+  }
+
+  os::numa_make_local((char*)addr, size, (int)numa_id);
+}
+
 void ZNUMA::memory_interleave(uintptr_t addr, size_t size) {
   if (!_enabled) {
     // NUMA support not enabled
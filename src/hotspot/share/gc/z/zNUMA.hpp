@@ -40,6 +40,7 @@ public:
   static uint32_t id();
 
   static uint32_t memory_id(uintptr_t addr);
+  static void memory_bind(uintptr_t addr, size_t size, uint32_t numa_id);
   static void memory_interleave(uintptr_t addr, size_t size);
 
   static const char* to_string();
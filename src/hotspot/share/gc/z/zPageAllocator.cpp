@@ -28,6 +28,7 @@
 #include "gc/z/zFuture.inline.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zLock.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAllocator.hpp"
 #include "gc/z/zPageCache.inline.hpp"
@@ -37,6 +38,7 @@
 #include "runtime/globals.hpp"
 #include "runtime/init.hpp"
 #include "runtime/java.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 
 static const ZStatCounter       ZCounterAllocationRate("Memory", "Allocation Rate", ZStatUnitBytesPerSecond);
@@ -151,7 +153,7 @@ ZPageAllocator::ZPageAllocator(size_t min_capacity,
 
 void ZPageAllocator::prime_cache(size_t size) {
   // Allocate physical memory
-  const ZPhysicalMemory pmem = _physical.alloc(size);
+  const ZPhysicalMemory pmem = _physical.alloc(size, ZNUMA::id());
   guarantee(!pmem.is_null(), "Invalid size");
 
   // Allocate virtual memory
@@ -167,7 +169,7 @@ void ZPageAllocator::prime_cache(size_t size) {
 
   // Add page to cache
   page->set_last_used();
-  _cache.free_page(page);
+  _cache.free_page(page, false /* hot */);
 }
 
 bool ZPageAllocator::is_initialized() const {
@@ -262,8 +264,9 @@ ZPage* ZPageAllocator::create_page(uint8_t type, size_t size) {
     return NULL;
   }
 
-  // Allocate physical memory
-  const ZPhysicalMemory pmem = _physical.alloc(size);
+  // Allocate physical memory, preferably backed by memory homed on the
+  // allocating thread's NUMA node
+  const ZPhysicalMemory pmem = _physical.alloc(size, ZNUMA::id());
   assert(!pmem.is_null(), "Invalid size");
 
   // Allocate page
@@ -274,11 +277,15 @@ void ZPageAllocator::destroy_page(ZPage* page) {
   const ZVirtualMemory& vmem = page->virtual_memory();
   const ZPhysicalMemory& pmem = page->physical_memory();
 
+  // Look up the page's NUMA home while it is still mapped, so that the
+  // physical memory can be returned to the pool of its actual home node
+  const uint32_t numa_id = page->numa_id();
+
   // Unmap memory
   _physical.unmap(pmem, vmem.start());
 
   // Free physical memory
-  _physical.free(pmem);
+  _physical.free(pmem, numa_id);
 
   // Free virtual memory
   _virtual.free(vmem);
@@ -288,9 +295,11 @@ void ZPageAllocator::destroy_page(ZPage* page) {
 }
 
 void ZPageAllocator::map_page(const ZPage* page) const {
-  // Map physical memory
+  // Map physical memory. Small pages are served from the CPU-local
+  // allocation path and are bound to the mapping thread's NUMA node,
+  // while medium/large pages are interleaved across all nodes.
   if (!page->is_mapped()) {
-    _physical.map(page->physical_memory(), page->start());
+    _physical.map(page->physical_memory(), page->start(), page->type() == ZPageTypeSmall /* numa_local */);
   } else if (ZVerifyViews) {
     _physical.debug_map(page->physical_memory(), page->start());
   }
@@ -514,12 +523,68 @@ void ZPageAllocator::free_page(ZPage* page, bool reclaimed) {
   page->set_last_used();
 
   // Cache page
-  _cache.free_page(page);
+  _cache.free_page(page, true /* hot */);
 
   // Try satisfy blocked allocations
   satisfy_alloc_queue();
 }
 
+void ZPageAllocator::warm_cache() {
+  if (!ZPageCacheWarmup) {
+    // Disabled
+    return;
+  }
+
+  if (ZVerifyViews) {
+    // Only the good view is mapped when verifying views
+    return;
+  }
+
+  // Predict the allocation demand over the next sample window and make sure
+  // the page cache can satisfy it with committed, mapped and faulted-in
+  // pages, paying the commit and page fault costs here instead of on the
+  // allocation path.
+  const size_t demand = (size_t)(ZStatAllocRate::avg() + ZStatAllocRate::avg_sd()) * ZStatAllocRate::sample_window_sec;
+  const size_t cached = _cache.available();
+  if (demand <= cached) {
+    // Cache is warm enough
+    return;
+  }
+
+  ZAllocationFlags flags;
+  flags.set_non_blocking();
+  flags.set_no_reserve();
+  flags.set_worker_thread();
+
+  SuspendibleThreadSetJoiner joiner;
+
+  // Allocate and touch pages, then immediately free them again to
+  // populate the hot end of the page cache ahead of demand.
+  ZList<ZPage> pages;
+  for (size_t warmed = 0; warmed < demand - cached; warmed += ZPageSizeSmall) {
+    ZPage* const page = alloc_page(ZPageTypeSmall, ZPageSizeSmall, flags);
+    if (page == NULL) {
+      // Out of memory, don't warm any further
+      break;
+    }
+
+    // Touch the page through the remapped view, which is mapped
+    // independently of the currently active good color.
+    const uintptr_t start = ZAddress::remapped(page->start());
+    os::pretouch_memory((void*)start, (void*)(start + page->size()));
+
+    pages.insert_last(page);
+
+    if (joiner.should_yield()) {
+      joiner.yield();
+    }
+  }
+
+  for (ZPage* page = pages.remove_first(); page != NULL; page = pages.remove_first()) {
+    free_page(page, false /* reclaimed */);
+  }
+}
+
 size_t ZPageAllocator::flush_cache(ZPageCacheFlushClosure* cl) {
   ZList<ZPage> list;
 
@@ -530,7 +595,7 @@ size_t ZPageAllocator::flush_cache(ZPageCacheFlushClosure* cl) {
   if (overflushed > 0) {
     // Overflushed, keep part of last page
     ZPage* const page = list.last()->split(overflushed);
-    _cache.free_page(page);
+    _cache.free_page(page, false /* hot */);
   }
 
   // Destroy pages
@@ -109,6 +109,8 @@ public:
   ZPage* alloc_page(uint8_t type, size_t size, ZAllocationFlags flags);
   void free_page(ZPage* page, bool reclaimed);
 
+  void warm_cache();
+
   uint64_t uncommit(uint64_t delay);
 
   void enable_deferred_delete() const;
@@ -160,7 +160,7 @@ ZPage* ZPageCache::alloc_page(uint8_t type, size_t size) {
         page = oversized->split(type, size);
 
         // Cache remainder
-        free_page_inner(oversized);
+        free_page_inner(oversized, false /* hot */);
       } else {
         // Re-type correctly sized page
         page = oversized->retype(type);
@@ -177,19 +177,36 @@ ZPage* ZPageCache::alloc_page(uint8_t type, size_t size) {
   return page;
 }
 
-void ZPageCache::free_page_inner(ZPage* page) {
+void ZPageCache::free_page_inner(ZPage* page, bool hot) {
+  // Hot pages, which have recently been allocated into and hence are likely
+  // still TLB-hot and resident, are inserted first so that they are reused
+  // before they cool down. Cold pages are inserted last, next to the pages
+  // about to expire, making them preferred uncommit candidates.
   const uint8_t type = page->type();
   if (type == ZPageTypeSmall) {
-    _small.get(page->numa_id()).insert_first(page);
+    ZList<ZPage>* const list = _small.addr(page->numa_id());
+    if (hot) {
+      list->insert_first(page);
+    } else {
+      list->insert_last(page);
+    }
   } else if (type == ZPageTypeMedium) {
-    _medium.insert_first(page);
+    if (hot) {
+      _medium.insert_first(page);
+    } else {
+      _medium.insert_last(page);
+    }
   } else {
-    _large.insert_first(page);
+    if (hot) {
+      _large.insert_first(page);
+    } else {
+      _large.insert_last(page);
+    }
   }
 }
 
-void ZPageCache::free_page(ZPage* page) {
-  free_page_inner(page);
+void ZPageCache::free_page(ZPage* page, bool hot) {
+  free_page_inner(page, hot);
   _available += page->size();
 }
 
@@ -55,7 +55,7 @@ private:
   ZPage* alloc_oversized_large_page(size_t size);
   ZPage* alloc_oversized_page(size_t size);
 
-  void free_page_inner(ZPage* page);
+  void free_page_inner(ZPage* page, bool hot);
 
   bool flush_list_inner(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
   void flush_list(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
@@ -67,7 +67,7 @@ public:
   size_t available() const;
 
   ZPage* alloc_page(uint8_t type, size_t size);
-  void free_page(ZPage* page);
+  void free_page(ZPage* page, bool hot);
 
   void flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to);
 
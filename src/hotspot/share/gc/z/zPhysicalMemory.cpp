@@ -165,16 +165,16 @@ size_t ZPhysicalMemoryManager::uncommit(size_t size) {
   return _backing.uncommit(size);
 }
 
-ZPhysicalMemory ZPhysicalMemoryManager::alloc(size_t size) {
-  return _backing.alloc(size);
+ZPhysicalMemory ZPhysicalMemoryManager::alloc(size_t size, uint32_t numa_id) {
+  return _backing.alloc(size, numa_id);
 }
 
-void ZPhysicalMemoryManager::free(const ZPhysicalMemory& pmem) {
-  _backing.free(pmem);
+void ZPhysicalMemoryManager::free(const ZPhysicalMemory& pmem, uint32_t numa_id) {
+  _backing.free(pmem, numa_id);
 }
 
-void ZPhysicalMemoryManager::map(const ZPhysicalMemory& pmem, uintptr_t offset) const {
-  _backing.map(pmem, offset);
+void ZPhysicalMemoryManager::map(const ZPhysicalMemory& pmem, uintptr_t offset, bool numa_local) const {
+  _backing.map(pmem, offset, numa_local);
   nmt_commit(pmem, offset);
 }
 
@@ -79,10 +79,10 @@ public:
   size_t commit(size_t size);
   size_t uncommit(size_t size);
 
-  ZPhysicalMemory alloc(size_t size);
-  void free(const ZPhysicalMemory& pmem);
+  ZPhysicalMemory alloc(size_t size, uint32_t numa_id);
+  void free(const ZPhysicalMemory& pmem, uint32_t numa_id);
 
-  void map(const ZPhysicalMemory& pmem, uintptr_t offset) const;
+  void map(const ZPhysicalMemory& pmem, uintptr_t offset, bool numa_local) const;
   void unmap(const ZPhysicalMemory& pmem, uintptr_t offset) const;
 
   void debug_map(const ZPhysicalMemory& pmem, uintptr_t offset) const;
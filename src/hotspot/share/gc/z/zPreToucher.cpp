@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/z/zHeap.inline.hpp"
+#include "gc/z/zPreToucher.hpp"
+#include "gc/z/zStat.hpp"
+#include "runtime/mutexLocker.hpp"
+
+ZPreToucher::ZPreToucher() :
+    _monitor(Monitor::leaf, "ZPreToucher", false, Monitor::_safepoint_check_never),
+    _stop(false) {
+  set_name("ZPreToucher");
+  create_and_start();
+}
+
+bool ZPreToucher::idle() {
+  // Idle for one allocation rate sample window
+  const uint64_t timeout = ZStatAllocRate::sample_window_sec;
+
+  MonitorLocker ml(&_monitor, Monitor::_no_safepoint_check_flag);
+  if (!_stop) {
+    ml.wait(timeout * MILLIUNITS);
+  }
+
+  return !_stop;
+}
+
+void ZPreToucher::run_service() {
+  for (;;) {
+    // Keep the page cache warmed ahead of the allocation rate
+    ZHeap::heap()->warm_page_cache();
+
+    // Idle until next attempt
+    if (!idle()) {
+      return;
+    }
+  }
+}
+
+void ZPreToucher::stop_service() {
+  MonitorLocker ml(&_monitor, Monitor::_no_safepoint_check_flag);
+  _stop = true;
+  ml.notify();
+}
@@ -36,8 +36,11 @@
 #include "gc/z/zThreadLocalAllocBuffer.hpp"
 #include "gc/z/zWorkers.hpp"
 #include "logging/log.hpp"
+#include "utilities/align.hpp"
+#include "utilities/copy.hpp"
 
 static const ZStatCounter ZCounterRelocationContention("Contention", "Relocation Contention", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterInPlaceCompaction("Memory", "In-Place Compaction", ZStatUnitOpsPerSecond);
 
 ZRelocate::ZRelocate(ZWorkers* workers) :
     _workers(workers) {}
@@ -83,6 +86,80 @@ void ZRelocate::start() {
   _workers->run_parallel(&task);
 }
 
+// Slides all live objects in a page toward the start of the page, under
+// exclusive access to the page contents. Objects that have already been
+// relocated to other pages leave their space behind for reuse.
+class ZRelocateInPlaceObjectClosure : public ObjectClosure {
+private:
+  ZForwarding* const _forwarding;
+  uintptr_t          _top;
+
+public:
+  ZRelocateInPlaceObjectClosure(ZForwarding* forwarding) :
+      _forwarding(forwarding),
+      _top(forwarding->start()) {}
+
+  virtual void do_object(oop o) {
+    const uintptr_t from_good = ZOop::to_address(o);
+    const uintptr_t from_offset = ZAddress::offset(from_good);
+    const uintptr_t from_index = (from_offset - _forwarding->start()) >> _forwarding->object_alignment_shift();
+
+    ZForwardingCursor cursor;
+    const ZForwardingEntry entry = _forwarding->find(from_index, &cursor);
+    if (entry.populated() && entry.from_index() == from_index) {
+      // Already relocated to another page, its space can be reused
+      return;
+    }
+
+    assert(_top <= from_offset, "Should slide towards start of page");
+
+    // Slide object. Copying may overlap when the gap to the compacted
+    // part of the page is smaller than the object.
+    const size_t size = ZUtils::object_size(from_good);
+    if (_top != from_offset) {
+      Copy::aligned_conjoint_words((HeapWord*)from_good,
+                                   (HeapWord*)ZAddress::good(_top),
+                                   ZUtils::bytes_to_words(size));
+    }
+
+    _forwarding->insert(from_index, _top, &cursor);
+    _top += align_up(size, (size_t)1 << _forwarding->object_alignment_shift());
+  }
+};
+
+uintptr_t ZRelocate::relocate_object_in_place(ZForwarding* forwarding, uintptr_t from_index) const {
+  // Pin page, the remaining live objects will stay in it. The page must
+  // be pinned before the in-place claim is published, so that a thread
+  // observing the claim through a failed seal_relocation() always sees
+  // the page as pinned. If the claim below fails another thread is
+  // compacting the page in place, so the page stays pinned either way.
+  forwarding->set_pinned();
+
+  if (forwarding->claim_in_place()) {
+    // Wait for concurrently started relocations of objects in this
+    // page to complete, giving us exclusive access to its contents
+    forwarding->in_place_wait_exclusive();
+
+    // Compact page in place
+    ZRelocateInPlaceObjectClosure cl(forwarding);
+    forwarding->page()->object_iterate(&cl);
+
+    // Update statistics
+    ZStatInc(ZCounterInPlaceCompaction);
+    log_trace(gc)("In-place compaction, thread: " PTR_FORMAT " (%s), forwarding: " PTR_FORMAT,
+                  ZThread::id(), ZThread::name(), p2i(forwarding));
+
+    // All live objects are now forwarded
+    const ZForwardingEntry entry = forwarding->find(from_index);
+    assert(entry.populated(), "Should be forwarded");
+    return entry.to_offset();
+  }
+
+  // Another thread is compacting the page in place, wait for
+  // it to forward the object we need
+  return forwarding->in_place_wait_forwarded(from_index);
+}
+
 uintptr_t ZRelocate::relocate_object_inner(ZForwarding* forwarding, uintptr_t from_index, uintptr_t from_offset) const {
   ZForwardingCursor cursor;
 
@@ -95,9 +172,9 @@ uintptr_t ZRelocate::relocate_object_inner(ZForwarding* forwarding, uintptr_t fr
 
   assert(ZHeap::heap()->is_object_live(ZAddress::good(from_offset)), "Should be live");
 
-  if (forwarding->is_pinned()) {
-    // In-place forward
-    return forwarding->insert(from_index, from_offset, &cursor);
+  if (forwarding->is_in_place()) {
+    // Page is being compacted in place, wait for the object to be forwarded
+    return forwarding->in_place_wait_forwarded(from_index);
   }
 
   // Allocate object
@@ -105,8 +182,8 @@ uintptr_t ZRelocate::relocate_object_inner(ZForwarding* forwarding, uintptr_t fr
   const size_t size = ZUtils::object_size(from_good);
   const uintptr_t to_good = ZHeap::heap()->alloc_object_for_relocation(size);
   if (to_good == 0) {
-    // Failed, in-place forward
-    return forwarding->insert(from_index, from_offset, &cursor);
+    // Failed to allocate a destination page, compact the page in place
+    return relocate_object_in_place(forwarding, from_index);
   }
 
   // Copy object
@@ -176,6 +253,12 @@ bool ZRelocate::work(ZRelocationSetParallelIterator* iter) {
 
   // Relocate pages in the relocation set
   for (ZForwarding* forwarding; iter->next(&forwarding);) {
+    // Retain the page while relocating its objects, so that a thread
+    // compacting the page in place can detect and wait out concurrent
+    // relocations using the page reference count.
+    const bool retained = forwarding->retain_page();
+    assert(retained, "Should not fail");
+
     // Relocate objects in page
     ZRelocateObjectClosure cl(this, forwarding);
     forwarding->page()->object_iterate(&cl);
@@ -184,12 +267,15 @@ bool ZRelocate::work(ZRelocationSetParallelIterator* iter) {
       forwarding->verify();
     }
 
-    if (forwarding->is_pinned()) {
-      // Relocation failed, page is now pinned
-      success = false;
-    } else {
+    forwarding->release_page();
+
+    if (forwarding->seal_relocation()) {
       // Relocation succeeded, release page
       forwarding->release_page();
+    } else {
+      // Relocation failed, page was compacted in place and is now pinned
+      assert(forwarding->is_pinned(), "Should be pinned");
+      success = false;
     }
   }
 
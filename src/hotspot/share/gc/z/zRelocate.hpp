@@ -37,6 +37,7 @@ private:
   ZWorkers* const _workers;
 
   ZForwarding* forwarding_for_page(ZPage* page) const;
+  uintptr_t relocate_object_in_place(ZForwarding* forwarding, uintptr_t from_index) const;
   uintptr_t relocate_object_inner(ZForwarding* forwarding, uintptr_t from_index, uintptr_t from_offset) const;
   bool work(ZRelocationSetParallelIterator* iter);
 
@@ -96,7 +96,7 @@ void ZRelocationSetSelectorGroup::semi_sort() {
   }
 }
 
-void ZRelocationSetSelectorGroup::select() {
+void ZRelocationSetSelectorGroup::select(size_t relocating_limit) {
   // Calculate the number of pages to relocate by successively including pages in
   // a candidate relocation set and calculate the maximum space requirement for
   // their live objects.
@@ -136,6 +136,21 @@ void ZRelocationSetSelectorGroup::select() {
                          _name, from, to, diff_reclaimable, (selected_from == from) ? "Selected" : "Rejected");
   }
 
+  // Limit the number of live bytes in the relocation set to what we can
+  // expect to copy within the allocation time budget. Pages are semi-sorted
+  // by live bytes in ascending order, so the pages that reclaim the least
+  // memory per copied byte are dropped first.
+  const size_t unlimited_from = selected_from;
+  while (selected_from > 0 && selected_from_size > relocating_limit) {
+    selected_from_size -= _sorted_pages[selected_from - 1]->live_bytes();
+    selected_from--;
+  }
+  if (selected_from != unlimited_from) {
+    selected_to = ceil((double)(selected_from_size) / (double)(_page_size - _object_size_limit));
+    log_debug(gc, reloc)("Relocation Set (%s Pages): Dropped " SIZE_FORMAT " page(s) to fit copy budget ("
+                         SIZE_FORMAT "M)", _name, unlimited_from - selected_from, relocating_limit / M);
+  }
+
   // Finalize selection
   _nselected = selected_from;
 
@@ -194,16 +209,17 @@ void ZRelocationSetSelector::register_garbage_page(ZPage* page) {
   _garbage += page->size();
 }
 
-void ZRelocationSetSelector::select(ZRelocationSet* relocation_set) {
+void ZRelocationSetSelector::select(ZRelocationSet* relocation_set, size_t relocating_limit) {
   // Select pages to relocate. The resulting relocation set will be
   // sorted such that medium pages comes first, followed by small
   // pages. Pages within each page group will be semi-sorted by live
   // bytes in ascending order. Relocating pages in this order allows
   // us to start reclaiming memory more quickly.
 
-  // Select pages from each group
-  _medium.select();
-  _small.select();
+  // Select pages from each group. Medium pages are selected first and
+  // consume part of the copy budget, the remainder is left for small pages.
+  _medium.select(relocating_limit);
+  _small.select(relocating_limit - MIN2(relocating_limit, _medium.relocating()));
 
   // Populate relocation set
   relocation_set->populate(_medium.selected(), _medium.nselected(),
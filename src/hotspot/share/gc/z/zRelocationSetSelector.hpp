@@ -52,7 +52,7 @@ public:
   ~ZRelocationSetSelectorGroup();
 
   void register_live_page(ZPage* page, size_t garbage);
-  void select();
+  void select(size_t relocating_limit);
 
   ZPage* const* selected() const;
   size_t nselected() const;
@@ -73,7 +73,7 @@ public:
 
   void register_live_page(ZPage* page);
   void register_garbage_page(ZPage* page);
-  void select(ZRelocationSet* relocation_set);
+  void select(ZRelocationSet* relocation_set, size_t relocating_limit);
 
   size_t live() const;
   size_t garbage() const;
@@ -1118,15 +1118,38 @@ void ZStatMark::print() {
 //
 // Stat relocation
 //
-size_t ZStatRelocation::_relocating;
-bool ZStatRelocation::_success;
+size_t    ZStatRelocation::_relocating;
+bool      ZStatRelocation::_success;
+Ticks     ZStatRelocation::_start_of_last;
+NumberSeq ZStatRelocation::_bandwidth(0.3 /* alpha */);
 
 void ZStatRelocation::set_at_select_relocation_set(size_t relocating) {
   _relocating = relocating;
 }
 
+void ZStatRelocation::set_at_relocate_start() {
+  _start_of_last = Ticks::now();
+}
+
 void ZStatRelocation::set_at_relocate_end(bool success) {
   _success = success;
+
+  if (success && _relocating > 0) {
+    // Sample copy bandwidth. Incomplete relocations are not sampled,
+    // since we don't know how many bytes were actually copied.
+    const double duration = (Ticks::now() - _start_of_last).seconds();
+    if (duration > 0.0) {
+      _bandwidth.add(_relocating / duration);
+    }
+  }
+}
+
+bool ZStatRelocation::has_bandwidth() {
+  return _bandwidth.num() > 0;
+}
+
+double ZStatRelocation::bandwidth() {
+  return _bandwidth.davg();
 }
 
 void ZStatRelocation::print() {
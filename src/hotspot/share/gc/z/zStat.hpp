@@ -412,13 +412,19 @@ public:
 //
 class ZStatRelocation : public AllStatic {
 private:
-  static size_t _relocating;
-  static bool   _success;
+  static size_t    _relocating;
+  static bool      _success;
+  static Ticks     _start_of_last;
+  static NumberSeq _bandwidth;
 
 public:
   static void set_at_select_relocation_set(size_t relocating);
+  static void set_at_relocate_start();
   static void set_at_relocate_end(bool success);
 
+  static bool has_bandwidth();
+  static double bandwidth();
+
   static void print();
 };
 
@@ -126,26 +126,35 @@ void ZUnload::prepare() {
 }
 
 void ZUnload::unlink() {
-  SuspendibleThreadSetJoiner sts;
   bool unloading_occurred;
 
   {
+    SuspendibleThreadSetJoiner sts;
     MutexLocker ml(ClassLoaderDataGraph_lock);
     unloading_occurred = SystemDictionary::do_unloading(ZStatPhase::timer());
   }
 
-  Klass::clean_weak_klass_links(unloading_occurred);
+  {
+    SuspendibleThreadSetJoiner sts;
+    Klass::clean_weak_klass_links(unloading_occurred);
+  }
 
+  // The code cache walk is not done while joined with the suspendible
+  // thread set. The workers instead join and yield between bounded
+  // slices of the nmethod table, so that long walks do not hold off
+  // safepoints and handshakes for the rest of the VM.
   ZNMethod::unlink(_workers, unloading_occurred);
 
-  DependencyContext::cleaning_end();
-}
-
-void ZUnload::purge() {
   {
     SuspendibleThreadSetJoiner sts;
-    ZNMethod::purge(_workers);
+    DependencyContext::cleaning_end();
   }
+}
+
+void ZUnload::purge() {
+  // As in unlink(), the workers join the suspendible thread set and
+  // yield between bounded slices of the nmethod table
+  ZNMethod::purge(_workers);
 
   ClassLoaderDataGraph::purge();
   CodeCache::purge_exception_caches();
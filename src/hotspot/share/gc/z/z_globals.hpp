@@ -63,6 +63,9 @@
           "Uncommit memory if it has been unused for the specified "        \
           "amount of time (in seconds)")                                    \
                                                                             \
+  experimental(bool, ZPageCacheWarmup, true,                                \
+          "Warm the page cache ahead of the predicted allocation rate")     \
+                                                                            \
   diagnostic(uint, ZStatisticsInterval, 10,                                 \
           "Time between statistics print outs (in seconds)")                \
           range(1, (uint)-1)                                                \
@@ -64,6 +64,18 @@
  * gives us the opportunity to have the instructions that calculate the
  * next opcode to jump to be intermixed with the rest of the instructions
  * that implement the opcode (see UPDATE_PC_AND_TOS_AND_CONTINUE macro).
+ *
+ * Note that this is already direct-threaded dispatch, and it is the
+ * default for GCC release builds: each handler computes its successor's
+ * address from the table and jumps there itself.  The opc_default rows
+ * in the table are not missing fast-variant support -- the rewriter
+ * only produces the handful of fast bytecodes this interpreter handles
+ * (see its CC_INTERP conditionals), so the remaining encodings cannot
+ * occur.  Caching the top-of-stack value in a register across handlers
+ * is the one classic technique not applied here; it multiplies every
+ * handler by the number of cached states (this is what the template
+ * interpreter's tos states do) and is not worth that rewrite for a
+ * build whose purpose is portability rather than peak speed.
  */
 #undef USELABELS
 #ifdef __GNUC__
@@ -516,6 +516,9 @@ void Bytecodes::initialize() {
   def(_fast_iload2         , "fast_iload2"         , "bi_i" , NULL    , T_INT    ,  2, false, _iload);
   def(_fast_icaload        , "fast_icaload"        , "bi_"  , NULL    , T_INT    ,  0, false, _iload);
 
+  // Fused getfield/ifnull pair; the trailing bytes are the unmodified _ifnull.
+  def(_fast_agetfield_ifnull, "fast_agetfield_ifnull", "bJJ___", NULL  , T_VOID   , -1, true , _getfield);
+
   // Faster method invocation.
   def(_fast_invokevfinal   , "fast_invokevfinal"   , "bJJ"  , NULL    , T_ILLEGAL, -1, true, _invokevirtual   );
 
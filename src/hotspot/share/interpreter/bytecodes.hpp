@@ -274,6 +274,8 @@ class Bytecodes: AllStatic {
     _fast_iload2          ,
     _fast_icaload         ,
 
+    _fast_agetfield_ifnull,
+
     _fast_invokevfinal    ,
     _fast_linearswitch    ,
     _fast_binaryswitch    ,
@@ -30,6 +30,7 @@
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/signature.hpp"
 
 class OopMapCacheEntry: private InterpreterOopMap {
@@ -480,18 +481,48 @@ void OopMapCache::flush_obsolete_entries() {
            entry->method()->name()->as_C_string(), entry->method()->signature()->as_C_string(), i);
       }
       _array[i] = NULL;
+      // We are the only thread touching the cache in a redefinition
+      // safepoint, so the method's one-entry cache can be cleared directly.
+      entry->method()->clear_oop_map_entry_cache(entry);
       entry->flush();
       FREE_C_HEAP_OBJ(entry);
     }
   }
 }
 
+// Publish an entry that is currently at slot i in the method's one-entry
+// cache. A concurrent thread may replace the slot and clear the method
+// cache at any time; re-checking the slot after the store (with a full
+// fence in between) guarantees that either we observe the replacement and
+// undo the publication ourselves, or the replacing thread observes our
+// store and clears it (see the eviction in lookup).
+void OopMapCache::publish_to_method_cache(const methodHandle& method,
+                                          OopMapCacheEntry* entry, int i) {
+  method->set_oop_map_entry_cache(entry);
+  OrderAccess::fence();
+  if (entry_at(i) != entry) {
+    method->clear_oop_map_entry_cache(entry);
+  }
+}
+
 // Called by GC for thread root scan during a safepoint only.  The other interpreted frame oopmaps
 // are generated locally and not cached.
 void OopMapCache::lookup(const methodHandle& method,
                          int bci,
                          InterpreterOopMap* entry_for) {
   assert(SafepointSynchronize::is_at_safepoint(), "called by GC in a safepoint");
+
+  // A hit in the method's one-entry cache skips the table probe entirely;
+  // repeated walks of threads parked at the same bci resolve here. Any
+  // pointer found in the cache is kept from dangling by the publication
+  // protocol in publish_to_method_cache.
+  OopMapCacheEntry* cached = method->oop_map_entry_cache();
+  if (cached != NULL && cached->match(method, bci)) {
+    entry_for->resource_copy(cached);
+    assert(!entry_for->is_empty(), "A non-empty oop map should be returned");
+    return;
+  }
+
   int probe = hash_value_for(method, bci);
   int i;
   OopMapCacheEntry* entry = NULL;
@@ -510,6 +541,7 @@ void OopMapCache::lookup(const methodHandle& method,
     if (entry != NULL && !entry->is_empty() && entry->match(method, bci)) {
       entry_for->resource_copy(entry);
       assert(!entry_for->is_empty(), "A non-empty oop map should be returned");
+      publish_to_method_cache(method, entry, probe + i);
       log_debug(interpreter, oopmap)("- found at hash %d", probe + i);
       return;
     }
@@ -537,6 +569,7 @@ void OopMapCache::lookup(const methodHandle& method,
     entry = entry_at(probe + i);
     if (entry == NULL) {
       if (put_at(probe + i, tmp, NULL)) {
+        publish_to_method_cache(method, tmp, probe + i);
         assert(!entry_for->is_empty(), "A non-empty oop map should be returned");
         return;
       }
@@ -549,6 +582,13 @@ void OopMapCache::lookup(const methodHandle& method,
   // where the first entry in the collision array is replaced with the new one.
   OopMapCacheEntry* old = entry_at(probe + 0);
   if (put_at(probe + 0, tmp, old)) {
+    // The evicted entry may still be published in its method's one-entry
+    // cache; clear it now that the entry is no longer reachable from the
+    // table, before it is freed after the safepoint.
+    if (old != NULL && old->method() != NULL) {
+      old->method()->clear_oop_map_entry_cache(old);
+    }
+    publish_to_method_cache(method, tmp, probe + 0);
     enqueue_for_cleanup(old);
   } else {
     enqueue_for_cleanup(tmp);
@@ -574,8 +614,20 @@ void OopMapCache::enqueue_for_cleanup(OopMapCacheEntry* entry) {
   }
 }
 
-// This is called after GC threads are done and nothing is accessing the old_entries
-// list, so no synchronization needed.
+bool OopMapCache::has_cleanup_work() {
+  return _old_entries != NULL;
+}
+
+void OopMapCache::trigger_cleanup() {
+  if (has_cleanup_work()) {
+    MutexLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
+    Service_lock->notify_all();
+  }
+}
+
+// This is called by the ServiceThread while it is _thread_in_vm, so it
+// cannot overlap a safepoint, and entries are only unlinked and enqueued
+// at safepoints; no synchronization is needed.
 void OopMapCache::cleanup_old_entries() {
   OopMapCacheEntry* entry = _old_entries;
   _old_entries = NULL;
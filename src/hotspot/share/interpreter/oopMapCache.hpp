@@ -157,6 +157,9 @@ class OopMapCache : public CHeapObj<mtClass> {
   OopMapCacheEntry* entry_at(int i) const;
   bool put_at(int i, OopMapCacheEntry* entry, OopMapCacheEntry* old);
 
+  // Publish an entry currently at slot i in the method's one-entry cache
+  void publish_to_method_cache(const methodHandle& method, OopMapCacheEntry* entry, int i);
+
   static void enqueue_for_cleanup(OopMapCacheEntry* entry);
 
   void flush();
@@ -174,6 +177,12 @@ class OopMapCache : public CHeapObj<mtClass> {
 
   // Compute an oop map without updating the cache or grabbing any locks (for debugging)
   static void compute_one_oop_map(const methodHandle& method, int bci, InterpreterOopMap* entry);
+
+  // Freeing of enqueued old entries is done on the ServiceThread, away
+  // from the GC pause and its requesting thread; trigger_cleanup wakes
+  // the ServiceThread if there is work.
+  static bool has_cleanup_work();
+  static void trigger_cleanup();
   static void cleanup_old_entries();
 };
 
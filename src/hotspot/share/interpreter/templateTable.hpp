@@ -315,6 +315,7 @@ class TemplateTable: AllStatic {
 
   static void fast_xaccess(TosState state);
   static void fast_accessfield(TosState state);
+  static void fast_agetfield_ifnull();
   static void fast_storefield(TosState state);
 
   static void _breakpoint();
@@ -46,7 +46,8 @@ BFSClosure::BFSClosure(EdgeQueue* edge_queue, EdgeStore* edge_store, BitSet* mar
   _next_frontier_idx(0),
   _prev_frontier_idx(0),
   _dfs_fallback_idx(0),
-  _use_dfs(false) {
+  _use_dfs(false),
+  _processed_root_set(false) {
 }
 
 static void log_frontier_level_summary(size_t level,
@@ -98,10 +99,18 @@ void BFSClosure::log_dfs_fallback() const {
                         );
 }
 
-void BFSClosure::process() {
-
-  process_root_set();
+bool BFSClosure::process() {
+  if (!_processed_root_set) {
+    assert(_current_frontier_level == 0, "invariant");
+    assert(_next_frontier_idx == 0, "invariant");
+    assert(_prev_frontier_idx == 0, "invariant");
+    process_root_set();
+    _processed_root_set = true;
+    _next_frontier_idx = _edge_queue->top();
+  }
   process_queue();
+  // on dfs fallback the queue has been drained, so there is nothing to resume
+  return !GranularTimer::is_finished() || _use_dfs;
 }
 
 void BFSClosure::process_root_set() {
@@ -180,12 +189,12 @@ void BFSClosure::dfs_fallback() {
 }
 
 void BFSClosure::process_queue() {
-  assert(_current_frontier_level == 0, "invariant");
-  assert(_next_frontier_idx == 0, "invariant");
-  assert(_prev_frontier_idx == 0, "invariant");
-
-  _next_frontier_idx = _edge_queue->top();
+  assert(_processed_root_set, "invariant");
   while (!is_complete()) {
+    if (GranularTimer::is_finished()) {
+      // stop at the current queue position; a resumed search picks up here
+      return;
+    }
     iterate(_edge_queue->remove()); // edge_queue.remove() increments bottom
   }
 }
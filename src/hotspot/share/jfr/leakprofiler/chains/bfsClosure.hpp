@@ -45,6 +45,7 @@ class BFSClosure : public BasicOopIterateClosure {
   mutable size_t _prev_frontier_idx;
   size_t _dfs_fallback_idx;
   bool _use_dfs;
+  bool _processed_root_set;
 
   void log_completed_frontier() const;
   void log_dfs_fallback() const;
@@ -64,7 +65,13 @@ class BFSClosure : public BasicOopIterateClosure {
 
  public:
   BFSClosure(EdgeQueue* edge_queue, EdgeStore* edge_store, BitSet* mark_bits);
-  void process();
+
+  // Processes the queue until either the search is complete or the
+  // granular timer has expired. Returns true when the search is complete;
+  // on false, the search is resumable by calling process() again, from the
+  // current queue position, provided no garbage collection has run in the
+  // interim.
+  bool process();
 
   virtual void do_oop(oop* ref);
   virtual void do_oop(narrowOop* ref);
@@ -34,25 +34,31 @@
 // identification purposes in the search for reference chains.
 // The destructor will restore each modified oop with its original mark oop.
 //
-class ObjectSampleMarker : public StackObj {
+// When a search is spread over several safepoints, suspend() swaps the
+// original mark oops back in before mutators are allowed to run, and
+// resume() reinstalls the working marks at the beginning of the next slice.
+//
+class ObjectSampleMarker : public CHeapObj<mtTracing> {
  private:
   class ObjectSampleMarkOop : public ResourceObj {
     friend class ObjectSampleMarker;
    private:
     oop _obj;
     markOop _mark_oop;
+    markOop _working_mark_oop;
     ObjectSampleMarkOop(const oop obj,
                         const markOop mark_oop) : _obj(obj),
-                                                  _mark_oop(mark_oop) {}
+                                                  _mark_oop(mark_oop),
+                                                  _working_mark_oop(NULL) {}
    public:
-    ObjectSampleMarkOop() : _obj(NULL), _mark_oop(NULL) {}
+    ObjectSampleMarkOop() : _obj(NULL), _mark_oop(NULL), _working_mark_oop(NULL) {}
   };
 
   GrowableArray<ObjectSampleMarkOop>* _store;
 
  public:
   ObjectSampleMarker() :
-       _store(new GrowableArray<ObjectSampleMarkOop>(16)) {}
+       _store(new (ResourceObj::C_HEAP, mtTracing) GrowableArray<ObjectSampleMarkOop>(16, true, mtTracing)) {}
   ~ObjectSampleMarker() {
     assert(_store != NULL, "invariant");
     // restore the saved, original, markOop for sample objects
@@ -61,6 +67,35 @@ class ObjectSampleMarker : public StackObj {
       sample_oop._obj->set_mark(sample_oop._mark_oop);
       assert(sample_oop._obj->mark() == sample_oop._mark_oop, "invariant");
     }
+    delete _store;
+  }
+
+  // Swap out the working mark words - the poison value or an installed
+  // edge - and reinstate the originals, so that mutators can run.
+  void suspend() {
+    for (int i = 0; i < _store->length(); ++i) {
+      ObjectSampleMarkOop& sample_oop = _store->at(i);
+      sample_oop._working_mark_oop = sample_oop._obj->mark();
+      sample_oop._obj->set_mark(sample_oop._mark_oop);
+    }
+  }
+
+  // Reinstall the working mark words saved by suspend(). The original mark
+  // is re-read first - mutators may have locked or hashed the object while
+  // the search was suspended.
+  void resume() {
+    for (int i = 0; i < _store->length(); ++i) {
+      ObjectSampleMarkOop& sample_oop = _store->at(i);
+      sample_oop._mark_oop = sample_oop._obj->mark();
+      sample_oop._obj->set_mark(sample_oop._working_mark_oop);
+    }
+  }
+
+  // Drop all entries without touching the objects. Used when a garbage
+  // collection has invalidated the saved oops while the search was
+  // suspended; the original mark words were reinstated by suspend().
+  void discard() {
+    _store->clear();
   }
 
   void mark(oop obj) {
@@ -40,6 +40,7 @@
 #include "jfr/leakprofiler/chains/objectSampleMarker.hpp"
 #include "jfr/recorder/checkpoint/jfrCheckpointWriter.hpp"
 #include "jfr/support/jfrThreadId.hpp"
+#include "jfr/utilities/jfrTimeConverter.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -77,8 +78,89 @@ static void log_edge_queue_summary(const EdgeQueue& edge_queue) {
   }
 }
 
+// State for a path reconstruction that is spread over several safepoints.
+// The reconstruction is resumable only as long as no garbage collection has
+// run in between slices: a collection may move or reclaim objects, which
+// would invalidate the reference addresses held by the edge queue and the
+// edge store as well as the mark bits and the saved sample mark words.
+class ReconstructionState : public CHeapObj<mtTracing> {
+  friend class EmitEventOperation;
+ private:
+  ObjectSampleMarker _marker;
+  EdgeStore _edge_store;
+  BitSet _mark_bits;
+  EdgeQueue _edge_queue;
+  BFSClosure _bfs;
+  jlong _remaining_ticks;
+  unsigned int _collections_at_suspend;
+
+  // The sum increases whenever either counter does; CMS increments only
+  // the full collection count at the start of a concurrent cycle.
+  static unsigned int total_collection_count() {
+    const CollectedHeap* const heap = Universe::heap();
+    return heap->total_collections() + heap->total_full_collections();
+  }
+
+  ReconstructionState(const MemRegion& heap_region,
+                      size_t edge_queue_reservation_size,
+                      jlong cutoff_ticks) :
+    _marker(),
+    _edge_store(),
+    _mark_bits(heap_region),
+    _edge_queue(edge_queue_reservation_size, edge_queue_memory_commit_size(edge_queue_reservation_size)),
+    _bfs(&_edge_queue, &_edge_store, &_mark_bits),
+    _remaining_ticks(cutoff_ticks),
+    _collections_at_suspend(0) {}
+
+  bool initialize() {
+    return _mark_bits.initialize() && _edge_queue.initialize();
+  }
+
+  void suspend() {
+    _marker.suspend();
+    _collections_at_suspend = total_collection_count();
+  }
+
+  bool resume() {
+    if (total_collection_count() != _collections_at_suspend) {
+      return false;
+    }
+    _marker.resume();
+    return true;
+  }
+};
+
+static ReconstructionState* _reconstruction = NULL;
+
+// Per-safepoint budget for the root chain search. Zero means the search
+// runs to its cutoff in a single safepoint.
+static jlong slice_ticks() {
+  if (JfrPathToGcRootsSliceMillis == 0) {
+    return max_jlong;
+  }
+  return JfrTimeConverter::nanos_to_countertime((jlong)JfrPathToGcRootsSliceMillis * NANOSECS_PER_MILLISEC);
+}
+
+// Check the clock more often when the search is sliced; the slice budget
+// would otherwise be overshot by the coarse default granularity.
+static long timer_granularity() {
+  return JfrPathToGcRootsSliceMillis == 0 ? 1000000 : 10000;
+}
+
 void EmitEventOperation::doit() {
-  assert(LeakProfiler::is_running(), "invariant");
+  assert(!_complete, "invariant");
+  if (!LeakProfiler::is_running()) {
+    // the profiler was stopped while a reconstruction was suspended;
+    // the original mark words were reinstated when the last slice suspended
+    ReconstructionState* const suspended = _reconstruction;
+    if (suspended != NULL) {
+      _reconstruction = NULL;
+      suspended->_marker.discard();
+      delete suspended;
+    }
+    _complete = true;
+    return;
+  }
   _object_sampler = LeakProfiler::object_sampler();
   assert(_object_sampler != NULL, "invariant");
 
@@ -91,57 +173,99 @@ void EmitEventOperation::doit() {
   // The VM_Operation::evaluate() which invoked doit()
   // contains a top level ResourceMark
 
-  // save the original markWord for the potential leak objects
-  // to be restored on function exit
-  ObjectSampleMarker marker;
-  if (ObjectSampleCheckpoint::mark(marker, _emit_all) == 0) {
-    return;
-  }
+  _complete = true;
 
-  EdgeStore edge_store;
+  ReconstructionState* state = _reconstruction;
+  if (state == NULL) {
+    if (_cutoff_ticks <= 0) {
+      // no chains
+      write_flat_events();
+      return;
+    }
 
-  GranularTimer::start(_cutoff_ticks, 1000000);
-  if (_cutoff_ticks <= 0) {
-    // no chains
-    write_events(&edge_store);
-    return;
-  }
+    assert(_cutoff_ticks > 0, "invariant");
+
+    // The bitset used for marking is dimensioned as a function of the heap size;
+    // the edge queue is dimensioned as a fraction of the heap size
+    const MemRegion heap_region = Universe::heap()->reserved_region();
+    state = new ReconstructionState(heap_region, edge_queue_memory_reservation(heap_region), _cutoff_ticks);
 
-  assert(_cutoff_ticks > 0, "invariant");
+    // save the original markWord for the potential leak objects
+    // to be restored when the reconstruction concludes
+    if (ObjectSampleCheckpoint::mark(state->_marker, _emit_all) == 0) {
+      delete state;
+      return;
+    }
+
+    // The initialize() routines will attempt to reserve and allocate backing storage memory.
+    // Failure to accommodate will render root chain processing impossible.
+    // As a fallback on failure, just write out the existing samples, flat, without chains.
+    if (!state->initialize()) {
+      log_warning(jfr)("Unable to allocate memory for root chain processing");
+      delete state;
+      write_flat_events();
+      return;
+    }
 
-  // The bitset used for marking is dimensioned as a function of the heap size
-  const MemRegion heap_region = Universe::heap()->reserved_region();
-  BitSet mark_bits(heap_region);
+    // necessary condition for attempting a root set iteration
+    Universe::heap()->ensure_parsability(false);
+
+    RootSetClosure::add_to_queue(&state->_edge_queue);
+    if (state->_edge_queue.is_full()) {
+      // Pathological case where roots don't fit in queue
+      // Do a depth-first search, but mark roots first
+      // to avoid walking sideways over roots
+      GranularTimer::start(_cutoff_ticks, timer_granularity());
+      DFSClosure::find_leaks_from_root_set(&state->_edge_store, &state->_mark_bits);
+      GranularTimer::stop();
+      write_events(&state->_edge_store);
+      log_edge_queue_summary(state->_edge_queue);
+      delete state;
+      return;
+    }
+  } else {
+    // a subsequent slice; reattach to the suspended reconstruction
+    _reconstruction = NULL;
+    if (!state->resume()) {
+      log_debug(jfr, system)("Path reconstruction abandoned; "
+                             "a garbage collection invalidated the suspended state");
+      state->_marker.discard();
+      delete state;
+      write_flat_events();
+      return;
+    }
+  }
 
-  // The edge queue is dimensioned as a fraction of the heap size
-  const size_t edge_queue_reservation_size = edge_queue_memory_reservation(heap_region);
-  EdgeQueue edge_queue(edge_queue_reservation_size, edge_queue_memory_commit_size(edge_queue_reservation_size));
+  const jlong slice = MIN2(state->_remaining_ticks, slice_ticks());
+  GranularTimer::start(slice, timer_granularity());
+  const bool done = state->_bfs.process();
+  GranularTimer::stop();
+  state->_remaining_ticks -= slice;
 
-  // The initialize() routines will attempt to reserve and allocate backing storage memory.
-  // Failure to accommodate will render root chain processing impossible.
-  // As a fallback on failure, just write out the existing samples, flat, without chains.
-  if (!(mark_bits.initialize() && edge_queue.initialize())) {
-    log_warning(jfr)("Unable to allocate memory for root chain processing");
-    write_events(&edge_store);
+  if (!done && state->_remaining_ticks > 0) {
+    // out of slice budget but not yet at the cutoff;
+    // suspend and continue in a later safepoint
+    state->suspend();
+    _reconstruction = state;
+    _complete = false;
     return;
   }
 
-  // necessary condition for attempting a root set iteration
-  Universe::heap()->ensure_parsability(false);
+  write_events(&state->_edge_store);
+  log_edge_queue_summary(state->_edge_queue);
+  delete state;
+}
 
-  RootSetClosure::add_to_queue(&edge_queue);
-  if (edge_queue.is_full()) {
-    // Pathological case where roots don't fit in queue
-    // Do a depth-first search, but mark roots first
-    // to avoid walking sideways over roots
-    DFSClosure::find_leaks_from_root_set(&edge_store, &mark_bits);
-  } else {
-    BFSClosure bfs(&edge_queue, &edge_store, &mark_bits);
-    bfs.process();
+void EmitEventOperation::write_flat_events() {
+  // save the original markWord for the potential leak objects
+  // to be restored on function exit
+  ObjectSampleMarker marker;
+  if (ObjectSampleCheckpoint::mark(marker, _emit_all) == 0) {
+    return;
   }
-  GranularTimer::stop();
+  EdgeStore edge_store;
+  GranularTimer::start(_cutoff_ticks, timer_granularity());
   write_events(&edge_store);
-  log_edge_queue_summary(edge_queue);
 }
 
 int EmitEventOperation::write_events(EdgeStore* edge_store) {
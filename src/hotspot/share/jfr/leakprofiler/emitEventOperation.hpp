@@ -36,27 +36,37 @@ class ObjectSampler;
 
 class VMThread;
 
-// Safepoint operation for emitting object sample events
+// Safepoint operation for emitting object sample events.
+// The path-to-gc-roots reconstruction can be spread over several
+// safepoints in bounded slices; the operation is then executed
+// repeatedly until is_complete() returns true.
 class EmitEventOperation : public VM_Operation {
  private:
   jlong _cutoff_ticks;
   bool _emit_all;
+  bool _complete;
   VMThread* _vm_thread;
   JfrThreadLocal* _vm_thread_local;
   ObjectSampler* _object_sampler;
 
   void write_event(const ObjectSample* sample, EdgeStore* edge_store);
   int write_events(EdgeStore* edge_store);
+  void write_flat_events();
 
  public:
   EmitEventOperation(jlong cutoff_ticks, bool emit_all) :
     _cutoff_ticks(cutoff_ticks),
     _emit_all(emit_all),
+    _complete(false),
     _vm_thread(NULL),
     _vm_thread_local(NULL),
     _object_sampler(NULL) {
   }
 
+  bool is_complete() const {
+    return _complete;
+  }
+
   VMOp_Type type() const {
     return VMOp_GC_HeapInspection;
   }
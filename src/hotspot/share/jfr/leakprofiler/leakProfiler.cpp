@@ -80,7 +80,11 @@ void LeakProfiler::emit_events(jlong cutoff_ticks, bool emit_all) {
     return;
   }
   EmitEventOperation op(cutoff_ticks, emit_all);
-  VMThread::execute(&op);
+  // The operation may process the reference chains in bounded slices,
+  // letting mutators run in between; re-execute until it reports completion.
+  do {
+    VMThread::execute(&op);
+  } while (!op.is_complete());
 }
 
 void LeakProfiler::oops_do(BoolObjectClosure* is_alive, OopClosure* f) {
@@ -36,6 +36,7 @@
 #include "jfr/recorder/service/jfrRecorderService.hpp"
 #include "jfr/recorder/service/jfrRecorderThread.hpp"
 #include "jfr/recorder/storage/jfrStorage.hpp"
+#include "jfr/recorder/storage/jfrStreamRing.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/recorder/stringpool/jfrStringPool.hpp"
 #include "jfr/utilities/jfrTime.hpp"
@@ -258,6 +259,9 @@ bool JfrRecorder::create_components() {
   if (!create_storage()) {
     return false;
   }
+  if (!create_stream_ring()) {
+    return false;
+  }
   if (!create_checkpoint_manager()) {
     return false;
   }
@@ -317,6 +321,10 @@ bool JfrRecorder::create_storage() {
   return _storage != NULL && _storage->initialize();
 }
 
+bool JfrRecorder::create_stream_ring() {
+  return JfrStreamRing::create();
+}
+
 bool JfrRecorder::create_checkpoint_manager() {
   assert(_checkpoint_manager == NULL, "invariant");
   assert(_repository != NULL, "invariant");
@@ -357,6 +365,7 @@ void JfrRecorder::destroy_components() {
     JfrStorage::destroy();
     _storage = NULL;
   }
+  JfrStreamRing::destroy();
   if (_checkpoint_manager != NULL) {
     JfrCheckpointManager::destroy();
     _checkpoint_manager = NULL;
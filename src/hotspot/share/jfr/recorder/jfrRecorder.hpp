@@ -46,6 +46,7 @@ class JfrRecorder : public JfrCHeapObj {
   static bool create_recorder_thread();
   static bool create_stacktrace_repository();
   static bool create_storage();
+  static bool create_stream_ring();
   static bool create_stringpool();
   static bool create_thread_sampling();
   static bool create_components();
@@ -28,6 +28,7 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/service/jfrOptionSet.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
+#include "jfr/support/jfrThreadLocal.hpp"
 #include "jfr/utilities/jfrTypes.hpp"
 #include "memory/allocation.inline.hpp"
 #include "runtime/mutexLocker.hpp"
@@ -103,6 +104,10 @@ void JfrStackTraceRepository::destroy() {
 JfrStackTraceRepository::JfrStackTraceRepository() : _next_id(0), _entries(0) {
   memset(_table, 0, sizeof(_table));
 }
+
+// The generation survives the repository instance so that memoized ids can
+// never leak from a destroyed repository into a new one.
+volatile u4 JfrStackTraceRepository::_generation = 1;
 class JfrFrameType : public JfrSerializer {
  public:
   void serialize(JfrCheckpointWriter& writer) {
@@ -138,9 +143,29 @@ size_t JfrStackTraceRepository::clear() {
   memset(_table, 0, sizeof(_table));
   const size_t processed = _entries;
   _entries = 0;
+  ++_generation;
   return processed;
 }
 
+// A thread that samples repeatedly while its stack does not change would
+// re-insert the identical trace on every sample. Each thread memoizes the
+// last trace it installed and reuses the id without touching the shared
+// table, as long as the repository has not been cleared in between (the
+// generation matches). The discriminator is the same hash the table itself
+// uses for its buckets, qualified with the frame count.
+bool JfrStackTraceRepository::last_trace_matches(const JfrThreadLocal* tl, const JfrStackTrace& stacktrace) const {
+  return tl->last_stack_trace_id() != 0 &&
+         tl->last_stack_trace_generation() == _generation &&
+         tl->last_stack_trace_hash() == stacktrace._hash &&
+         tl->last_stack_trace_nr_of_frames() == stacktrace._nr_of_frames;
+}
+
+void JfrStackTraceRepository::remember_last_trace(JfrThreadLocal* tl, const JfrStackTrace& stacktrace, traceid tid) const {
+  if (tid != 0) {
+    tl->set_last_stack_trace(tid, stacktrace._hash, stacktrace._nr_of_frames, _generation);
+  }
+}
+
 traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
   MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
   const size_t index = stacktrace._hash % TABLE_SIZE;
@@ -214,11 +239,16 @@ traceid JfrStackTraceRepository::record_for(JavaThread* thread, int skip, JfrSta
   if (!stacktrace.record_safe(thread, skip)) {
     return 0;
   }
+  JfrThreadLocal* const tl = thread->jfr_thread_local();
+  if (last_trace_matches(tl, stacktrace)) {
+    return tl->last_stack_trace_id();
+  }
   traceid tid = add(stacktrace);
   if (tid == 0) {
     stacktrace.resolve_linenos();
     tid = add(stacktrace);
   }
+  remember_last_trace(tl, stacktrace, tid);
   return tid;
 }
 
@@ -228,12 +258,17 @@ traceid JfrStackTraceRepository::record_for(JavaThread* thread, int skip, JfrSta
   if (!stacktrace.record_safe(thread, skip, true)) {
     return 0;
   }
+  *hash = stacktrace._hash;
+  JfrThreadLocal* const tl = thread->jfr_thread_local();
+  if (last_trace_matches(tl, stacktrace)) {
+    return tl->last_stack_trace_id();
+  }
   traceid tid = add(stacktrace);
   if (tid == 0) {
     stacktrace.resolve_linenos();
     tid = add(stacktrace);
   }
-  *hash = stacktrace._hash;
+  remember_last_trace(tl, stacktrace, tid);
   return tid;
 }
 
@@ -258,6 +293,7 @@ size_t JfrStackTraceRepository::write_impl(JfrChunkWriter& sw, bool clear) {
   if (clear) {
     memset(_table, 0, sizeof(_table));
     _entries = 0;
+    ++_generation;
   }
   return count;
 }
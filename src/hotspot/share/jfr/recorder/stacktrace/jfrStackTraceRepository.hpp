@@ -32,6 +32,7 @@ class frame;
 class JavaThread;
 class JfrCheckpointWriter;
 class JfrChunkWriter;
+class JfrThreadLocal;
 class Method;
 
 class JfrStackFrame {
@@ -128,6 +129,14 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   traceid _next_id;
   u4 _entries;
 
+  // Stepped each time the table is cleared. Threads memoize the last trace
+  // they installed together with the generation (see JfrThreadLocal), so a
+  // repeated identical stack can reuse the id without taking the lock.
+  static volatile u4 _generation;
+
+  bool last_trace_matches(const JfrThreadLocal* tl, const JfrStackTrace& stacktrace) const;
+  void remember_last_trace(JfrThreadLocal* tl, const JfrStackTrace& stacktrace, traceid tid) const;
+
   size_t write_impl(JfrChunkWriter& cw, bool clear);
   traceid record_for(JavaThread* thread, int skip, JfrStackFrame* frames, u4 max_frames);
   traceid record_for(JavaThread* thread, int skip, JfrStackFrame* frames, u4 max_frames, unsigned int* hash);
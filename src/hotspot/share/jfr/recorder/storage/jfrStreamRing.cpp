@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jfr/recorder/storage/jfrStreamRing.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/orderAccess.hpp"
+#include "runtime/os.inline.hpp"
+#include "utilities/align.hpp"
+
+JfrStreamRing* JfrStreamRing::_instance = NULL;
+
+JfrStreamRing::JfrStreamRing() : _fd(invalid_fd), _base(NULL), _size(0) {}
+
+JfrStreamRing::~JfrStreamRing() {
+  if (_base != NULL) {
+    os::unmap_memory(_base, _size);
+    _base = NULL;
+  }
+  if (_fd != invalid_fd) {
+    os::close(_fd);
+    _fd = invalid_fd;
+  }
+}
+
+bool JfrStreamRing::initialize(const char* path, size_t size) {
+  assert(path != NULL, "invariant");
+  assert(_base == NULL, "invariant");
+  const size_t capacity = align_up(MAX2(size, (size_t)os::vm_page_size()), (size_t)os::vm_page_size());
+  _size = sizeof(Header) + capacity;
+  remove(path);
+  _fd = os::open(path, O_CREAT | O_RDWR | O_TRUNC, S_IREAD | S_IWRITE);
+  if (_fd == invalid_fd) {
+    log_warning(jfr, system)("Unable to create JFR stream ring file %s", path);
+    return false;
+  }
+  // os::map_memory() maps private; a shared mapping is required for the
+  // contents to be visible to a consumer process.
+  _base = os::map_memory_to_file(NULL, _size, _fd);
+  if (_base == NULL) {
+    log_warning(jfr, system)("Unable to map JFR stream ring file %s", path);
+    return false;
+  }
+  Header* const h = header();
+  h->_magic = RING_MAGIC;
+  h->_major = RING_VERSION_MAJOR;
+  h->_minor = RING_VERSION_MINOR;
+  h->_header_size = (u4)sizeof(Header);
+  h->_reserved = 0;
+  h->_capacity = (u8)capacity;
+  h->_head = 0;
+  OrderAccess::release_store(&h->_sequence, (u8)0);
+  log_info(jfr, system)("JFR stream ring of " SIZE_FORMAT " bytes mapped at %s", capacity, path);
+  return true;
+}
+
+void JfrStreamRing::put_bytes(u8 head, const u1* data, size_t size) {
+  const size_t offset = (size_t)(head % capacity());
+  const size_t contiguous = capacity() - offset;
+  if (size <= contiguous) {
+    memcpy(data_area() + offset, data, size);
+    return;
+  }
+  memcpy(data_area() + offset, data, contiguous);
+  memcpy(data_area(), data + contiguous, size - contiguous);
+}
+
+void JfrStreamRing::write(const u1* data, size_t size) {
+  assert(data != NULL, "invariant");
+  assert(size > 0, "invariant");
+  Header* const h = header();
+  const u8 record_size = (u8)size + sizeof(u4);
+  if (record_size > h->_capacity) {
+    log_warning(jfr, system)("Dropping " SIZE_FORMAT " byte buffer too large for the JFR stream ring", size);
+    return;
+  }
+  // Acquire the seqlock; an odd sequence tells the consumer, and a
+  // competing writer, that an update is in progress.
+  u8 seq = h->_sequence;
+  while (true) {
+    if ((seq & 1) == 0) {
+      const u8 prev = Atomic::cmpxchg(seq + 1, &h->_sequence, seq);
+      if (prev == seq) {
+        break;
+      }
+      seq = prev;
+    } else {
+      seq = h->_sequence;
+    }
+  }
+  const u8 head = h->_head;
+  const u4 length = (u4)size;
+  put_bytes(head, (const u1*)&length, sizeof(u4));
+  put_bytes(head + sizeof(u4), data, size);
+  OrderAccess::release_store(&h->_head, head + record_size);
+  OrderAccess::release_store(&h->_sequence, seq + 2);
+}
+
+bool JfrStreamRing::create() {
+  assert(_instance == NULL, "invariant");
+  if (JfrStreamRingFile == NULL) {
+    return true;
+  }
+  _instance = new JfrStreamRing();
+  if (_instance == NULL || !_instance->initialize(JfrStreamRingFile, JfrStreamRingSize)) {
+    destroy();
+    return false;
+  }
+  return true;
+}
+
+void JfrStreamRing::destroy() {
+  if (_instance != NULL) {
+    JfrStreamRing* const instance = _instance;
+    _instance = NULL;
+    delete instance;
+  }
+}
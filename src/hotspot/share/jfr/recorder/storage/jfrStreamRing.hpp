@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_JFR_RECORDER_STORAGE_JFRSTREAMRING_HPP
+#define SHARE_JFR_RECORDER_STORAGE_JFRSTREAMRING_HPP
+
+#include "jfr/utilities/jfrAllocation.hpp"
+#include "jfr/utilities/jfrTypes.hpp"
+
+//
+// A memory-mapped ring buffer through which flushed event buffers are
+// published to a same-host consumer process, without the round trip over
+// chunk files. Enabled with -XX:JfrStreamRingFile=<path>. The mapping
+// starts with a fixed header, immediately followed by the data area:
+//
+//   u4 magic       "JFRR"
+//   u2 major       protocol version
+//   u2 minor
+//   u4 header size offset of the data area from the start of the mapping
+//   u4 reserved
+//   u8 capacity    size of the data area in bytes
+//   u8 sequence    seqlock; odd while a write is in progress
+//   u8 head        total number of bytes published since the ring was created
+//
+// Each record is a u4 length in native byte order followed by that many
+// bytes of event data, written at offset head % capacity with wrap-around.
+// A consumer reads sequence, then head and data, then re-reads sequence;
+// if sequence was odd or changed, the read is retried. A consumer that
+// falls more than capacity bytes behind head has lost data and must
+// resynchronize by adopting the current head, which is always at a record
+// boundary. Events reference constants (metadata, stack traces, strings)
+// serialized through the chunk files, so a consumer still resolves those
+// from the repository.
+//
+class JfrStreamRing : public JfrCHeapObj {
+  friend class JfrRecorder;
+ private:
+  struct Header {
+    u4 _magic;
+    u2 _major;
+    u2 _minor;
+    u4 _header_size;
+    u4 _reserved;
+    u8 _capacity;
+    volatile u8 _sequence;
+    volatile u8 _head;
+  };
+
+  static const u4 RING_MAGIC = 0x4a465252; // "JFRR"
+  static const u2 RING_VERSION_MAJOR = 1;
+  static const u2 RING_VERSION_MINOR = 0;
+
+  static JfrStreamRing* _instance;
+
+  fio_fd _fd;
+  char* _base;
+  size_t _size;
+
+  Header* header() const { return (Header*)_base; }
+  char* data_area() const { return _base + sizeof(Header); }
+  size_t capacity() const { return _size - sizeof(Header); }
+  void put_bytes(u8 head, const u1* data, size_t size);
+  void write(const u1* data, size_t size);
+
+  JfrStreamRing();
+  ~JfrStreamRing();
+  bool initialize(const char* path, size_t size);
+
+  static bool create();
+  static void destroy();
+
+ public:
+  static void publish(const u1* data, size_t size) {
+    if (_instance != NULL) {
+      _instance->write(data, size);
+    }
+  }
+};
+
+#endif // SHARE_JFR_RECORDER_STORAGE_JFRSTREAMRING_HPP
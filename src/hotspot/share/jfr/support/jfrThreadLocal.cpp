@@ -53,6 +53,10 @@ JfrThreadLocal::JfrThreadLocal() :
   _cpu_time(0),
   _wallclock_time(os::javaTimeNanos()),
   _stack_trace_hash(0),
+  _last_stack_trace_id(0),
+  _last_stack_trace_hash(0),
+  _last_stack_trace_nr_of_frames(0),
+  _last_stack_trace_generation(0),
   _stackdepth(0),
   _entering_suspend_flag(0),
   _dead(false) {}
@@ -48,6 +48,10 @@ class JfrThreadLocal {
   jlong _cpu_time;
   jlong _wallclock_time;
   unsigned int _stack_trace_hash;
+  traceid _last_stack_trace_id;
+  unsigned int _last_stack_trace_hash;
+  u4 _last_stack_trace_nr_of_frames;
+  u4 _last_stack_trace_generation;
   mutable u4 _stackdepth;
   volatile jint _entering_suspend_flag;
   bool _dead;
@@ -151,6 +155,33 @@ class JfrThreadLocal {
     return _stack_trace_hash;
   }
 
+  // Memoization of the last stack trace this thread installed into the
+  // stack trace repository. It is only valid while the recorded repository
+  // generation is current; the repository steps the generation when it is
+  // cleared (see JfrStackTraceRepository).
+  void set_last_stack_trace(traceid id, unsigned int hash, u4 nr_of_frames, u4 generation) {
+    _last_stack_trace_id = id;
+    _last_stack_trace_hash = hash;
+    _last_stack_trace_nr_of_frames = nr_of_frames;
+    _last_stack_trace_generation = generation;
+  }
+
+  traceid last_stack_trace_id() const {
+    return _last_stack_trace_id;
+  }
+
+  unsigned int last_stack_trace_hash() const {
+    return _last_stack_trace_hash;
+  }
+
+  u4 last_stack_trace_nr_of_frames() const {
+    return _last_stack_trace_nr_of_frames;
+  }
+
+  u4 last_stack_trace_generation() const {
+    return _last_stack_trace_generation;
+  }
+
   void set_trace_block() {
     _entering_suspend_flag = 1;
   }
@@ -38,6 +38,10 @@ bool JfrTime::initialize() {
   if (!initialized) {
 #if defined(X86) && !defined(ZERO)
     _ft_enabled = Rdtsc::initialize();
+    if (_ft_enabled) {
+      // Monitor that the tsc-derived time keeps tracking the os clock.
+      Rdtsc::start_drift_check();
+    }
 #else
     _ft_enabled = false;
 #endif
@@ -106,10 +106,13 @@ OopMap* CodeInstaller::create_oop_map(JVMCIObject debug_info, JVMCI_TRAPS) {
   if (objects.is_null() || derivedBase.is_null() || sizeInBytes.is_null()) {
     JVMCI_THROW_NULL(NullPointerException);
   }
-  if (JVMCIENV->get_length(objects) != JVMCIENV->get_length(derivedBase) || JVMCIENV->get_length(objects) != JVMCIENV->get_length(sizeInBytes)) {
-    JVMCI_ERROR_NULL("arrays in reference map have different sizes: %d %d %d", JVMCIENV->get_length(objects), JVMCIENV->get_length(derivedBase), JVMCIENV->get_length(sizeInBytes));
+  int objects_length = JVMCIENV->get_length(objects);
+  int derived_base_length = JVMCIENV->get_length(derivedBase);
+  int size_in_bytes_length = JVMCIENV->get_length(sizeInBytes);
+  if (objects_length != derived_base_length || objects_length != size_in_bytes_length) {
+    JVMCI_ERROR_NULL("arrays in reference map have different sizes: %d %d %d", objects_length, derived_base_length, size_in_bytes_length);
   }
-  for (int i = 0; i < JVMCIENV->get_length(objects); i++) {
+  for (int i = 0; i < objects_length; i++) {
     JVMCIObject location = JVMCIENV->get_object_at(objects, i);
     JVMCIObject baseLocation = JVMCIENV->get_object_at(derivedBase, i);
     jint bytes = JVMCIENV->get_int_at(sizeInBytes, i);
@@ -147,7 +150,8 @@ OopMap* CodeInstaller::create_oop_map(JVMCIObject debug_info, JVMCI_TRAPS) {
   if (callee_save_info.is_non_null()) {
     JVMCIObjectArray registers = jvmci_env()->get_RegisterSaveLayout_registers(callee_save_info);
     JVMCIPrimitiveArray slots = jvmci_env()->get_RegisterSaveLayout_slots(callee_save_info);
-    for (jint i = 0; i < JVMCIENV->get_length(slots); i++) {
+    jint slots_length = JVMCIENV->get_length(slots);
+    for (jint i = 0; i < slots_length; i++) {
       JVMCIObject jvmci_reg = JVMCIENV->get_object_at(registers, i);
       jint jvmci_reg_number = jvmci_env()->get_code_Register_number(jvmci_reg);
       VMReg hotspot_reg = CodeInstaller::get_hotspot_reg(jvmci_reg_number, JVMCI_CHECK_NULL);
@@ -423,7 +427,8 @@ void CodeInstaller::record_object_value(ObjectValue* sv, JVMCIObject value, Grow
 
   JVMCIObjectArray values = jvmci_env()->get_VirtualObject_values(value);
   JVMCIObjectArray slotKinds = jvmci_env()->get_VirtualObject_slotKinds(value);
-  for (jint i = 0; i < JVMCIENV->get_length(values); i++) {
+  jint values_length = JVMCIENV->get_length(values);
+  for (jint i = 0; i < values_length; i++) {
     ScopeValue* cur_second = NULL;
     JVMCIObject object = JVMCIENV->get_object_at(values, i);
     BasicType type = jvmci_env()->kindToBasicType(JVMCIENV->get_object_at(slotKinds, i), JVMCI_CHECK);
@@ -717,7 +722,8 @@ int CodeInstaller::estimate_stubs_size(JVMCI_TRAPS) {
   int aot_call_stubs = 0;
   int trampoline_stubs = 0;
   JVMCIObjectArray sites = this->sites();
-  for (int i = 0; i < JVMCIENV->get_length(sites); i++) {
+  int num_sites = JVMCIENV->get_length(sites);
+  for (int i = 0; i < num_sites; i++) {
     JVMCIObject site = JVMCIENV->get_object_at(sites, i);
     if (!site.is_null()) {
       if (jvmci_env()->isa_site_Mark(site)) {
@@ -765,7 +771,8 @@ int CodeInstaller::estimate_stubs_size(JVMCI_TRAPS) {
 JVMCI::CodeInstallResult CodeInstaller::initialize_buffer(CodeBuffer& buffer, bool check_size, JVMCI_TRAPS) {
   HandleMark hm;
   JVMCIObjectArray sites = this->sites();
-  int locs_buffer_size = JVMCIENV->get_length(sites) * (relocInfo::length_limit + sizeof(relocInfo));
+  int num_sites = JVMCIENV->get_length(sites);
+  int locs_buffer_size = num_sites * (relocInfo::length_limit + sizeof(relocInfo));
 
   // Allocate enough space in the stub section for the static call
   // stubs.  Stubs have extra relocs but they are managed by the stub
@@ -801,9 +808,11 @@ JVMCI::CodeInstallResult CodeInstaller::initialize_buffer(CodeBuffer& buffer, bo
   JVMCIENV->copy_bytes_to(code(), (jbyte*) _instructions->start(), 0, _code_size);
   _instructions->set_end(end_pc);
 
-  for (int i = 0; i < JVMCIENV->get_length(data_section_patches()); i++) {
+  JVMCIObjectArray patches = data_section_patches();
+  int num_patches = JVMCIENV->get_length(patches);
+  for (int i = 0; i < num_patches; i++) {
     // HandleMark hm(THREAD);
-    JVMCIObject patch = JVMCIENV->get_object_at(data_section_patches(), i);
+    JVMCIObject patch = JVMCIENV->get_object_at(patches, i);
     if (patch.is_null()) {
       JVMCI_THROW_(NullPointerException, JVMCI::ok);
     }
@@ -847,8 +856,13 @@ JVMCI::CodeInstallResult CodeInstaller::initialize_buffer(CodeBuffer& buffer, bo
       JVMCI_ERROR_OK("invalid constant in data section: %s", jvmci_env()->klass_name(constant));
     }
   }
+  // Resolve the infopoint reason constants once instead of once per site.
+  JVMCIObject reason_safepoint = jvmci_env()->get_site_InfopointReason_SAFEPOINT();
+  JVMCIObject reason_call = jvmci_env()->get_site_InfopointReason_CALL();
+  JVMCIObject reason_implicit_exception = jvmci_env()->get_site_InfopointReason_IMPLICIT_EXCEPTION();
+
   jint last_pc_offset = -1;
-  for (int i = 0; i < JVMCIENV->get_length(sites); i++) {
+  for (int i = 0; i < num_sites; i++) {
     // HandleMark hm(THREAD);
     JVMCIObject site = JVMCIENV->get_object_at(sites, i);
     if (site.is_null()) {
@@ -863,15 +877,15 @@ JVMCI::CodeInstallResult CodeInstaller::initialize_buffer(CodeBuffer& buffer, bo
     } else if (jvmci_env()->isa_site_Infopoint(site)) {
       // three reasons for infopoints denote actual safepoints
       JVMCIObject reason = jvmci_env()->get_site_Infopoint_reason(site);
-      if (JVMCIENV->equals(reason, jvmci_env()->get_site_InfopointReason_SAFEPOINT()) ||
-          JVMCIENV->equals(reason, jvmci_env()->get_site_InfopointReason_CALL()) ||
-          JVMCIENV->equals(reason, jvmci_env()->get_site_InfopointReason_IMPLICIT_EXCEPTION())) {
+      if (JVMCIENV->equals(reason, reason_safepoint) ||
+          JVMCIENV->equals(reason, reason_call) ||
+          JVMCIENV->equals(reason, reason_implicit_exception)) {
         TRACE_jvmci_4("safepoint at %i", pc_offset);
         site_Safepoint(buffer, pc_offset, site, JVMCI_CHECK_OK);
         if (_orig_pc_offset < 0) {
           JVMCI_ERROR_OK("method contains safepoint, but has no deopt rescue slot");
         }
-        if (JVMCIENV->equals(reason, jvmci_env()->get_site_InfopointReason_IMPLICIT_EXCEPTION())) {
+        if (JVMCIENV->equals(reason, reason_implicit_exception)) {
           TRACE_jvmci_4("implicit exception at %i", pc_offset);
           _implicit_exception_table.add_deoptimize(pc_offset);
         }
@@ -902,7 +916,8 @@ JVMCI::CodeInstallResult CodeInstaller::initialize_buffer(CodeBuffer& buffer, bo
 
 #ifndef PRODUCT
   if (comments().is_non_null()) {
-    for (int i = 0; i < JVMCIENV->get_length(comments()); i++) {
+    int num_comments = JVMCIENV->get_length(comments());
+    for (int i = 0; i < num_comments; i++) {
       JVMCIObject comment = JVMCIENV->get_object_at(comments(), i);
       assert(jvmci_env()->isa_HotSpotCompiledCode_Comment(comment), "cce");
       jint offset = jvmci_env()->get_HotSpotCompiledCode_Comment_pcOffset(comment);
@@ -986,9 +1001,10 @@ GrowableArray<ScopeValue*>* CodeInstaller::record_virtual_objects(JVMCIObject de
   if (virtualObjects.is_null()) {
     return NULL;
   }
-  GrowableArray<ScopeValue*>* objects = new GrowableArray<ScopeValue*>(JVMCIENV->get_length(virtualObjects), JVMCIENV->get_length(virtualObjects), NULL);
+  int virtual_objects_length = JVMCIENV->get_length(virtualObjects);
+  GrowableArray<ScopeValue*>* objects = new GrowableArray<ScopeValue*>(virtual_objects_length, virtual_objects_length, NULL);
   // Create the unique ObjectValues
-  for (int i = 0; i < JVMCIENV->get_length(virtualObjects); i++) {
+  for (int i = 0; i < virtual_objects_length; i++) {
     // HandleMark hm(THREAD);
     JVMCIObject value = JVMCIENV->get_object_at(virtualObjects, i);
     int id = jvmci_env()->get_VirtualObject_id(value);
@@ -1008,7 +1024,7 @@ GrowableArray<ScopeValue*>* CodeInstaller::record_virtual_objects(JVMCIObject de
   }
   // All the values which could be referenced by the VirtualObjects
   // exist, so now describe all the VirtualObjects themselves.
-  for (int i = 0; i < JVMCIENV->get_length(virtualObjects); i++) {
+  for (int i = 0; i < virtual_objects_length; i++) {
     // HandleMark hm(THREAD);
     JVMCIObject value = JVMCIENV->get_object_at(virtualObjects, i);
     int id = jvmci_env()->get_VirtualObject_id(value);
@@ -1104,21 +1120,23 @@ void CodeInstaller::record_scope(jint pc_offset, JVMCIObject position, ScopeMode
     if (values.is_null() || slotKinds.is_null()) {
       JVMCI_THROW(NullPointerException);
     }
-    if (local_count + expression_count + monitor_count != JVMCIENV->get_length(values)) {
-      JVMCI_ERROR("unexpected values length %d in scope (%d locals, %d expressions, %d monitors)", JVMCIENV->get_length(values), local_count, expression_count, monitor_count);
+    jint values_length = JVMCIENV->get_length(values);
+    jint slot_kinds_length = JVMCIENV->get_length(slotKinds);
+    if (local_count + expression_count + monitor_count != values_length) {
+      JVMCI_ERROR("unexpected values length %d in scope (%d locals, %d expressions, %d monitors)", values_length, local_count, expression_count, monitor_count);
     }
-    if (local_count + expression_count != JVMCIENV->get_length(slotKinds)) {
-      JVMCI_ERROR("unexpected slotKinds length %d in scope (%d locals, %d expressions)", JVMCIENV->get_length(slotKinds), local_count, expression_count);
+    if (local_count + expression_count != slot_kinds_length) {
+      JVMCI_ERROR("unexpected slotKinds length %d in scope (%d locals, %d expressions)", slot_kinds_length, local_count, expression_count);
     }
 
     GrowableArray<ScopeValue*>* locals = local_count > 0 ? new GrowableArray<ScopeValue*> (local_count) : NULL;
     GrowableArray<ScopeValue*>* expressions = expression_count > 0 ? new GrowableArray<ScopeValue*> (expression_count) : NULL;
     GrowableArray<MonitorValue*>* monitors = monitor_count > 0 ? new GrowableArray<MonitorValue*> (monitor_count) : NULL;
 
-    TRACE_jvmci_2("Scope at bci %d with %d values", bci, JVMCIENV->get_length(values));
+    TRACE_jvmci_2("Scope at bci %d with %d values", bci, values_length);
     TRACE_jvmci_2("%d locals %d expressions, %d monitors", local_count, expression_count, monitor_count);
 
-    for (jint i = 0; i < JVMCIENV->get_length(values); i++) {
+    for (jint i = 0; i < values_length; i++) {
       // HandleMark hm(THREAD);
       ScopeValue* second = NULL;
       JVMCIObject value = JVMCIENV->get_object_at(values, i);
@@ -1142,7 +1160,7 @@ void CodeInstaller::record_scope(jint pc_offset, JVMCIObject position, ScopeMode
       }
       if (second != NULL) {
         i++;
-        if (i >= JVMCIENV->get_length(values) || !JVMCIENV->equals(JVMCIENV->get_object_at(values, i), jvmci_env()->get_Value_ILLEGAL())) {
+        if (i >= values_length || !JVMCIENV->equals(JVMCIENV->get_object_at(values, i), jvmci_env()->get_Value_ILLEGAL())) {
           JVMCI_ERROR("double-slot value not followed by Value.ILLEGAL");
         }
       }
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#include "precompiled.hpp"
+#include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
+#include "logging/logFileOutput.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
+#include "utilities/vmError.hpp"
+
+AsyncLogWriter* volatile AsyncLogWriter::_instance = NULL;
+
+AsyncLogMessage::~AsyncLogMessage() {
+  os::free(_message);
+}
+
+size_t AsyncLogMessage::size() const {
+  return sizeof(AsyncLogMessage) + strlen(_message) + 1;
+}
+
+AsyncLogWriter::AsyncLogWriter()
+  : _lock(1), _write_lock(1), _data_ready(0), _head(NULL), _tail(NULL), _buffered_bytes(0) {
+}
+
+void AsyncLogWriter::enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg) {
+  char* copy = os::strdup(msg, mtLogging);
+  AsyncLogMessage* m = copy != NULL ? new AsyncLogMessage(&output, decorations, copy) : NULL;
+  if (m == NULL) {
+    // Failed allocations are treated like buffer overflows.
+    Atomic::inc(&output._dropped_messages);
+    return;
+  }
+
+  bool was_empty = false;
+  _lock.wait();
+  if (_buffered_bytes + m->size() > AsyncLogBufferSize) {
+    Atomic::inc(&output._dropped_messages);
+    _lock.signal();
+    delete m;
+    return;
+  }
+  if (_head == NULL) {
+    _head = _tail = m;
+    was_empty = true;
+  } else {
+    _tail->set_next(m);
+    _tail = m;
+  }
+  _buffered_bytes += m->size();
+  _lock.signal();
+
+  if (was_empty) {
+    _data_ready.signal();
+  }
+}
+
+void AsyncLogWriter::write() {
+  _lock.wait();
+  AsyncLogMessage* m = _head;
+  _head = _tail = NULL;
+  _buffered_bytes = 0;
+  _lock.signal();
+
+  // The detached messages are written without holding the queue lock,
+  // so logging threads enqueue concurrently with the file I/O.
+  while (m != NULL) {
+    AsyncLogMessage* next = m->next();
+    m->output()->write_blocking(m->decorations(), m->message());
+    delete m;
+    m = next;
+  }
+}
+
+void AsyncLogWriter::run() {
+  while (true) {
+    _data_ready.wait();
+    _write_lock.wait();
+    write();
+    _write_lock.signal();
+  }
+}
+
+AsyncLogWriter* AsyncLogWriter::instance() {
+  if (VMError::is_error_reported()) {
+    // During error reporting the flush thread may be suspended or dead;
+    // write synchronously so the messages reach the output.
+    return NULL;
+  }
+  return OrderAccess::load_acquire(&_instance);
+}
+
+void AsyncLogWriter::initialize() {
+  if (!AsyncLogging) {
+    return;
+  }
+  assert(_instance == NULL, "initialize() should only be invoked once");
+
+  AsyncLogWriter* writer = new AsyncLogWriter();
+  if (os::create_thread(writer, os::os_thread)) {
+    os::start_thread(writer);
+    OrderAccess::release_store(&_instance, writer);
+  } else {
+    log_warning(logging)("Failed to create thread for asynchronous logging, falling back to synchronous logging");
+    delete writer;
+  }
+}
+
+void AsyncLogWriter::flush() {
+  AsyncLogWriter* writer = _instance;
+  if (writer != NULL) {
+    writer->_write_lock.wait();
+    writer->write();
+    writer->_write_lock.signal();
+  }
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#ifndef SHARE_LOGGING_LOGASYNCWRITER_HPP
+#define SHARE_LOGGING_LOGASYNCWRITER_HPP
+
+#include "logging/logDecorations.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/semaphore.hpp"
+#include "runtime/thread.hpp"
+
+class LogFileOutput;
+
+// A single log message that has been taken off the logging thread,
+// waiting to be written to its output by the flush thread. The message
+// text is a C heap copy owned by this object; the decorations were
+// created on the logging thread so that timestamps, thread ids etc.
+// describe the log site rather than the flush thread.
+class AsyncLogMessage : public CHeapObj<mtLogging> {
+  LogFileOutput* _output;
+  const LogDecorations _decorations;
+  char* _message;
+  AsyncLogMessage* _next;
+
+ public:
+  AsyncLogMessage(LogFileOutput* output, const LogDecorations& decorations, char* message)
+    : _output(output), _decorations(decorations), _message(message), _next(NULL) {}
+  ~AsyncLogMessage();
+
+  LogFileOutput* output() const { return _output; }
+  const LogDecorations& decorations() const { return _decorations; }
+  const char* message() const { return _message; }
+
+  AsyncLogMessage* next() const { return _next; }
+  void set_next(AsyncLogMessage* next) { _next = next; }
+
+  size_t size() const;
+};
+
+// The flush thread for asynchronous unified logging (-XX:+AsyncLogging).
+// File outputs enqueue their messages here instead of writing them, so
+// that the logging thread never blocks on file I/O. The queue is bounded
+// by AsyncLogBufferSize bytes; messages arriving while the queue is full
+// are dropped and the drops are reported on the affected output once
+// room becomes available again.
+//
+// The queue is protected by a binary semaphore rather than a mutex so
+// that it can be used by any thread, including threads that are not
+// attached to the VM, and at any point during a safepoint.
+class AsyncLogWriter : public NonJavaThread {
+ private:
+  static AsyncLogWriter* volatile _instance;
+
+  Semaphore _lock;        // protects the message queue
+  Semaphore _write_lock;  // serializes the flush thread with flush() callers
+  Semaphore _data_ready;  // signalled on empty-to-nonempty queue transitions
+  AsyncLogMessage* _head;
+  AsyncLogMessage* _tail;
+  size_t _buffered_bytes;
+
+  AsyncLogWriter();
+
+  // Detaches all queued messages and writes them on the calling thread.
+  void write();
+
+ public:
+  void enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg);
+
+  virtual void run();
+  virtual char* name() const { return (char*)"Log Flush Thread"; }
+
+  // NULL when -XX:-AsyncLogging, before initialize() has been called,
+  // or while an error is being reported; in all those cases outputs
+  // write synchronously on the logging thread.
+  static AsyncLogWriter* instance();
+
+  // Creates and starts the flush thread; called once during VM startup.
+  static void initialize();
+
+  // Writes all pending messages on the calling thread and waits for any
+  // write already in progress on the flush thread to complete. Used before
+  // an output is deleted and during error reporting, where the flush
+  // thread can not be expected to make progress.
+  static void flush();
+};
+
+#endif // SHARE_LOGGING_LOGASYNCWRITER_HPP
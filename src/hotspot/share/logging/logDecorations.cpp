@@ -37,6 +37,16 @@ LogDecorations::LogDecorations(LogLevelType level, const LogTagSet &tagset, cons
   create_decorations(decorators);
 }
 
+LogDecorations::LogDecorations(const LogDecorations& other)
+    : _level(other._level), _tagset(other._tagset), _millis(other._millis) {
+  memcpy(_decorations_buffer, other._decorations_buffer, sizeof(_decorations_buffer));
+  for (uint i = 0; i < LogDecorators::Count; i++) {
+    const char* offset = other._decoration_offset[i];
+    _decoration_offset[i] = offset == NULL ? NULL :
+        _decorations_buffer + (offset - other._decorations_buffer);
+  }
+}
+
 void LogDecorations::initialize(jlong vm_start_time) {
   char buffer[1024];
   if (os::get_host_name(buffer, sizeof(buffer))){
@@ -51,6 +61,8 @@ void LogDecorations::create_decorations(const LogDecorators &decorators) {
   if (decorators.is_decorator(LogDecorators::full_name##_decorator)) { \
     _decoration_offset[LogDecorators::full_name##_decorator] = position; \
     position = create_##full_name##_decoration(position) + 1; \
+  } else { \
+    _decoration_offset[LogDecorators::full_name##_decorator] = NULL; \
   }
   DECORATOR_LIST
 #undef DECORATOR
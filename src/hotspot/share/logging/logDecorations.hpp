@@ -52,6 +52,11 @@ class LogDecorations {
 
   LogDecorations(LogLevelType level, const LogTagSet& tagset, const LogDecorators& decorators);
 
+  // Copies the created decorations, rebasing them into the buffer of the
+  // copy. Used by asynchronous logging to take decorations off the stack
+  // of the logging thread.
+  LogDecorations(const LogDecorations& other);
+
   void set_level(LogLevelType level) {
     _level = level;
   }
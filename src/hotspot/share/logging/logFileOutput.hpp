@@ -32,6 +32,7 @@ class LogDecorations;
 
 // The log file output, with support for file rotation based on a target size.
 class LogFileOutput : public LogFileStreamOutput {
+  friend class AsyncLogWriter;
  private:
   static const char* const FileOpenMode;
   static const char* const FileCountOptionKey;
@@ -60,6 +61,10 @@ class LogFileOutput : public LogFileStreamOutput {
   size_t  _rotate_size;
   size_t  _current_size;
 
+  // Number of messages dropped by asynchronous logging because the buffer
+  // was full. Reported on this output and reset by the next blocking write.
+  volatile size_t _dropped_messages;
+
   // Semaphore used for synchronizing file rotations and writes
   Semaphore _rotation_semaphore;
 
@@ -85,6 +90,7 @@ class LogFileOutput : public LogFileStreamOutput {
   virtual bool initialize(const char* options, outputStream* errstream);
   virtual int write(const LogDecorations& decorations, const char* msg);
   virtual int write(LogMessageBuffer::Iterator msg_iterator);
+  int write_blocking(const LogDecorations& decorations, const char* msg);
   virtual void force_rotate();
   virtual void describe(outputStream* out);
 
@@ -36,6 +36,19 @@
 #include "utilities/ostream.hpp"
 
 // allocate using malloc; will fail if no memory available
+//
+// Deliberately a thin wrapper over os::malloc rather than a VM-private
+// segregated-fit allocator.  The high-churn VM allocations already bypass
+// malloc: compiler nodes and resource allocations come from Arena chunks,
+// which ChunkPool (arena.cpp) recycles per size class with a lock-free
+// pop, and JFR manages its buffers in JfrMemorySpace.  What remains on
+// this path is low-frequency enough that a private heap would buy little,
+// while costing us malloc debugging tooling (ASan, valgrind, libc
+// MALLOC_CHECK_) and a second fragmentation story to maintain.  Arena
+// contention in libc is better addressed by tuning (e.g. glibc
+// MALLOC_ARENA_MAX, or a preloaded allocator) than by forking malloc into
+// the VM; the NMT malloc header is the price of tracking and is only paid
+// when NMT is enabled.
 char* AllocateHeap(size_t size,
                    MEMFLAGS flags,
                    const NativeCallStack& stack,
@@ -28,10 +28,12 @@
 #include "memory/metaspaceShared.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/orderAccess.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/memTracker.hpp"
+#include "utilities/lockFreeStack.hpp"
 #include "utilities/ostream.hpp"
 
 //--------------------------------------------------------------------------------------
@@ -40,41 +42,56 @@
 // MT-safe pool of chunks to reduce malloc/free thrashing
 // NB: not using Mutex because pools are used before Threads are initialized
 class ChunkPool: public CHeapObj<mtInternal> {
-  Chunk*       _first;        // first cached Chunk; its first word points to next chunk
-  size_t       _num_chunks;   // number of unused chunks in pool
-  size_t       _num_used;     // number of chunks currently checked out
-  const size_t _size;         // size of each chunk (must be uniform)
-
-  // Our four static pools
+  // Cached chunks, linked through Chunk::_next. Pushes are always lock-free.
+  // A pop racing with another pop is subject to ABA, so only one thread at a
+  // time may pop (_pop_claim); a thread that fails to get the claim simply
+  // allocates a fresh chunk from the C heap instead of waiting.
+  LockFreeStack<Chunk, &Chunk::next_ptr> _stack;
+  volatile int    _pop_claim;   // non-zero while a thread is popping
+  volatile size_t _num_chunks;  // number of unused chunks in pool (approximate)
+  const size_t    _size;        // size of each chunk (must be uniform)
+
+  // Our five static pools
+  static ChunkPool* _huge_pool;
   static ChunkPool* _large_pool;
   static ChunkPool* _medium_pool;
   static ChunkPool* _small_pool;
   static ChunkPool* _tiny_pool;
 
-  // return first element or null
-  void* get_first() {
-    Chunk* c = _first;
-    if (_first) {
-      _first = _first->next();
-      _num_chunks--;
+  bool try_claim_pops() {
+    return _pop_claim == 0 && Atomic::cmpxchg(1, &_pop_claim, 0) == 0;
+  }
+  void claim_pops() {
+    while (!try_claim_pops()) {
+      os::naked_yield();
     }
+  }
+  void release_pops() {
+    OrderAccess::release_store(&_pop_claim, 0);
+  }
+
+  // return first element, or null if the pool is empty or the pop claim
+  // is held by another thread
+  Chunk* get_first() {
+    if (!try_claim_pops()) {
+      return NULL;
+    }
+    Chunk* c = _stack.pop();
+    if (c != NULL) {
+      Atomic::dec(&_num_chunks);
+    }
+    release_pops();
     return c;
   }
 
  public:
   // All chunks in a ChunkPool has the same size
-   ChunkPool(size_t size) : _size(size) { _first = NULL; _num_chunks = _num_used = 0; }
+   ChunkPool(size_t size) : _size(size) { _pop_claim = 0; _num_chunks = 0; }
 
   // Allocate a new chunk from the pool (might expand the pool)
   NOINLINE void* allocate(size_t bytes, AllocFailType alloc_failmode) {
     assert(bytes == _size, "bad size");
-    void* p = NULL;
-    // No VM lock can be taken inside ThreadCritical lock, so os::malloc
-    // should be done outside ThreadCritical lock due to NMT
-    { ThreadCritical tc;
-      _num_used++;
-      p = get_first();
-    }
+    void* p = get_first();
     if (p == NULL) p = os::malloc(bytes, mtChunk, CURRENT_PC);
     if (p == NULL && alloc_failmode == AllocFailStrategy::EXIT_OOM) {
       vm_exit_out_of_memory(bytes, OOM_MALLOC_ERROR, "ChunkPool::allocate");
@@ -85,52 +102,59 @@ class ChunkPool: public CHeapObj<mtInternal> {
   // Return a chunk to the pool
   void free(Chunk* chunk) {
     assert(chunk->length() + Chunk::aligned_overhead_size() == _size, "bad size");
-    ThreadCritical tc;
-    _num_used--;
-
-    // Add chunk to list
-    chunk->set_next(_first);
-    _first = chunk;
-    _num_chunks++;
+    chunk->set_next(NULL);
+    _stack.push(*chunk);
+    Atomic::inc(&_num_chunks);
   }
 
   // Prune the pool
   void free_all_but(size_t n) {
-    Chunk* cur = NULL;
-    Chunk* next;
-    {
-      // if we have more than n chunks, free all of them
+    // if we have more than n chunks, free all of them
+    if (_num_chunks <= n) {
+      return;
+    }
+    // Take the pop claim so that no concurrent pop can hold a stale view of
+    // the list while we detach it; pushes may proceed and are unaffected.
+    claim_pops();
+    Chunk* keep = _stack.pop_all();
+
+    // Keep the n chunks at the head of the list, for better locality
+    size_t kept = 0;
+    Chunk* tail = NULL;
+    Chunk* excess = keep;
+    while (excess != NULL && kept < n) {
+      tail = excess;
+      excess = excess->next();
+      kept++;
+    }
+    if (tail != NULL) {
+      tail->set_next(NULL);
+      _stack.prepend(*keep, *tail);
+    }
+    release_pops();
+
+    // Free the excess chunks while in ThreadCritical lock
+    // so NMT adjustment is stable.
+    if (excess != NULL) {
       ThreadCritical tc;
-      if (_num_chunks > n) {
-        // free chunks at end of queue, for better locality
-        cur = _first;
-        for (size_t i = 0; i < (n - 1) && cur != NULL; i++) cur = cur->next();
-
-        if (cur != NULL) {
-          next = cur->next();
-          cur->set_next(NULL);
-          cur = next;
-
-          // Free all remaining chunks while in ThreadCritical lock
-          // so NMT adjustment is stable.
-          while(cur != NULL) {
-            next = cur->next();
-            os::free(cur);
-            _num_chunks--;
-            cur = next;
-          }
-        }
+      while (excess != NULL) {
+        Chunk* next = excess->next();
+        os::free(excess);
+        Atomic::dec(&_num_chunks);
+        excess = next;
       }
     }
   }
 
   // Accessors to preallocated pool's
+  static ChunkPool* huge_pool()   { assert(_huge_pool   != NULL, "must be initialized"); return _huge_pool;   }
   static ChunkPool* large_pool()  { assert(_large_pool  != NULL, "must be initialized"); return _large_pool;  }
   static ChunkPool* medium_pool() { assert(_medium_pool != NULL, "must be initialized"); return _medium_pool; }
   static ChunkPool* small_pool()  { assert(_small_pool  != NULL, "must be initialized"); return _small_pool;  }
   static ChunkPool* tiny_pool()   { assert(_tiny_pool   != NULL, "must be initialized"); return _tiny_pool;   }
 
   static void initialize() {
+    _huge_pool   = new ChunkPool(Chunk::huge_size   + Chunk::aligned_overhead_size());
     _large_pool  = new ChunkPool(Chunk::size        + Chunk::aligned_overhead_size());
     _medium_pool = new ChunkPool(Chunk::medium_size + Chunk::aligned_overhead_size());
     _small_pool  = new ChunkPool(Chunk::init_size   + Chunk::aligned_overhead_size());
@@ -138,14 +162,16 @@ class ChunkPool: public CHeapObj<mtInternal> {
   }
 
   static void clean() {
-    enum { BlocksToKeep = 5 };
+    enum { BlocksToKeep = 5, HugeBlocksToKeep = 2 };
      _tiny_pool->free_all_but(BlocksToKeep);
      _small_pool->free_all_but(BlocksToKeep);
      _medium_pool->free_all_but(BlocksToKeep);
      _large_pool->free_all_but(BlocksToKeep);
+     _huge_pool->free_all_but(HugeBlocksToKeep);
   }
 };
 
+ChunkPool* ChunkPool::_huge_pool   = NULL;
 ChunkPool* ChunkPool::_large_pool  = NULL;
 ChunkPool* ChunkPool::_medium_pool = NULL;
 ChunkPool* ChunkPool::_small_pool  = NULL;
@@ -186,6 +212,7 @@ void* Chunk::operator new (size_t requested_size, AllocFailType alloc_failmode,
   assert(ARENA_ALIGN(requested_size) == aligned_overhead_size(), "Bad alignment");
   size_t bytes = ARENA_ALIGN(requested_size) + length;
   switch (length) {
+   case Chunk::huge_size:   return ChunkPool::huge_pool()->allocate(bytes, alloc_failmode);
    case Chunk::size:        return ChunkPool::large_pool()->allocate(bytes, alloc_failmode);
    case Chunk::medium_size: return ChunkPool::medium_pool()->allocate(bytes, alloc_failmode);
    case Chunk::init_size:   return ChunkPool::small_pool()->allocate(bytes, alloc_failmode);
@@ -203,6 +230,7 @@ void* Chunk::operator new (size_t requested_size, AllocFailType alloc_failmode,
 void Chunk::operator delete(void* p) {
   Chunk* c = (Chunk*)p;
   switch (c->length()) {
+   case Chunk::huge_size:   ChunkPool::huge_pool()->free(c); break;
    case Chunk::size:        ChunkPool::large_pool()->free(c); break;
    case Chunk::medium_size: ChunkPool::medium_pool()->free(c); break;
    case Chunk::init_size:   ChunkPool::small_pool()->free(c); break;
@@ -351,18 +379,36 @@ void* Arena::grow(size_t x, AllocFailType alloc_failmode) {
   // Get minimal required size.  Either real big, or even bigger for giant objs
   size_t len = MAX2(x, (size_t) Chunk::size);
 
+  // Round moderately oversized requests up to the huge pool size, so that the
+  // chunks can be reused instead of always coming from and going back to
+  // os::malloc.
+  if (len > (size_t) Chunk::size && len <= (size_t) Chunk::huge_size) {
+    len = Chunk::huge_size;
+  }
+
   Chunk *k = _chunk;            // Get filled-up chunk address
-  _chunk = new (alloc_failmode, len) Chunk(len);
+  if (k != NULL && k->next() != NULL && k->next()->length() >= x) {
+    // Reuse a chunk retained by a prior rollback (see
+    // ResourceArea::trim_to_mark); it is already accounted for in
+    // size_in_bytes().
+    _chunk = k->next();
+  } else {
+    _chunk = new (alloc_failmode, len) Chunk(len);
 
-  if (_chunk == NULL) {
-    _chunk = k;                 // restore the previous value of _chunk
-    return NULL;
+    if (_chunk == NULL) {
+      _chunk = k;               // restore the previous value of _chunk
+      return NULL;
+    }
+    if (k) {
+      _chunk->set_next(k->next()); // Splice in, keeping any retained chunks
+      k->set_next(_chunk);
+    } else {
+      _first = _chunk;
+    }
+    set_size_in_bytes(size_in_bytes() + len);
   }
-  if (k) k->set_next(_chunk);   // Append new chunk to end of linked list
-  else _first = _chunk;
   _hwm  = _chunk->bottom();     // Save the cached hwm, max
   _max =  _chunk->top();
-  set_size_in_bytes(size_in_bytes() + len);
   void* result = _hwm;
   _hwm += x;
   return result;
@@ -437,8 +483,8 @@ bool Arena::contains( const void *ptr ) const {
 #endif
   if( (void*)_chunk->bottom() <= ptr && ptr < (void*)_hwm )
     return true;                // Check for in this chunk
-  for (Chunk *c = _first; c; c = c->next()) {
-    if (c == _chunk) continue;  // current chunk has been processed
+  // Chunks following _chunk are retained for reuse and hold no live data.
+  for (Chunk *c = _first; c != NULL && c != _chunk; c = c->next()) {
     if ((void*)c->bottom() <= ptr && ptr < (void*)c->top()) {
       return true;              // Check for every chunk in Arena
     }
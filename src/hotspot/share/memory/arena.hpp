@@ -47,6 +47,10 @@ class Chunk: CHeapObj<mtChunk> {
  private:
   Chunk*       _next;     // Next Chunk in list
   const size_t _len;      // Size of this Chunk
+
+  // Entry accessor for the chunk pools' LockFreeStack (see arena.cpp)
+  static Chunk* volatile* next_ptr(Chunk& chunk) { return (Chunk* volatile*)&chunk._next; }
+  friend class ChunkPool;
  public:
   void* operator new(size_t size, AllocFailType alloc_failmode, size_t length) throw();
   void  operator delete(void* p);
@@ -66,6 +70,7 @@ class Chunk: CHeapObj<mtChunk> {
     init_size  =  1*K  - slack, // Size of first chunk (normal aka small)
     medium_size= 10*K  - slack, // Size of medium-sized chunk
     size       = 32*K  - slack, // Default size of an Arena chunk (following the first)
+    huge_size  = 128*K - slack, // Size of an oversized chunk (see Arena::grow)
     non_pool_size = init_size + 32 // An initial size which is not one of above
   };
 
@@ -435,6 +435,18 @@ size_t CodeHeap::heap_unallocated_capacity() const {
   return segments_to_size(_number_of_reserved_segments - _next_segment);
 }
 
+// Returns the size of the largest contiguous free block. The never
+// allocated space at the end of the heap counts as one free block.
+size_t CodeHeap::largest_free_block() const {
+  size_t segments = 0;
+  for (FreeBlock* b = _freelist; b != NULL; b = b->link()) {
+    if (b->length() > segments) {
+      segments = b->length();
+    }
+  }
+  return MAX2(segments_to_size(segments), heap_unallocated_capacity());
+}
+
 // Free list management
 
 FreeBlock* CodeHeap::following_block(FreeBlock *b) {
@@ -201,6 +201,8 @@ class CodeHeap : public CHeapObj<mtCode> {
   size_t allocated_capacity() const;
   size_t max_allocated_capacity() const          { return _max_allocated_capacity; }
   size_t unallocated_capacity() const            { return max_capacity() - allocated_capacity(); }
+  size_t heap_unallocated_capacity() const;
+  size_t largest_free_block() const;             // for CodeCache fragmentation checks; caller must hold CodeCache_lock
 
   // Returns true if the CodeHeap contains CodeBlobs of the given type
   bool accepts(int code_blob_type) const         { return (_code_blob_type == CodeBlobType::All) ||
@@ -217,10 +219,6 @@ class CodeHeap : public CHeapObj<mtCode> {
   int         full_count()                       { return _full_count; }
   void        report_full()                      {        _full_count++; }
 
-private:
-  size_t heap_unallocated_capacity() const;
-
-public:
   // Debugging
   void verify() PRODUCT_RETURN;
   void print()  PRODUCT_RETURN;
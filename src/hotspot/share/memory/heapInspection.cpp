@@ -33,6 +33,8 @@
 #include "memory/universe.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/reflectionAccessorImplKlassHelper.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
@@ -242,6 +244,43 @@ size_t KlassInfoTable::size_of_instances_in_words() const {
   return _size_of_instances_in_words;
 }
 
+// Return false if the entry could not be merged on account
+// of running out of space required to create a new entry.
+bool KlassInfoTable::merge_entry(const KlassInfoEntry* cie) {
+  Klass* k = cie->klass();
+  KlassInfoEntry* elt = lookup(k);
+  // elt may be NULL if it's a new klass for which we
+  // could not allocate space for a new entry in the hashtable.
+  if (elt != NULL) {
+    elt->set_count(elt->count() + cie->count());
+    elt->set_words(elt->words() + cie->words());
+    _size_of_instances_in_words += cie->words();
+    return true;
+  }
+  return false;
+}
+
+class KlassInfoTableMergeClosure : public KlassInfoClosure {
+ private:
+  KlassInfoTable* _dest;
+  bool _success;
+ public:
+  KlassInfoTableMergeClosure(KlassInfoTable* table) : _dest(table), _success(true) {}
+
+  void do_cinfo(KlassInfoEntry* cie) {
+    _success &= _dest->merge_entry(cie);
+  }
+  bool success() { return _success; }
+};
+
+// Merge the given table into this one; the given table is left unchanged.
+bool KlassInfoTable::merge(KlassInfoTable* table) {
+  assert(!allocation_failed(), "caller responsibility");
+  KlassInfoTableMergeClosure closure(this);
+  table->iterate(&closure);
+  return closure.success();
+}
+
 int KlassInfoHisto::sort_helper(KlassInfoEntry** e1, KlassInfoEntry** e2) {
   return (*e1)->compare(*e1,*e2);
 }
@@ -715,9 +754,50 @@ class RecordInstanceClosure : public ObjectClosure {
   }
 };
 
+void ParHeapInspectTask::work(uint worker_id) {
+  ResourceMark rm;
+  KlassInfoTable cit(false);
+  if (cit.allocation_failed()) {
+    // Could not allocate this worker's table; have the caller fall back
+    // to serial inspection.
+    _success = false;
+    return;
+  }
+  RecordInstanceClosure ric(&cit, _filter);
+  _poi->object_iterate(&ric, worker_id);
+
+  {
+    MutexLocker ml(&_mutex, Mutex::_no_safepoint_check_flag);
+    if (!_shared_cit->merge(&cit)) {
+      _success = false;
+      return;
+    }
+  }
+  Atomic::add(ric.missed_count(), &_missed_count);
+}
+
 size_t HeapInspection::populate_table(KlassInfoTable* cit, BoolObjectClosure *filter) {
   ResourceMark rm;
 
+  // Try to inspect the heap in parallel, using the safepoint workers and a
+  // private KlassInfoTable per worker, merged into cit at the end.
+  WorkGang* gang = Universe::heap()->get_safepoint_workers();
+  if (gang != NULL && gang->active_workers() > 1) {
+    ParallelObjectIterator* poi = Universe::heap()->parallel_object_iterator(gang->active_workers());
+    if (poi != NULL) {
+      ParHeapInspectTask task(poi, cit, filter);
+      gang->run_task(&task);
+      delete poi;
+      if (task.success()) {
+        return task.missed_count();
+      }
+      // A worker ran out of memory; fall back to serial inspection. Entries
+      // that were already merged are recounted, so after a native OOM the
+      // histogram may overcount some classes, like missed_count the result
+      // is best-effort in that case.
+    }
+  }
+
   RecordInstanceClosure ric(cit, filter);
   Universe::heap()->object_iterate(&ric);
   return ric.missed_count();
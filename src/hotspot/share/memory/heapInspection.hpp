@@ -25,10 +25,12 @@
 #ifndef SHARE_MEMORY_HEAPINSPECTION_HPP
 #define SHARE_MEMORY_HEAPINSPECTION_HPP
 
+#include "gc/shared/workgroup.hpp"
 #include "memory/allocation.hpp"
 #include "oops/objArrayOop.hpp"
 #include "oops/oop.hpp"
 #include "oops/annotations.hpp"
+#include "runtime/mutex.hpp"
 #include "utilities/macros.hpp"
 
 #if INCLUDE_SERVICES
@@ -248,6 +250,8 @@ class KlassInfoTable: public StackObj {
 
   class AllClassesFinder;
 
+  bool merge_entry(const KlassInfoEntry* cie);
+
  public:
   KlassInfoTable(bool add_all_classes);
   ~KlassInfoTable();
@@ -255,9 +259,11 @@ class KlassInfoTable: public StackObj {
   void iterate(KlassInfoClosure* cic);
   bool allocation_failed() { return _buckets == NULL; }
   size_t size_of_instances_in_words() const;
+  bool merge(KlassInfoTable* table);
 
   friend class KlassInfoHisto;
   friend class KlassHierarchy;
+  friend class KlassInfoTableMergeClosure;
 };
 
 class KlassHierarchy : AllStatic {
@@ -341,6 +347,40 @@ class KlassInfoHisto : public StackObj {
   void sort();
 };
 
+class ParallelObjectIterator;
+
+// Parallel heap inspection task. Each worker populates a private
+// KlassInfoTable from a disjoint part of the heap and merges it into the
+// shared table under a lock. Parallel inspection can fail when memory for
+// a worker's table cannot be allocated; the caller then falls back to
+// serial inspection.
+class ParHeapInspectTask : public AbstractGangTask {
+ private:
+  ParallelObjectIterator* _poi;
+  KlassInfoTable*         _shared_cit;
+  BoolObjectClosure*      _filter;
+  volatile size_t         _missed_count;
+  volatile bool           _success;
+  Mutex                   _mutex;
+
+ public:
+  ParHeapInspectTask(ParallelObjectIterator* poi,
+                     KlassInfoTable* shared_cit,
+                     BoolObjectClosure* filter) :
+      AbstractGangTask("Iterating heap"),
+      _poi(poi),
+      _shared_cit(shared_cit),
+      _filter(filter),
+      _missed_count(0),
+      _success(true),
+      _mutex(Mutex::leaf, "ParHeapInspectTask_lock", true, Monitor::_safepoint_check_never) {}
+
+  size_t missed_count() const { return _missed_count; }
+  bool success() const        { return _success; }
+
+  virtual void work(uint worker_id);
+};
+
 #endif // INCLUDE_SERVICES
 
 // These declarations are needed since the declaration of KlassInfoTable and
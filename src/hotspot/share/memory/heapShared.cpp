@@ -41,6 +41,7 @@
 #include "oops/fieldStreams.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/fieldDescriptor.inline.hpp"
+#include "runtime/os.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "utilities/bitMap.inline.hpp"
 #if INCLUDE_G1GC
@@ -86,6 +87,13 @@ const static int num_closed_archive_subgraph_entry_fields =
 const static int num_open_archive_subgraph_entry_fields =
   sizeof(open_archive_subgraph_entry_fields) / sizeof(ArchivableStaticFieldInfo);
 
+// Additional entry fields for the open archive heap region, nominated by the
+// user via -XX:ExtraArchiveSubgraphEntryFields. Parsed and resolved by
+// HeapShared::init_extra_subgraph_entry_fields(). The same restrictions as for
+// the built-in tables apply; in particular all classes in the nominated
+// sub-graphs must be boot classes.
+static GrowableArray<ArchivableStaticFieldInfo>* extra_open_archive_subgraph_entry_fields = NULL;
+
 ////////////////////////////////////////////////////////////////
 //
 // Java heap object archiving support
@@ -248,6 +256,13 @@ void HeapShared::copy_open_archive_heap_objects(
                            false /* is_closed_archive */,
                            THREAD);
 
+  if (extra_open_archive_subgraph_entry_fields != NULL) {
+    archive_object_subgraphs(extra_open_archive_subgraph_entry_fields->adr_at(0),
+                             extra_open_archive_subgraph_entry_fields->length(),
+                             false /* is_closed_archive */,
+                             THREAD);
+  }
+
   G1CollectedHeap::heap()->end_archive_alloc_range(open_archive,
                                                    os::vm_allocation_granularity());
 }
@@ -863,9 +878,10 @@ class ArchivableStaticFieldFinder: public FieldClosure {
   Symbol* _field_name;
   bool _found;
   int _offset;
+  BasicType _type;
 public:
   ArchivableStaticFieldFinder(InstanceKlass* ik, Symbol* field_name) :
-    _ik(ik), _field_name(field_name), _found(false), _offset(-1) {}
+    _ik(ik), _field_name(field_name), _found(false), _offset(-1), _type(T_ILLEGAL) {}
 
   virtual void do_field(fieldDescriptor* fd) {
     if (fd->name() == _field_name) {
@@ -873,10 +889,12 @@ public:
       assert(fd->field_type() == T_OBJECT || fd->field_type() == T_ARRAY, "can archive only obj or array fields");
       _found = true;
       _offset = fd->offset();
+      _type = fd->field_type();
     }
   }
   bool found()     { return _found;  }
   int offset()     { return _offset; }
+  BasicType type() { return _type;   }
 };
 
 void HeapShared::init_subgraph_entry_fields(ArchivableStaticFieldInfo fields[],
@@ -903,6 +921,75 @@ void HeapShared::init_subgraph_entry_fields(ArchivableStaticFieldInfo fields[],
   }
 }
 
+// Parse -XX:ExtraArchiveSubgraphEntryFields, a comma-separated list of
+// <class>.<field> entries (class names in slash form), and resolve each entry
+// the same way as the built-in tables. Unlike the built-in tables, the list is
+// user input, so malformed or unsupported entries terminate the dump with an
+// error message instead of asserting.
+void HeapShared::init_extra_subgraph_entry_fields(Thread* THREAD) {
+  if (ExtraArchiveSubgraphEntryFields == NULL) {
+    return;
+  }
+
+  extra_open_archive_subgraph_entry_fields =
+    new (ResourceObj::C_HEAP, mtClass) GrowableArray<ArchivableStaticFieldInfo>(4, true, mtClass);
+
+  // The klass_name/field_name strings must outlive this function; carve them
+  // out of a C-heap copy of the flag value.
+  char* list = os::strdup_check_oom(ExtraArchiveSubgraphEntryFields, mtClass);
+  for (char* entry = list; entry != NULL; ) {
+    char* next = strchr(entry, ',');
+    if (next != NULL) {
+      *next++ = '\0';
+    }
+    char* dot = strrchr(entry, '.');
+    if (dot == NULL || dot == entry || dot[1] == '\0') {
+      log_error(cds, heap)("Malformed entry \"%s\" in ExtraArchiveSubgraphEntryFields; expected <class>.<field>", entry);
+      vm_exit(1);
+    }
+    *dot = '\0';
+    const char* klass_name = entry;
+    const char* field_name = dot + 1;
+
+    TempNewSymbol klass_name_sym = SymbolTable::new_symbol(klass_name);
+    Klass* k = SystemDictionary::resolve_or_null(klass_name_sym, THREAD);
+    if (k == NULL || HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      log_error(cds, heap)("Class %s in ExtraArchiveSubgraphEntryFields was not found", klass_name);
+      vm_exit(1);
+    }
+    if (!k->is_instance_klass() || !InstanceKlass::cast(k)->is_shared_boot_class()) {
+      log_error(cds, heap)("Class %s in ExtraArchiveSubgraphEntryFields is not an archived boot class", klass_name);
+      vm_exit(1);
+    }
+    InstanceKlass* ik = InstanceKlass::cast(k);
+    ik->initialize(THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      log_error(cds, heap)("Class %s in ExtraArchiveSubgraphEntryFields failed to initialize", klass_name);
+      vm_exit(1);
+    }
+
+    TempNewSymbol field_name_sym = SymbolTable::new_symbol(field_name);
+    ArchivableStaticFieldFinder finder(ik, field_name_sym);
+    ik->do_local_static_fields(&finder);
+    if (!finder.found() || !is_reference_type(finder.type())) {
+      log_error(cds, heap)("Class %s has no static object field named %s", klass_name, field_name);
+      vm_exit(1);
+    }
+
+    ArchivableStaticFieldInfo info;
+    info.klass_name = klass_name;
+    info.field_name = field_name;
+    info.klass = ik;
+    info.offset = finder.offset();
+    info.type = finder.type();
+    extra_open_archive_subgraph_entry_fields->append(info);
+
+    entry = next;
+  }
+}
+
 void HeapShared::init_subgraph_entry_fields(Thread* THREAD) {
   _dump_time_subgraph_info_table = new (ResourceObj::C_HEAP, mtClass)DumpTimeKlassSubGraphInfoTable();
 
@@ -912,6 +999,7 @@ void HeapShared::init_subgraph_entry_fields(Thread* THREAD) {
   init_subgraph_entry_fields(open_archive_subgraph_entry_fields,
                              num_open_archive_subgraph_entry_fields,
                              THREAD);
+  init_extra_subgraph_entry_fields(THREAD);
 }
 
 void HeapShared::archive_object_subgraphs(ArchivableStaticFieldInfo fields[],
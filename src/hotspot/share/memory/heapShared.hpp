@@ -194,6 +194,7 @@ private:
 
   static void init_subgraph_entry_fields(ArchivableStaticFieldInfo fields[],
                                          int num, Thread* THREAD);
+  static void init_extra_subgraph_entry_fields(Thread* THREAD);
 
   // Used by decode_from_archive
   static address _narrow_oop_base;
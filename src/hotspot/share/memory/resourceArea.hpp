@@ -63,6 +63,47 @@ public:
   // (by default, ResourceArea is tagged as mtThread, per-thread general purpose storage)
   void bias_to(MEMFLAGS flags);
 
+  // Free the chunks grown past "chunk" since the mark was set, retaining up
+  // to ResourceAreaRetainedSize bytes of them for reuse by later growth (see
+  // Arena::grow). This avoids thrashing the chunk pools when nested marks
+  // repeatedly grow and roll back the area. "saved_size" is the arena size
+  // recorded when the mark was set.
+  void trim_to_mark(Chunk* chunk, size_t saved_size) {
+    if (chunk->next() == NULL) {
+      // Nested rollbacks may have freed chunks that were already retained
+      // when this mark was set, so the size may be below the saved size.
+      assert(size_in_bytes() <= saved_size, "Sanity check");
+      return;
+    }
+    size_t retained = 0;
+    Chunk* keep = chunk;
+    Chunk* cur = chunk->next();
+    while (cur != NULL && retained + cur->length() <= ResourceAreaRetainedSize) {
+      retained += cur->length();
+      // clear out the retained chunk (to detect allocation bugs)
+      if (ZapResourceArea) memset(cur->bottom(), badResourceValue, cur->length());
+      keep = cur;
+      cur = cur->next();
+    }
+    if (cur != NULL) {
+      // Subtract exactly the bytes being freed: chunks retained by an
+      // earlier rollback are already part of "saved_size" (Arena::grow
+      // reuses them without growing the arena size), so recomputing the
+      // size as saved_size plus the kept chunks would count them twice.
+      size_t freed = 0;
+      for (Chunk* c = cur; c != NULL; c = c->next()) {
+        freed += c->length();
+      }
+      // reset arena size before delete chunks. Otherwise, the total
+      // arena size could exceed total chunk size
+      assert(size_in_bytes() > freed, "Sanity check");
+      set_size_in_bytes(size_in_bytes() - freed);
+      keep->next_chop();
+    }
+    // Otherwise every chunk past the mark was kept and the arena size is
+    // unchanged.
+  }
+
   debug_only(int nesting() const { return _nesting; })
 };
 
@@ -127,17 +168,15 @@ protected:
   }
 
   void reset_to_mark() {
+    // Fast path for nested marks with no allocation since the mark was set;
+    // there is no bookkeeping to undo.
+    if (_area->_hwm == _hwm && _area->_chunk == _chunk) {
+      return;
+    }
+
     if (UseMallocOnly) free_malloced_objects();
 
-    if( _chunk->next() ) {       // Delete later chunks
-      // reset arena size before delete chunks. Otherwise, the total
-      // arena size could exceed total chunk size
-      assert(_area->size_in_bytes() > size_in_bytes(), "Sanity check");
-      _area->set_size_in_bytes(size_in_bytes());
-      _chunk->next_chop();
-    } else {
-      assert(_area->size_in_bytes() == size_in_bytes(), "Sanity check");
-    }
+    _area->trim_to_mark(_chunk, size_in_bytes());
     _area->_chunk = _chunk;     // Roll back arena to saved chunk
     _area->_hwm = _hwm;
     _area->_max = _max;
@@ -230,17 +269,15 @@ protected:
   }
 
   void reset_to_mark() {
+    // Fast path for marks with no allocation since the mark was set; there
+    // is no bookkeeping to undo.
+    if (_area->_hwm == _hwm && _area->_chunk == _chunk) {
+      return;
+    }
+
     if (UseMallocOnly) free_malloced_objects();
 
-    if( _chunk->next() ) {        // Delete later chunks
-      // reset arena size before delete chunks. Otherwise, the total
-      // arena size could exceed total chunk size
-      assert(_area->size_in_bytes() > size_in_bytes(), "Sanity check");
-      _area->set_size_in_bytes(size_in_bytes());
-      _chunk->next_chop();
-    } else {
-      assert(_area->size_in_bytes() == size_in_bytes(), "Sanity check");
-    }
+    _area->trim_to_mark(_chunk, size_in_bytes());
     _area->_chunk = _chunk;     // Roll back arena to saved chunk
     _area->_hwm = _hwm;
     _area->_max = _max;
@@ -26,7 +26,7 @@
 #include "aot/aotLoader.hpp"
 #include "classfile/classLoader.hpp"
 #include "classfile/classLoaderDataGraph.hpp"
-#include "classfile/javaClasses.hpp"
+#include "classfile/javaClasses.inline.hpp"
 #include "classfile/stringTable.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
@@ -69,6 +69,7 @@
 #include "runtime/init.hpp"
 #include "runtime/java.hpp"
 #include "runtime/javaCalls.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/synchronizer.hpp"
 #include "runtime/thread.inline.hpp"
@@ -525,6 +526,21 @@ oop Universe::swap_reference_pending_list(oop list) {
   return Atomic::xchg(list, &_reference_pending_list);
 }
 
+// Count the references on the pending list by walking the 'discovered'
+// chain. Called by the GC at a safepoint, after reference enqueueing;
+// the walk is bounded by limit to protect the pause time against a
+// pathological backlog.
+size_t Universe::reference_pending_list_depth(size_t limit) {
+  assert(SafepointSynchronize::is_at_safepoint(), "invariant");
+  size_t depth = 0;
+  oop ref = _reference_pending_list;
+  while (ref != NULL && depth < limit) {
+    ++depth;
+    ref = java_lang_ref_Reference::discovered(ref);
+  }
+  return depth;
+}
+
 #undef assert_pll_locked
 #undef assert_pll_ownership
 
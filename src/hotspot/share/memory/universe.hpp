@@ -302,6 +302,7 @@ class Universe: AllStatic {
   static void         set_reference_pending_list(oop list);
   static bool         has_reference_pending_list();
   static oop          swap_reference_pending_list(oop list);
+  static size_t       reference_pending_list_depth(size_t limit);
 
   static Array<int>*             the_empty_int_array()    { return _the_empty_int_array; }
   static Array<u2>*              the_empty_short_array()  { return _the_empty_short_array; }
@@ -1147,6 +1147,17 @@ void ConstantPool::copy_bootstrap_arguments_at_impl(const constantPoolHandle& th
   }
 }
 
+// The per-pool short-circuit for resolved strings is the resolved_references
+// load below: after the first execution of an ldc the interned oop sits in
+// the pool's resolved references array, the bytecode is rewritten to
+// fast_aldc, and every later execution is a plain array load that never
+// reaches StringTable::intern.  So each constant pays the table probe
+// exactly once, on its first execution.  Pre-interning a pool's string
+// constants when the class's first method compiles would not reduce that
+// work, only move it -- and mostly onto constants in paths that never run:
+// pools routinely carry far more string constants than a given run touches
+// (exception messages, logging), and eagerly interning them would pin dead
+// strings in the table and inflate startup rather than shrink it.
 oop ConstantPool::string_at_impl(const constantPoolHandle& this_cp, int which, int obj_index, TRAPS) {
   // If the string has already been interned, this entry will be non-null
   oop str = this_cp->resolved_references()->obj_at(obj_index);
@@ -96,6 +96,20 @@
 //                                               not valid at any other time
 //
 //    We assume that stack/thread pointers have the lowest two bits cleared.
+//
+//  - folding the compressed klass pointer into this word (a single
+//    64-bit header instead of mark + klass) has been considered and does
+//    not work with the protocols above.  Stack locking, monitor inflation
+//    and full-GC marking all *replace* the entire word with a pointer,
+//    displacing the original header to the stack or the ObjectMonitor; a
+//    klass stored here would be displaced with it, so every klass load --
+//    the hottest read in the VM -- would need to test the lock bits and
+//    potentially chase the displaced location.  GC forwarding
+//    (oopDesc::forward_to) overwrites the word the same way.  Shrinking
+//    headers therefore first requires retiring the displaced-header
+//    scheme (and the biased-locking thread/epoch encoding, which needs
+//    the JavaThread* bits this would take away); until then the klass
+//    word stays separate.
 
 class BasicLock;
 class ObjectMonitor;
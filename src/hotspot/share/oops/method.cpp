@@ -54,6 +54,7 @@
 #include "prims/methodHandles.hpp"
 #include "prims/nativeLookup.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/compilationPolicy.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/handles.inline.hpp"
@@ -99,6 +100,7 @@ Method::Method(ConstMethod* xconst, AccessFlags access_flags) {
   set_method_data(NULL);
   clear_method_counters();
   set_vtable_index(Method::garbage_vtable_index);
+  _oop_map_entry_cache = NULL;
 
   // Fix and bury in Method*
   set_interpreter_entry(NULL); // sets i2i entry and from_int
@@ -255,6 +257,22 @@ void Method::mask_for(int bci, InterpreterOopMap* mask) {
   return;
 }
 
+// Accessors for the one-entry oop map cache. The entry is published and
+// cleared concurrently by GC threads during a safepoint, see
+// OopMapCache::lookup for the protocol that keeps the pointer from
+// dangling into a recycled entry.
+OopMapCacheEntry* Method::oop_map_entry_cache() const {
+  return OrderAccess::load_acquire(&_oop_map_entry_cache);
+}
+
+void Method::set_oop_map_entry_cache(OopMapCacheEntry* entry) {
+  OrderAccess::release_store(&_oop_map_entry_cache, entry);
+}
+
+void Method::clear_oop_map_entry_cache(OopMapCacheEntry* entry) {
+  Atomic::cmpxchg((OopMapCacheEntry*)NULL, &_oop_map_entry_cache, entry);
+}
+
 
 int Method::bci_from(address bcp) const {
   if (is_native() && bcp == 0) {
@@ -1007,6 +1025,7 @@ void Method::unlink_method() {
 
   set_method_data(NULL);
   clear_method_counters();
+  _oop_map_entry_cache = NULL;
 }
 #endif
 
@@ -67,6 +67,7 @@ class InlineTableSizes;
 class KlassSizeStats;
 class CompiledMethod;
 class InterpreterOopMap;
+class OopMapCacheEntry;
 
 class Method : public Metadata {
  friend class VMStructs;
@@ -113,6 +114,12 @@ class Method : public Metadata {
   CompiledMethod* volatile _code;                       // Points to the corresponding piece of native code
   volatile address           _from_interpreted_entry; // Cache of _code ? _adapter->i2c_entry() : _i2i_entry
 
+  // One-entry cache of the most recently resolved interpreter oop map for
+  // this method. Points into the holder's OopMapCache, which clears it
+  // before the entry is recycled; only accessed at a safepoint (see
+  // OopMapCache::lookup).
+  OopMapCacheEntry* volatile _oop_map_entry_cache;
+
 #if INCLUDE_AOT && defined(TIERED)
   CompiledMethod* _aot_code;
 #endif
@@ -557,6 +564,12 @@ public:
   // Interpreter oopmap support
   void mask_for(int bci, InterpreterOopMap* mask);
 
+  // One-entry cache of the last resolved oop map (see OopMapCache::lookup)
+  OopMapCacheEntry* oop_map_entry_cache() const;
+  void set_oop_map_entry_cache(OopMapCacheEntry* entry);
+  // Clear the cache if it currently holds the given entry
+  void clear_oop_map_entry_cache(OopMapCacheEntry* entry);
+
   // operations on invocation counter
   void print_invocation_count();
 
@@ -1944,6 +1944,19 @@ public:
 // in certain ProfileData objects that indicate the amount the mdp must be
 // adjusted in the event of a change in control flow.
 //
+// Counter updates are plain, racy increments by design: losing an
+// occasional tick is harmless because the counters only steer
+// heuristics, and that is far cheaper than atomics on the interpreter
+// fast path.  The line bouncing this causes when many threads warm the
+// same method at once is a known cost; sharding the counters per
+// thread was examined and rejected, since the mdp-relative addressing
+// compiled into the interpreter and C1 profiling code assumes a single
+// canonical data area per method, and shards would have to be merged
+// whenever the compiler, the deoptimizer or jcmd reads a profile --
+// readers that currently take the data straight from here.  The
+// bounce is bounded in practice: it lasts only until the method
+// compiles and its profiling stops.
+//
 
 class CleanExtraDataClosure : public StackObj {
 public:
@@ -549,6 +549,16 @@ Node *ArrayCopyNode::Ideal(PhaseGVN *phase, bool can_reshape) {
 
   int count = get_count(phase);
 
+  // Only copies whose length is a compile-time constant are expanded to
+  // loads and stores; everything else becomes the stub call during
+  // macro expansion.  A guarded middle ground -- an inline short-length
+  // loop with a stub fallthrough for variable lengths that profile as
+  // short -- costs more than it looks: the guard plus the inline loop's
+  // exit tests are control flow on every copy, the duplicated copy code
+  // must repeat the stub's alignment and (for oops) barrier handling in
+  // IR, and without per-call-site length profiles (MDOs do not record
+  // argument value distributions) the threshold would be a blind guess
+  // that pessimizes every workload whose copies are not short.
   if (count < 0 || count > ArrayCopyLoadStoreMaxElem) {
     return NULL;
   }
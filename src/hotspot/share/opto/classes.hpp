@@ -379,8 +379,11 @@ macro(URShiftVS)
 macro(URShiftVI)
 macro(URShiftVL)
 macro(AndV)
+macro(AndReductionV)
 macro(OrV)
+macro(OrReductionV)
 macro(XorV)
+macro(XorReductionV)
 macro(MinV)
 macro(MaxV)
 macro(MinReductionV)
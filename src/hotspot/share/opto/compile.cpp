@@ -463,6 +463,7 @@ CompileWrapper::CompileWrapper(Compile* compile) : _compile(compile) {
   assert(compile == Compile::current(), "sanity");
 
   compile->set_type_dict(NULL);
+  compile->set_type_meet_cache(NULL);
   compile->set_clone_map(new Dict(cmpkey, hashkey, _compile->comp_arena()));
   compile->clone_map().set_clone_idx(0);
   compile->set_type_hwm(NULL);
@@ -1214,9 +1215,45 @@ void Compile::Init(int aliaslevel) {
   _expensive_nodes = new(comp_arena()) GrowableArray<Node*>(comp_arena(), 8,  0, NULL);
   _range_check_casts = new(comp_arena()) GrowableArray<Node*>(comp_arena(), 8,  0, NULL);
   _opaque4_nodes = new(comp_arena()) GrowableArray<Node*>(comp_arena(), 8,  0, NULL);
+  reset_node_storage_free_list();
   register_library_intrinsics();
 }
 
+//---------------------------reuse_node_storage--------------------------------
+// Reuse the storage of a same-sized dead node, if any has been reclaimed.
+void* Compile::reuse_node_storage(size_t size) {
+  size_t bucket = size >> LogBytesPerWord;
+  if (bucket >= _node_storage_buckets) {
+    return NULL;
+  }
+  void* mem = _node_storage_free_list[bucket];
+  if (mem != NULL) {
+    _node_storage_free_list[bucket] = *(void**)mem;
+  }
+  return mem;
+}
+
+//---------------------------recycle_node_storage------------------------------
+// Park the storage of a dead node which the arena could not take back
+// for reuse by a later node of the same size.
+void Compile::recycle_node_storage(void* mem, size_t size) {
+  size_t bucket = size >> LogBytesPerWord;
+  if (bucket < _node_storage_buckets) {
+    *(void**)mem = _node_storage_free_list[bucket];
+    _node_storage_free_list[bucket] = mem;
+  }
+}
+
+//---------------------------reset_node_storage_free_list----------------------
+// Drop all reclaimed storage. Called when the node arena contents move
+// to old space (see Matcher::xform): handing out storage from what is
+// now the old arena would confuse the matcher's new-space checks.
+void Compile::reset_node_storage_free_list() {
+  for (int i = 0; i < _node_storage_buckets; i++) {
+    _node_storage_free_list[i] = NULL;
+  }
+}
+
 //---------------------------init_start----------------------------------------
 // Install the StartNode on this compile object.
 void Compile::init_start(StartNode* s) {
@@ -3373,6 +3410,9 @@ void Compile::final_graph_reshaping_main_switch(Node* n, Final_Reshape_Counts& f
   case Op_MulReductionVD:
   case Op_MinReductionV:
   case Op_MaxReductionV:
+  case Op_AndReductionV:
+  case Op_OrReductionV:
+  case Op_XorReductionV:
     break;
 
   case Op_PackB:
@@ -85,6 +85,7 @@ class TypeInt;
 class TypePtr;
 class TypeOopPtr;
 class TypeFunc;
+class TypeMeetCache;
 class Unique_Node_List;
 class nmethod;
 class WarmCallInfo;
@@ -448,6 +449,14 @@ class Compile : public Phase {
   debug_only(static int _debug_idx;)            // Monotonic counter (not reset), use -XX:BreakAtNode=<idx>
   Arena                 _node_arena;            // Arena for new-space Nodes
   Arena                 _old_arena;             // Arena for old-space Nodes, lifetime during xform
+
+  // Reclaimed storage of dead nodes, bucketed by size in words. The node
+  // arena can only take back the most recently allocated block, so the
+  // storage of other dead nodes is parked here for reuse by later nodes
+  // of the same size. Product only; debug builds keep dead node storage
+  // around for verification.
+  enum { _node_storage_buckets = 64 };
+  void*                 _node_storage_free_list[_node_storage_buckets];
   RootNode*             _root;                  // Unique root of compilation, or NULL after bail-out.
   Node*                 _top;                   // Unique top node.  (Reset by various phases.)
 
@@ -477,6 +486,7 @@ class Compile : public Phase {
   Arena                 _Compile_types;         // Arena for all types
   Arena*                _type_arena;            // Alias for _Compile_types except in Initialize_shared()
   Dict*                 _type_dict;             // Intern table
+  TypeMeetCache*        _type_meet_cache;       // Memoized meet results (see Type::meet_helper)
   CloneMap              _clone_map;             // used for recording history of cloned nodes
   void*                 _type_hwm;              // Last allocation (see Type::operator new/delete)
   size_t                _type_last_size;        // Last allocation size (see Type::operator new/delete)
@@ -903,6 +913,9 @@ class Compile : public Phase {
   static void  set_debug_idx(int i)        { debug_only(_debug_idx = i); }
   Arena*       node_arena()                { return &_node_arena; }
   Arena*       old_arena()                 { return &_old_arena; }
+  void*        reuse_node_storage(size_t size);
+  void         recycle_node_storage(void* mem, size_t size);
+  void         reset_node_storage_free_list();
   RootNode*    root() const                { return _root; }
   void         set_root(RootNode* r)       { _root = r; }
   StartNode*   start() const;              // (Derived from root.)
@@ -977,6 +990,7 @@ class Compile : public Phase {
   // Type management
   Arena*            type_arena()                { return _type_arena; }
   Dict*             type_dict()                 { return _type_dict; }
+  TypeMeetCache*    type_meet_cache()           { return _type_meet_cache; }
   void*             type_hwm()                  { return _type_hwm; }
   size_t            type_last_size()            { return _type_last_size; }
   int               num_alias_types()           { return _num_alias_types; }
@@ -984,6 +998,7 @@ class Compile : public Phase {
   void          init_type_arena()                       { _type_arena = &_Compile_types; }
   void          set_type_arena(Arena* a)                { _type_arena = a; }
   void          set_type_dict(Dict* d)                  { _type_dict = d; }
+  void          set_type_meet_cache(TypeMeetCache* c)   { _type_meet_cache = c; }
   void          set_type_hwm(void* p)                   { _type_hwm = p; }
   void          set_type_last_size(size_t sz)           { _type_last_size = sz; }
 
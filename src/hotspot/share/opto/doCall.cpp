@@ -291,6 +291,69 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           }
         }
       }
+
+      // The call site is megamorphic (it saw more receiver types than the
+      // profile has rows), but the recorded receivers may still dominate.
+      // Emit a chain of type-guarded inlined calls for the dominant
+      // receivers which falls through to the virtual call, so the hot
+      // receivers avoid the dispatch without risking deoptimization on
+      // the cold ones. Requires a profile wider than the default
+      // (-XX:TypeProfileWidth) to kick in beyond the bimorphic case above.
+      if (morphism == 0 && profile.has_receiver(1) &&
+          C->directive()->PolymorphicInliningOption) {
+        int num_recorded = 0;
+        float recorded_prob = 0;
+        while (profile.has_receiver(num_recorded)) {
+          recorded_prob += profile.receiver_prob(num_recorded);
+          num_recorded++;
+        }
+        if (100.*recorded_prob >= (float)TypeProfileMajorReceiverPercent) {
+          // Build the chain inside out, starting from the virtual call
+          // that the last guard falls through to. A guard only pays for
+          // itself if its target is inlined, so receivers whose method
+          // does not resolve or inline are skipped; the fall-through
+          // virtual call handles them like any unrecorded receiver.
+          CallGenerator* chain_cg = CallGenerator::for_virtual_call(callee, vtable_index);
+          int   num_guards   = 0;
+          float covered_prob = 0;
+          for (int i = num_recorded - 1; i >= 0; i--) {
+            ciMethod* recv_method = callee->resolve_invoke(jvms->method()->holder(),
+                                                           profile.receiver(i));
+            if (recv_method == NULL) {
+              continue;
+            }
+            CallGenerator* hit_cg = this->call_generator(recv_method,
+                  vtable_index, !call_does_dispatch, jvms, allow_inline, prof_factor);
+            if (hit_cg == NULL || !hit_cg->is_inline()) {
+              continue;
+            }
+            // The guard for receiver i is only reached when the guards for
+            // the more frequent receivers before it failed, so condition
+            // its hit probability on theirs.
+            float prior_prob = 0;
+            for (int j = 0; j < i; j++) {
+              prior_prob += profile.receiver_prob(j);
+            }
+            float hit_prob = profile.receiver_prob(i);
+            if (prior_prob < 1.0f && hit_prob / (1.0f - prior_prob) < PROB_MAX) {
+              hit_prob = hit_prob / (1.0f - prior_prob);
+            } else {
+              hit_prob = PROB_MAX;
+            }
+            trace_type_profile(C, jvms->method(), jvms->depth() - 1, jvms->bci(), recv_method, profile.receiver(i), site_count, profile.receiver_count(i));
+            chain_cg = CallGenerator::for_predicted_call(profile.receiver(i), chain_cg, hit_cg, hit_prob);
+            num_guards++;
+            covered_prob += profile.receiver_prob(i);
+          }
+          // Chains of zero or one guard add nothing over the major
+          // receiver path above; longer ones are only kept if the
+          // inlined receivers still cover the dominant share.
+          if (num_guards >= 2 &&
+              100.*covered_prob >= (float)TypeProfileMajorReceiverPercent) {
+            return chain_cg;
+          }
+        }
+      }
     }
 
     // If there is only one implementor of this interface then we
@@ -483,6 +483,14 @@ void PhaseCFG::implicit_null_check(Block* block, Node *proj, Node *val, int allo
 // remaining cases (most), choose the instruction with the greatest latency
 // (that is, the most number of pseudo-cycles required to the end of the
 // routine). If there is a tie, choose the instruction with the most inputs.
+//
+// The latencies driving this choice come from the pipeline descriptions
+// in the platform .ad file, so a port that wants loads hoisted further
+// ahead of their uses should refine its pipe classes (they feed
+// get_latency_for_node via the matcher) rather than grow a new
+// scheduler here: on the out-of-order cores we target, the hardware
+// reorders within its window anyway, and this pass mainly needs to keep
+// the critical path honest and register pressure sane.
 Node* PhaseCFG::select(
   Block* block,
   Node_List &worklist,
@@ -223,6 +223,7 @@ class LibraryCallKit : public GraphKit {
   bool inline_string_getCharsU();
   bool inline_string_copy(bool compress);
   bool inline_string_char_access(bool is_store);
+  bool inline_string_hashCode(bool is_latin1);
   Node* round_double_node(Node* n);
   bool runtime_math(const TypeFunc* call_type, address funcAddr, const char* funcName);
   bool inline_math_native(vmIntrinsics::ID id);
@@ -509,6 +510,17 @@ Node* LibraryIntrinsic::generate_predicate(JVMState* jvms, int predicate) {
   return NULL;
 }
 
+// An intrinsic here replaces a call site with IR unconditionally, so a
+// candidate needs a shape the compiler can commit to at compile time.
+// That is why e.g. a sorting-network intrinsic for small Arrays.sort
+// ranges does not fit this mechanism: the range length is a runtime
+// value (the library reaches its small-range sorts from inside the
+// dual-pivot partitioning), so the expansion would have to carry the
+// full-size fallback call next to the emitted network at every call
+// site, and the network itself would need per-platform vector patterns
+// that do not exist in the .ad files.  Specializations with that kind
+// of dynamic dispatch belong in the Java library, where they can be
+// expressed once and still benefit from the simpler intrinsics below.
 bool LibraryCallKit::try_to_inline(int predicate) {
   // Handle symbolic names for otherwise undistinguished boolean switches:
   const bool is_store       = true;
@@ -593,6 +605,9 @@ bool LibraryCallKit::try_to_inline(int predicate) {
   case vmIntrinsics::_inflateStringC:
   case vmIntrinsics::_inflateStringB:           return inline_string_copy(!is_compress);
 
+  case vmIntrinsics::_hashCodeL:                return inline_string_hashCode(true);
+  case vmIntrinsics::_hashCodeU:                return inline_string_hashCode(false);
+
   case vmIntrinsics::_getReference:             return inline_unsafe_access(!is_store, T_OBJECT,   Relaxed, false);
   case vmIntrinsics::_getBoolean:               return inline_unsafe_access(!is_store, T_BOOLEAN,  Relaxed, false);
   case vmIntrinsics::_getByte:                  return inline_unsafe_access(!is_store, T_BYTE,     Relaxed, false);
@@ -1561,6 +1576,52 @@ bool LibraryCallKit::inline_string_copy(bool compress) {
   return true;
 }
 
+//------------------------inline_string_hashCode--------------------------
+// public static int StringLatin1.hashCode(byte[] value)
+// public static int StringUTF16.hashCode(byte[] value)
+bool LibraryCallKit::inline_string_hashCode(bool is_latin1) {
+  assert(UseStringHashCodeIntrinsic, "need StringHashCode intrinsic support");
+
+  address stubAddr = is_latin1 ? StubRoutines::stringLatin1HashCode()
+                               : StubRoutines::stringUTF16HashCode();
+  if (stubAddr == NULL) {
+    return false; // Intrinsic's stub is not implemented on this platform
+  }
+  const char* stubName = is_latin1 ? "stringLatin1HashCode" : "stringUTF16HashCode";
+  assert(callee()->signature()->size() == 1, "hashCode has 1 parameter");
+
+  Node* ary = argument(0);
+
+  const Type* ary_type = ary->Value(&_gvn);
+  const TypeAryPtr* top_ary = ary_type->isa_aryptr();
+  if (top_ary == NULL || top_ary->klass() == NULL) {
+    // failed array check
+    return false;
+  }
+
+  ary = must_be_not_null(ary, true);
+  if (stopped()) {
+    return true;
+  }
+  ary = access_resolve(ary, ACCESS_READ);
+
+  Node* cnt = load_array_length(ary);
+  if (!is_latin1) {
+    // The UTF-16 hash is computed over chars stored in a byte array.
+    cnt = _gvn.transform(new RShiftINode(cnt, intcon(1)));
+  }
+  Node* ary_start = array_element_address(ary, intcon(0), T_BYTE);
+
+  Node* call = make_runtime_call(RC_LEAF, OptoRuntime::stringHashCode_Type(),
+                                 stubAddr, stubName, TypePtr::BOTTOM,
+                                 ary_start, cnt);
+  Node* result = _gvn.transform(new ProjNode(call, TypeFunc::Parms));
+  set_result(result);
+  clear_upper_avx();
+
+  return true;
+}
+
 #ifdef _LP64
 #define XTOP ,top() /*additional argument*/
 #else  //_LP64
@@ -729,6 +729,59 @@ bool IdealLoopTree::is_range_check_if(IfNode *iff, PhaseIdealLoop *phase, Invari
   return true;
 }
 
+//------------------------------is_masked_index_check_if ----------------------------
+// Returns true if the predicate of iff is in "index & (range-1) u< range" format,
+// the range check shape left behind for accesses into power-of-2 sized arrays with
+// a masked index (ring buffers). The masked index can only be out of range when the
+// range itself is zero, so the check can be hoisted as a single test of the
+// invariant range regardless of how the index varies in the loop.
+bool IdealLoopTree::is_masked_index_check_if(IfNode *iff, PhaseIdealLoop *phase, Invariance& invar) const {
+  if (!is_loop_exit(iff)) {
+    return false;
+  }
+  if (!iff->in(1)->is_Bool()) {
+    return false;
+  }
+  const BoolNode *bol = iff->in(1)->as_Bool();
+  if (bol->_test._test != BoolTest::lt) {
+    return false;
+  }
+  if (!bol->in(1)->is_Cmp()) {
+    return false;
+  }
+  const CmpNode *cmp = bol->in(1)->as_Cmp();
+  if (cmp->Opcode() != Op_CmpU) {
+    return false;
+  }
+  Node* range = cmp->in(2);
+  if (range->Opcode() != Op_LoadRange && !iff->is_RangeCheck()) {
+    const TypeInt* tint = phase->_igvn.type(range)->isa_int();
+    if (tint == NULL || tint->empty() || tint->_lo < 0) {
+      // Only trust the shape for actual range checks or for values
+      // which are known to be non-negative like an array length.
+      return false;
+    }
+  }
+  if (!invar.is_invariant(range)) {
+    return false;
+  }
+  Node* index = cmp->in(1);
+  if (index->Opcode() != Op_AndI) {
+    return false;
+  }
+  // Look for "range-1" on either input of the mask. "range - 1" is
+  // canonicalized to "range + (-1)" so only the AddI shape can appear here.
+  for (uint i = 1; i <= 2; i++) {
+    Node* mask = index->in(i);
+    if (mask->Opcode() == Op_AddI &&
+        phase->_igvn.find_int_con(mask->in(2), 0) == -1 &&
+        mask->in(1)->eqv_uncast(range)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 //------------------------------rc_predicate-----------------------------------
 // Create a range check predicate
 //
@@ -1283,6 +1336,44 @@ bool PhaseIdealLoop::loop_predication_impl_helper(IdealLoopTree *loop, ProjNode*
       tty->print("Predicate RC ");
       loop->dump_head();
     }
+#endif
+  } else if (loop->is_masked_index_check_if(iff, this, invar)) {
+    // Check of an index masked down to "range-1". The masked index is
+    // always in range unless the range itself is zero, so a single
+    // "0 u< range" test at the loop entry covers every iteration and
+    // the body runs unchecked.
+    const Node* cmp = bol->in(1)->as_Cmp();
+    Node* rng = cmp->in(2);
+    assert(invar.is_invariant(rng), "range must be invariant");
+
+    // Perform cloning to keep Invariance state correct since the
+    // late schedule will place invariant things in the loop.
+    Node* ctrl = predicate_proj->in(0)->as_If()->in(0);
+    rng = invar.clone(rng, ctrl);
+
+    Node* non_empty_cmp = new CmpUNode(zero, rng);
+    register_new_node(non_empty_cmp, ctrl);
+    BoolNode* non_empty_bol = new BoolNode(non_empty_cmp, BoolTest::lt);
+    register_new_node(non_empty_bol, ctrl);
+    // Negate test if necessary
+    bool negated = false;
+    if (proj->_con != predicate_proj->_con) {
+      non_empty_bol = new BoolNode(non_empty_bol->in(1), non_empty_bol->_test.negate());
+      register_new_node(non_empty_bol, ctrl);
+      negated = true;
+    }
+    new_predicate_proj = create_new_if_for_predicate(predicate_proj, NULL, reason, iff->Opcode());
+    IfNode* new_predicate_iff = new_predicate_proj->in(0)->as_If();
+    _igvn.hash_delete(new_predicate_iff);
+    new_predicate_iff->set_req(1, non_empty_bol);
+#ifndef PRODUCT
+    if (TraceLoopPredicate) {
+      tty->print("Predicate masked index check if%s: %d ", negated ? " negated" : "", new_predicate_iff->_idx);
+      loop->dump_head();
+    } else if (TraceLoopOpts) {
+      tty->print("Predicate MRC ");
+      loop->dump_head();
+    }
 #endif
   } else {
     // Loop variant check (for example, range check in non-counted loop)
@@ -621,6 +621,10 @@ public:
   // Return TRUE if "iff" is a range check.
   bool is_range_check_if(IfNode *iff, PhaseIdealLoop *phase, Invariance& invar) const;
 
+  // Return TRUE if "iff" is a range check of an index masked down to
+  // an invariant "range-1".
+  bool is_masked_index_check_if(IfNode *iff, PhaseIdealLoop *phase, Invariance& invar) const;
+
   // Estimate the number of nodes required when cloning a loop (body).
   uint est_loop_clone_sz(uint factor) const;
 
@@ -322,6 +322,10 @@ void Matcher::match( ) {
   // Swap out to old-space; emptying new-space
   Arena *old = C->node_arena()->move_contents(C->old_arena());
 
+  // Reclaimed node storage lives in old-space now; drop it so new-space
+  // nodes are not handed out of the old arena.
+  C->reset_node_storage_free_list();
+
   // Save debug and profile information for nodes in old space:
   _old_node_note_array = C->node_note_array();
   if (_old_node_note_array != NULL) {
@@ -1478,6 +1482,16 @@ static bool match_into_reg( const Node *n, Node *m, Node *control, int i, bool s
         (m->is_DecodeNKlass() && Matcher::narrow_klass_use_complex_address())) {
       // These are commonly used in address expressions and can
       // efficiently fold into them on X64 in some cases.
+      //
+      // Whether folding pays is the platform's call, which is why it is
+      // gated on the narrow_*_use_complex_address queries rather than
+      // done unconditionally: they answer true only for encodings the
+      // addressing hardware can absorb for free (e.g. zero-based
+      // compressed oops with a 3-bit shift on x64).  Cloning a decode
+      // into addresses the ISA cannot fold would just re-materialize
+      // the decode at every memory use.  Loads, stores and atomics all
+      // funnel through this same sharing decision, so an answer of true
+      // covers every memory path at once.
       return false;
     }
   }
@@ -598,11 +598,20 @@ void Node::destruct() {
     compile->node_arena()->Afree(out_array, out_edge_size);
   }
 
-  // Free the input edge array and the node itself
+  // Free the input edge array and the node itself. If the arena cannot
+  // take the storage back (it was not the most recent allocation),
+  // remember it so it can be recycled once the node is fully dismantled.
+#ifndef ASSERT
+  char* recycle_mem  = NULL;
+  int   recycle_size = 0;
+#endif
   if( edge_end == (char*)this ) {
     // It was; free the input array and object all in one hit
 #ifndef ASSERT
-    compile->node_arena()->Afree(_in,edge_size+node_size);
+    if (!compile->node_arena()->Afree(_in,edge_size+node_size)) {
+      recycle_mem  = (char*)_in;
+      recycle_size = edge_size+node_size;
+    }
 #endif
   } else {
     // Free just the input array
@@ -610,7 +619,10 @@ void Node::destruct() {
 
     // Free just the object
 #ifndef ASSERT
-    compile->node_arena()->Afree(this,node_size);
+    if (!compile->node_arena()->Afree(this,node_size)) {
+      recycle_mem  = (char*)this;
+      recycle_size = node_size;
+    }
 #endif
   }
   if (is_macro()) {
@@ -638,6 +650,11 @@ void Node::destruct() {
   _in = _out = (Node**) badAddress;
   _max = _cnt = _outmax = _outcnt = 0;
   compile->remove_modified_node(this);
+#else
+  // Done with this node; its storage can be handed out again.
+  if (recycle_mem != NULL) {
+    compile->recycle_node_storage(recycle_mem, recycle_size);
+  }
 #endif
 }
 
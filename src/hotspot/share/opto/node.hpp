@@ -224,6 +224,13 @@ public:
 
   inline void* operator new(size_t x) throw() {
     Compile* C = Compile::current();
+#ifndef ASSERT
+    // Prefer the storage of a same-sized dead node over growing the arena.
+    void* mem = C->reuse_node_storage(x);
+    if (mem != NULL) {
+      return mem;
+    }
+#endif
     Node* n = (Node*)C->node_arena()->Amalloc_D(x);
     return (void*)n;
   }
@@ -2053,6 +2053,105 @@ Node *PhasePeephole::transform( Node *n ) {
   return NULL;
 }
 
+//------------------------------sink_compare_to_branch-------------------------
+// Modern x86 cores fuse a flag-setting compare or test with an immediately
+// following conditional jump into a single macro-op, but only when the two
+// instructions are adjacent.  Scheduling and spilling are free to place
+// flag-neutral instructions between the compare and the branch, which breaks
+// the pair.  Sink the compare down to the branch when it is safe to do so.
+void PhasePeephole::sink_compare_to_branch( Block *block ) {
+  uint number_of_nodes = block->number_of_nodes();
+  if( number_of_nodes < 4 ) return; // Too small to have anything in between
+
+  // Find the branch ending the block, stepping over its projections.
+  uint branch_index = number_of_nodes - 1;
+  while( branch_index > 0 && block->get_node(branch_index)->is_MachProj() ) {
+    branch_index--;
+  }
+  Node *branch = block->get_node(branch_index);
+  if( !branch->is_MachIf() ) return; // Not a conditional branch
+
+  // The flags must come from a compare in this block whose only use is the
+  // branch itself; a second user would see stale flags after the move.
+  Node *cmp = branch->in(1);
+  if( cmp == NULL || !cmp->is_Mach() || cmp->outcnt() != 1 ) return;
+  switch( cmp->as_Mach()->ideal_Opcode() ) {
+  case Op_CmpI: case Op_CmpU: case Op_CmpL: case Op_CmpUL:
+  case Op_CmpP: case Op_CmpN:
+    break;
+  default:
+    return;                     // Not a compare the hardware will fuse
+  }
+  // A compare with a memory operand cannot be moved past stores (and does
+  // not reliably fuse either).
+  if( cmp->as_Mach()->memory_operand() != NULL ) return;
+
+  uint cmp_index = 0;
+  for( uint i = branch_index-1; i > 0; --i ) {
+    if( block->get_node(i) == cmp ) { cmp_index = i; break; }
+  }
+  if( cmp_index == 0 ) return;  // Compare is defined in a dominating block
+  if( cmp_index == branch_index-1 ) return; // Already adjacent
+
+  // Collect the registers the compare reads.  The allocator guarantees that
+  // nothing between a flags def and its use touches the flags, so the move
+  // is safe as long as the compare's inputs survive the instructions it is
+  // moved across.
+  const uint max_in_regs = 8;
+  OptoReg::Name in_regs[max_in_regs];
+  uint num_in_regs = 0;
+  for( uint j = 1; j < cmp->req(); j++ ) {
+    Node *def = cmp->in(j);
+    if( def == NULL ) continue;
+    OptoReg::Name first  = _regalloc->get_reg_first(def);
+    OptoReg::Name second = _regalloc->get_reg_second(def);
+    if( OptoReg::is_valid(first) ) {
+      if( num_in_regs == max_in_regs ) return;
+      in_regs[num_in_regs++] = first;
+    }
+    if( OptoReg::is_valid(second) ) {
+      if( num_in_regs == max_in_regs ) return;
+      in_regs[num_in_regs++] = second;
+    }
+  }
+
+  // Check every instruction the compare would move across.  Extra defs
+  // (KILL effects) show up as separate MachProj nodes in the block, and
+  // temporary registers as MachTemp inputs, so a linear scan covers them.
+  for( uint i = cmp_index+1; i < branch_index; ++i ) {
+    Node *m = block->get_node(i);
+    // Calls and safepoints clobber more than their visible defs.
+    if( m->is_MachSafePoint() ) return;
+    OptoReg::Name first  = _regalloc->get_reg_first(m);
+    OptoReg::Name second = _regalloc->get_reg_second(m);
+    for( uint k = 0; k < num_in_regs; k++ ) {
+      if( in_regs[k] == first || in_regs[k] == second ) return;
+    }
+    for( uint j = 1; j < m->req(); j++ ) {
+      Node *in = m->in(j);
+      if( in == NULL || !in->is_MachTemp() ) continue;
+      OptoReg::Name tmp_first  = _regalloc->get_reg_first(in);
+      OptoReg::Name tmp_second = _regalloc->get_reg_second(in);
+      for( uint k = 0; k < num_in_regs; k++ ) {
+        if( in_regs[k] == tmp_first || in_regs[k] == tmp_second ) return;
+      }
+    }
+  }
+
+#ifndef PRODUCT
+  if( PrintOptoPeephole ) {
+    tty->print("macro-fusion: sinking ");
+    cmp->as_Mach()->format(_regalloc);
+    tty->print_cr(" to branch in B%d", block->_pre_order);
+  }
+#endif
+  // Register allocation info is keyed by node index, not block position,
+  // so the node can simply be moved.
+  block->remove_node(cmp_index);
+  block->insert_node(cmp, branch_index-1);
+  NOT_PRODUCT( inc_peepholes(); )
+}
+
 //------------------------------do_transform-----------------------------------
 void PhasePeephole::do_transform() {
   bool method_name_not_printed = true;
@@ -2062,6 +2161,9 @@ void PhasePeephole::do_transform() {
     Block* block = _cfg.get_block(block_number);
     bool block_not_printed = true;
 
+    // Pair compares with the branches that consume them.
+    sink_compare_to_branch(block);
+
     // and each instruction within a block
     uint end_index = block->number_of_nodes();
     // block->end_idx() not valid after PhaseRegAlloc
@@ -638,6 +638,11 @@ public:
   // Do any transformation after analysis
   void          do_transform();
 
+  // Sink a compare defining only the flags register down next to the
+  // conditional branch consuming it, so the pair can macro-fuse on
+  // hardware that fuses adjacent compare-and-branch sequences.
+  void          sink_compare_to_branch( Block *block );
+
 #ifndef PRODUCT
   static uint _total_peepholes;  // For profiling, count peephole rules applied
   uint   _count_peepholes;
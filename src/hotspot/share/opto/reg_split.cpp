@@ -443,7 +443,7 @@ bool PhaseChaitin::is_high_pressure( Block *b, LRG *lrg, uint insidx ) {
   // Bound live ranges will split at the binding points first;
   // Intermediate splits should assume the live range's register set
   // got "freed up" and that num_regs will become INT_PRESSURE.
-  int bound_pres = is_float_or_vector ? FLOATPRESSURE : INTPRESSURE;
+  int bound_pres = is_float_or_vector ? Matcher::float_pressure(FLOATPRESSURE) : INTPRESSURE;
   // Effective register pressure limit.
   int lrg_pres = (lrg->get_invalid_mask_size() > lrg->num_regs())
     ? (lrg->get_invalid_mask_size() >> (lrg->num_regs()-1)) : bound_pres;
@@ -801,7 +801,7 @@ uint PhaseChaitin::Split(uint maxlrg, ResourceArea* split_arena) {
               b->_ihrp_index >= b->end_idx() ||
               !b->get_node(b->_ihrp_index)->is_Proj(), "" );
       assert( insidx > b->_fhrp_index ||
-              (b->_freg_pressure < (uint)FLOATPRESSURE) ||
+              (b->_freg_pressure < (uint)Matcher::float_pressure(FLOATPRESSURE)) ||
               b->_fhrp_index > 4000000 ||
               b->_fhrp_index >= b->end_idx() ||
               !b->get_node(b->_fhrp_index)->is_Proj(), "" );
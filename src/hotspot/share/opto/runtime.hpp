@@ -289,6 +289,7 @@ private:
   static const TypeFunc* mulAdd_Type();
 
   static const TypeFunc* vectorizedMismatch_Type();
+  static const TypeFunc* stringHashCode_Type();
 
   static const TypeFunc* ghash_processBlocks_Type();
   static const TypeFunc* base64_encodeBlock_Type();
@@ -695,6 +695,24 @@ const Type* CmpUNode::Value(PhaseGVN* phase) const {
     }
   }
 
+  if (in1_op == Op_AndI) {
+    // Check for "(X AndI (Y-1)) CmpU Y", the range check shape left
+    // behind for accesses into power-of-2 sized arrays with a masked
+    // index. The masked index is always below Y when Y is known to be
+    // positive, no matter what X is.
+    const TypeInt* r2 = t2->is_int();
+    if (r2->_lo >= 1) {
+      for (uint i = 1; i <= 2; i++) {
+        Node* mask = in1->in(i);
+        const TypeInt* tcon = (mask->Opcode() == Op_AddI) ? phase->type(mask->in(2))->isa_int() : NULL;
+        if (tcon != NULL && tcon->is_con(-1) &&
+            mask->in(1)->eqv_uncast(in2)) {
+          return TypeInt::CC_LT;
+        }
+      }
+    }
+  }
+
   return sub(t1, t2);            // Local flavor of type subtraction
 }
 
@@ -702,6 +702,8 @@ void Type::Initialize(Compile* current) {
   Dict *tdic = new (type_arena) Dict( (CmpKey)Type::cmp,(Hash)Type::uhash, type_arena, 128 );
   current->set_type_dict(tdic);
 
+  current->set_type_meet_cache(new (type_arena) TypeMeetCache(type_arena));
+
   // Transfer the shared types.
   DictI i(_shared_type_dict);
   for( ; i.test(); ++i ) {
@@ -710,6 +712,61 @@ void Type::Initialize(Compile* current) {
   }
 }
 
+//------------------------------TypeMeetCache----------------------------------
+TypeMeetCache::TypeMeetCache(Arena* arena) {
+  _arena   = arena;
+  _size    = 256;               // Initial capacity, must be a power of 2
+  _entries = 0;
+  _table   = (Entry*)arena->Amalloc(_size * sizeof(Entry));
+  memset(_table, 0, _size * sizeof(Entry));
+}
+
+const Type* TypeMeetCache::lookup(const Type* l, const Type* r) const {
+  uint i = index(l, r);
+  while (_table[i]._left != NULL) {
+    if (_table[i]._left == l && _table[i]._right == r) {
+      return _table[i]._result;
+    }
+    i = (i + 1) & (_size - 1);
+  }
+  return NULL;
+}
+
+void TypeMeetCache::record(const Type* l, const Type* r, const Type* result) {
+  if (_entries * 2 >= _size) {  // Keep the load factor at or below one half
+    grow();
+  }
+  uint i = index(l, r);
+  while (_table[i]._left != NULL) {
+    if (_table[i]._left == l && _table[i]._right == r) {
+      assert(_table[i]._result == result, "meet must be deterministic");
+      return;
+    }
+    i = (i + 1) & (_size - 1);
+  }
+  _table[i]._left   = l;
+  _table[i]._right  = r;
+  _table[i]._result = result;
+  _entries++;
+}
+
+void TypeMeetCache::grow() {
+  Entry* old_table = _table;
+  uint   old_size  = _size;
+  _size <<= 1;
+  _table = (Entry*)_arena->Amalloc(_size * sizeof(Entry));
+  memset(_table, 0, _size * sizeof(Entry));
+  // The old table is abandoned to the arena; it dies with the compilation.
+  for (uint j = 0; j < old_size; j++) {
+    if (old_table[j]._left == NULL)  continue;
+    uint i = index(old_table[j]._left, old_table[j]._right);
+    while (_table[i]._left != NULL) {
+      i = (i + 1) & (_size - 1);
+    }
+    _table[i] = old_table[j];
+  }
+}
+
 //------------------------------hashcons---------------------------------------
 // Do the hash-cons trick.  If the Type already exists in the type table,
 // delete the current Type and return the existing Type.  Otherwise stick the
@@ -832,7 +889,21 @@ const Type *Type::meet_helper(const Type *t, bool include_speculative) const {
   const Type *this_t = maybe_remove_speculative(include_speculative);
   t = t->maybe_remove_speculative(include_speculative);
 
+  // Serve repeated meets of the same pair from the per-compilation cache.
+  // The cache is keyed on the ordered pair because meets of interface and
+  // oop types are not symmetric (see the assert below).
+  TypeMeetCache* cache = Compile::current()->type_meet_cache();
+  if (cache != NULL) {
+    const Type* cached = cache->lookup(this_t, t);
+    if (cached != NULL) {
+      return cached;
+    }
+  }
+
   const Type *mt = this_t->xmeet(t);
+  if (cache != NULL) {
+    cache->record(this_t, t, mt);
+  }
   if (isa_narrowoop() || t->isa_narrowoop()) return mt;
   if (isa_narrowklass() || t->isa_narrowklass()) return mt;
 #ifdef ASSERT
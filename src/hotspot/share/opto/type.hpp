@@ -66,6 +66,42 @@ class       TypeAryPtr;
 class     TypeKlassPtr;
 class     TypeMetadataPtr;
 
+//------------------------------TypeMeetCache----------------------------------
+// Per-compilation memoization of type lattice meets. Big compilations request
+// the meet of the same pairs of interned types over and over; remembering the
+// result avoids recomputing the meet and re-probing the type dictionary.
+// Open-addressed table with power-of-2 size and linear probing; entries are
+// only ever added, and the table lives in the type arena so it is reclaimed
+// with the compilation.
+class TypeMeetCache : public ResourceObj {
+private:
+  struct Entry {
+    const Type* _left;          // NULL for an unused entry
+    const Type* _right;
+    const Type* _result;
+  };
+  Arena* _arena;                // Type arena of the owning compilation
+  Entry* _table;
+  uint   _size;                 // Table capacity, always a power of 2
+  uint   _entries;              // Used entries
+
+  uint index(const Type* l, const Type* r) const {
+    // Types are hash-cons'd so hashing the identities is sufficient.
+    // Shift out the bits which are zero due to allocation alignment.
+    uintptr_t h = ((uintptr_t)l >> 3) * 31 + ((uintptr_t)r >> 3);
+    return (uint)h & (_size - 1);
+  }
+  void grow();
+
+public:
+  TypeMeetCache(Arena* arena);
+
+  // Return the remembered meet of l and r, or NULL if not computed yet
+  const Type* lookup(const Type* l, const Type* r) const;
+  // Remember the meet of l and r
+  void record(const Type* l, const Type* r, const Type* result);
+};
+
 //------------------------------Type-------------------------------------------
 // Basic Type object, represents a set of primitive Values.
 // Types are hash-cons'd into a private class dictionary, so only one of each
@@ -629,6 +629,18 @@ int ReductionNode::opcode(int opc, BasicType bt) {
       assert(bt == T_DOUBLE, "must be");
       vopc = Op_MaxReductionV;
       break;
+    case Op_AndI:
+      assert(bt == T_INT, "must be");
+      vopc = Op_AndReductionV;
+      break;
+    case Op_OrI:
+      assert(bt == T_INT, "must be");
+      vopc = Op_OrReductionV;
+      break;
+    case Op_XorI:
+      assert(bt == T_INT, "must be");
+      vopc = Op_XorReductionV;
+      break;
     // TODO: add MulL for targets that support it
     default:
       break;
@@ -655,6 +667,9 @@ ReductionNode* ReductionNode::make(int opc, Node *ctrl, Node* n1, Node* n2, Basi
   case Op_MulReductionVD: return new MulReductionVDNode(ctrl, n1, n2);
   case Op_MinReductionV: return new MinReductionVNode(ctrl, n1, n2);
   case Op_MaxReductionV: return new MaxReductionVNode(ctrl, n1, n2);
+  case Op_AndReductionV: return new AndReductionVNode(ctrl, n1, n2);
+  case Op_OrReductionV: return new OrReductionVNode(ctrl, n1, n2);
+  case Op_XorReductionV: return new XorReductionVNode(ctrl, n1, n2);
   default:
     fatal("Missed vector creation for '%s'", NodeClassNames[vopc]);
     return NULL;
@@ -579,6 +579,16 @@ class AndVNode : public VectorNode {
   virtual int Opcode() const;
 };
 
+//------------------------------AndReductionVNode--------------------------------------
+// Vector and int as a reduction
+class AndReductionVNode : public ReductionNode {
+ public:
+  AndReductionVNode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeInt::INT; }
+  virtual uint ideal_reg() const { return Op_RegI; }
+};
+
 //------------------------------OrVNode---------------------------------------
 // Vector or integer
 class OrVNode : public VectorNode {
@@ -587,6 +597,16 @@ class OrVNode : public VectorNode {
   virtual int Opcode() const;
 };
 
+//------------------------------OrReductionVNode--------------------------------------
+// Vector or int as a reduction
+class OrReductionVNode : public ReductionNode {
+ public:
+  OrReductionVNode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeInt::INT; }
+  virtual uint ideal_reg() const { return Op_RegI; }
+};
+
 //------------------------------XorVNode---------------------------------------
 // Vector xor integer
 class XorVNode : public VectorNode {
@@ -595,6 +615,16 @@ class XorVNode : public VectorNode {
   virtual int Opcode() const;
 };
 
+//------------------------------XorReductionVNode--------------------------------------
+// Vector xor int as a reduction
+class XorReductionVNode : public ReductionNode {
+ public:
+  XorReductionVNode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeInt::INT; }
+  virtual uint ideal_reg() const { return Op_RegI; }
+};
+
 //------------------------------MinVNode--------------------------------------
 // Vector min
 class MinVNode : public VectorNode {
@@ -50,17 +50,17 @@ typedef struct {
 
 // These name match the names reported by the forte quality kit
 enum {
-  ticks_no_Java_frame         =  0,
-  ticks_no_class_load         = -1,
-  ticks_GC_active             = -2,
-  ticks_unknown_not_Java      = -3,
-  ticks_not_walkable_not_Java = -4,
-  ticks_unknown_Java          = -5,
-  ticks_not_walkable_Java     = -6,
-  ticks_unknown_state         = -7,
-  ticks_thread_exit           = -8,
-  ticks_deopt                 = -9,
-  ticks_safepoint             = -10
+  ticks_no_Java_frame         =  0,  // no Java frames on the stack, or thread too young
+  ticks_no_class_load         = -1,  // agent did not enable CLASS_LOAD events at startup
+  ticks_GC_active             = -2,  // sample raced a GC that invalidated what was read
+  ticks_unknown_not_Java      = -3,  // top frame unrecognizable, thread outside Java code
+  ticks_not_walkable_not_Java = -4,  // frame found but not walkable, thread outside Java code
+  ticks_unknown_Java          = -5,  // top frame unrecognizable, thread in Java code
+  ticks_not_walkable_Java     = -6,  // frame found but not walkable, thread in Java code
+  ticks_unknown_state         = -7,  // thread is in an unexpected state
+  ticks_thread_exit           = -8,  // sampled thread is exiting or has exited
+  ticks_deopt                 = -9,  // sampled thread is in the deoptimization handler
+  ticks_safepoint             = -10  // sampled thread was stopped at a safepoint
 };
 
 #if INCLUDE_JVMTI
@@ -429,7 +429,8 @@ static void forte_fill_call_trace_given_top(JavaThread* thd,
   assert(trace->frames != NULL, "trace->frames must be non-NULL");
 
   // Walk the stack starting from 'top_frame' and search for an initial Java frame.
-  find_initial_Java_frame(thd, &top_frame, &initial_Java_frame, &method, &bci);
+  bool fully_decipherable =
+      find_initial_Java_frame(thd, &top_frame, &initial_Java_frame, &method, &bci);
 
   // Check if a Java Method has been found.
   if (method == NULL) return;
@@ -439,6 +440,23 @@ static void forte_fill_call_trace_given_top(JavaThread* thd,
     return;
   }
 
+  if (!fully_decipherable) {
+    // A compiled Java method was found but there is no debug information
+    // at the sampled pc, which is typically in the prologue or epilogue
+    // where the frame is not yet (or no longer) described by an oop map.
+    // The sender cannot be computed safely from such a frame, so report
+    // the one method we are sure about instead of failing the sample or
+    // decoding callers from a half-built frame.
+    if (depth > 0) {
+      trace->frames[0].method_id = method->find_jmethod_id_or_null();
+      trace->frames[0].lineno = -1; // no BCI available
+      trace->num_frames = 1;
+    } else {
+      trace->num_frames = 0;
+    }
+    return;
+  }
+
   vframeStreamForte st(thd, initial_Java_frame, false);
 
   for (; !st.at_end() && count < depth; st.forte_next(), count++) {
@@ -51,6 +51,14 @@
 // The fast versions don't check for pending suspension request.
 // This is fine since it's totally read-only and doesn't create new race.
 //
+// This scheme cannot be extended to jni_Set<Primitive>Field: a speculative
+// access is validated only after the fact, which is safe for a load whose
+// result can be discarded, but a store performed while a concurrent
+// compacting GC is moving the object may land in a stale copy or in memory
+// that has been reused for another object, and cannot be undone by
+// retrying. Stores are only safe with safepoints held off, which is
+// exactly the thread state transition the slow path already performs.
+//
 // There is a hypothetical safepoint counter wraparound. But it's not
 // a practical concern.
 
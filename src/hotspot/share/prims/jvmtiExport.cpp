@@ -2615,6 +2615,18 @@ void JvmtiExport::weak_oops_do(BoolObjectClosure* is_alive, OopClosure* f) {
   JvmtiTagMap::weak_oops_do(is_alive, f);
 }
 
+void JvmtiExport::weak_oops_do_prologue() {
+  JvmtiTagMap::weak_oops_do_prologue();
+}
+
+void JvmtiExport::weak_oops_do_parallel(BoolObjectClosure* is_alive, OopClosure* f) {
+  JvmtiTagMap::weak_oops_do_parallel(is_alive, f);
+}
+
+void JvmtiExport::weak_oops_do_epilogue(size_t* num_dead, size_t* num_total) {
+  JvmtiTagMap::weak_oops_do_epilogue(num_dead, num_total);
+}
+
 void JvmtiExport::gc_epilogue() {
   JvmtiCurrentBreakpoints::gc_epilogue();
 }
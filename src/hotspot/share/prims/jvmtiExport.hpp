@@ -388,6 +388,10 @@ class JvmtiExport : public AllStatic {
 
   static void oops_do(OopClosure* f) NOT_JVMTI_RETURN;
   static void weak_oops_do(BoolObjectClosure* b, OopClosure* f) NOT_JVMTI_RETURN;
+  // Chunked form of weak_oops_do for parallel GC workers; see JvmtiTagMap.
+  static void weak_oops_do_prologue() NOT_JVMTI_RETURN;
+  static void weak_oops_do_parallel(BoolObjectClosure* b, OopClosure* f) NOT_JVMTI_RETURN;
+  static void weak_oops_do_epilogue(size_t* num_dead, size_t* num_total) NOT_JVMTI_RETURN;
   static void gc_epilogue() NOT_JVMTI_RETURN;
 
   static void transition_pending_onload_raw_monitors() NOT_JVMTI_RETURN;
@@ -3926,7 +3926,21 @@ void VM_RedefineClasses::swap_annotations(InstanceKlass* the_class,
 }
 
 
-// Install the redefinition of a class:
+// Install the redefinition of a class. The new class version is always
+// installed whole, even when only a single method's bytecodes changed.
+// Patching individual methods into the existing klass has been considered
+// and rejected: running frames reference the old Method* and, for
+// interpreted frames, hold an mdp into its MethodData, so old methods
+// must stay intact and executable until their activations unwind; the
+// merged constant pool renumbers entries, so even an unchanged method's
+// bytecodes may need rewriting; and the obsolete/EMCP bookkeeping that
+// GC and jmethodIDs rely on is tracked per class version, not per
+// method. The cheap cases are instead handled within the full swap:
+// methods that are equivalent modulo the constant pool (EMCP) are not
+// marked obsolete, and only compiled code that embeds old methods of the
+// redefined class is deoptimized (see flush_dependent_code).
+//
+// The installation steps are:
 //    - house keeping (flushing breakpoints and caches, deoptimizing
 //      dependent compiled code)
 //    - replacing parts in the_class with parts from scratch_class
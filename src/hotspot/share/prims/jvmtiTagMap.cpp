@@ -28,6 +28,7 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "gc/shared/markBitMap.inline.hpp"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
@@ -46,6 +47,7 @@
 #include "prims/jvmtiExport.hpp"
 #include "prims/jvmtiImpl.hpp"
 #include "prims/jvmtiTagMap.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/biasedLocking.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/handles.inline.hpp"
@@ -53,12 +55,15 @@
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "runtime/reflectionUtils.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/vframe.hpp"
 #include "runtime/vmThread.hpp"
 #include "runtime/vmOperations.hpp"
+#include "utilities/globalCounter.inline.hpp"
 #include "utilities/macros.hpp"
 #if INCLUDE_ZGC
 #include "gc/z/zGlobals.hpp"
@@ -72,14 +77,20 @@
 // Each entry encapsulates a reference to the tagged object
 // and the tag value. In addition an entry includes a next pointer which
 // is used to chain entries together.
+//
+// Entries are traversed lock-free by GetTag inside a GlobalCounter
+// critical section, so the next link and the tag are accessed with
+// acquire/release or atomic semantics, and an entry that has been
+// unlinked by a mutator thread is only freed or reused after a
+// GlobalCounter::write_synchronize() grace period.
 
 class JvmtiTagHashmapEntry : public CHeapObj<mtInternal> {
  private:
   friend class JvmtiTagMap;
 
   oop _object;                          // tagged object
-  jlong _tag;                           // the tag
-  JvmtiTagHashmapEntry* _next;          // next on the list
+  volatile jlong _tag;                  // the tag
+  JvmtiTagHashmapEntry* volatile _next; // next on the list
 
   inline void init(oop object, jlong tag) {
     _object = object;
@@ -100,11 +111,13 @@ class JvmtiTagHashmapEntry : public CHeapObj<mtInternal> {
   inline oop object_peek()  {
     return NativeAccess<ON_PHANTOM_OOP_REF | AS_NO_KEEPALIVE>::oop_load(object_addr());
   }
-  inline jlong tag() const  { return _tag; }
+  // Atomic accesses so a lock-free reader cannot see a torn tag value
+  // while SetTag updates it on another thread.
+  inline jlong tag() const  { return Atomic::load(&_tag); }
 
   inline void set_tag(jlong tag) {
     assert(tag != 0, "can't be zero");
-    _tag = tag;
+    Atomic::store(tag, &_tag);
   }
 
   inline bool equals(oop object) {
@@ -112,7 +125,13 @@ class JvmtiTagHashmapEntry : public CHeapObj<mtInternal> {
   }
 
   inline JvmtiTagHashmapEntry* next() const        { return _next; }
+  inline JvmtiTagHashmapEntry* next_acquire() const {
+    return OrderAccess::load_acquire(&_next);
+  }
   inline void set_next(JvmtiTagHashmapEntry* next) { _next = next; }
+  inline void release_set_next(JvmtiTagHashmapEntry* next) {
+    OrderAccess::release_store(&_next, next);
+  }
 };
 
 
@@ -158,6 +177,13 @@ class JvmtiTagHashmap : public CHeapObj<mtInternal> {
 
   JvmtiTagHashmapEntry** _table;        // the table of entries.
 
+  // Epoch for the lock-free find path. It is made odd before resize()
+  // starts relinking entries and even again once the new table has been
+  // published, in the style of the safepoint counter. A lock-free reader
+  // that observes an odd epoch, or an epoch change across its bucket
+  // walk, discards its result and falls back to a locked lookup.
+  volatile int _table_epoch;
+
   // private accessors
   int resize_threshold() const                  { return _resize_threshold; }
   int trace_threshold() const                   { return _trace_threshold; }
@@ -172,6 +198,7 @@ class JvmtiTagHashmap : public CHeapObj<mtInternal> {
     _load_factor = load_factor;
     _resize_threshold = (int)(_load_factor * _size);
     _resizing_enabled = true;
+    _table_epoch = 0;
     size_t s = initial_size * sizeof(JvmtiTagHashmapEntry*);
     _table = (JvmtiTagHashmapEntry**)os::malloc(s, mtInternal);
     if (_table == NULL) {
@@ -220,9 +247,16 @@ class JvmtiTagHashmap : public CHeapObj<mtInternal> {
       new_table[i] = NULL;
     }
 
+    // Make the epoch odd so that lock-free readers that race with the
+    // relinking below fall back to a locked lookup.
+    int epoch = _table_epoch;
+    OrderAccess::release_store(&_table_epoch, epoch + 1);
+    OrderAccess::fence();
+
     // rehash all entries into the new table
+    JvmtiTagHashmapEntry** old_table = _table;
     for (i=0; i<_size; i++) {
-      JvmtiTagHashmapEntry* entry = _table[i];
+      JvmtiTagHashmapEntry* entry = old_table[i];
       while (entry != NULL) {
         JvmtiTagHashmapEntry* next = entry->next();
         oop key = entry->object_peek();
@@ -240,25 +274,34 @@ class JvmtiTagHashmap : public CHeapObj<mtInternal> {
       }
     }
 
-    // free old table and update settings.
-    os::free((void*)_table);
+    // publish the new table and update settings.
     _table = new_table;
     _size_index = new_size_index;
     _size = new_size;
+    OrderAccess::release_store(&_table_epoch, epoch + 2);
 
     // compute new resize threshold
     _resize_threshold = (int)(_load_factor * _size);
+
+    // Free the old table only after any lock-free reader that may still
+    // be walking it has left its critical section. During the relinking
+    // above such a reader can stray onto a chain of the new table, which
+    // is harmless; the epoch check makes it discard the result.
+    GlobalCounter::write_synchronize();
+    os::free((void*)old_table);
   }
 
 
   // internal remove function - remove an entry at a given position in the
-  // table.
+  // table. The entry keeps its next link so that a lock-free reader that
+  // still holds it can continue its bucket walk; the caller must not free
+  // or reuse the entry before a GlobalCounter grace period has passed.
   inline void remove(JvmtiTagHashmapEntry* prev, int pos, JvmtiTagHashmapEntry* entry) {
     assert(pos >= 0 && pos < _size, "out of range");
     if (prev == NULL) {
-      _table[pos] = entry->next();
+      OrderAccess::release_store(&_table[pos], entry->next());
     } else {
-      prev->set_next(entry->next());
+      prev->release_set_next(entry->next());
     }
     assert(_entry_count > 0, "checking");
     _entry_count--;
@@ -326,20 +369,52 @@ class JvmtiTagHashmap : public CHeapObj<mtInternal> {
     return NULL;
   }
 
+  // Lock-free variant of find() for GetTag. Must be called from within a
+  // GlobalCounter critical section, which keeps unlinked entries and a
+  // replaced table from being freed under the walk. Returns false if a
+  // concurrent resize was detected; the caller then retries under the tag
+  // map lock. On success the tag (or 0 if the object is untagged) is
+  // returned through *tag.
+  inline bool find_lock_free(oop key, jlong* tag) {
+    int epoch = OrderAccess::load_acquire(&_table_epoch);
+    if ((epoch & 1) != 0) {
+      return false;       // resize in progress
+    }
+    JvmtiTagHashmapEntry** table = _table;
+    int size = _size;
+    unsigned int h = hash(key, size);
+    JvmtiTagHashmapEntry* entry = OrderAccess::load_acquire(&table[h]);
+    while (entry != NULL) {
+      if (entry->equals(key)) {
+        break;
+      }
+      entry = entry->next_acquire();
+    }
+    jlong result = (entry == NULL) ? 0 : entry->tag();
+    // If the epoch changed then a resize may have relinked entries while
+    // we walked the bucket and the result cannot be trusted.
+    OrderAccess::loadload();
+    if (_table_epoch != epoch) {
+      return false;
+    }
+    *tag = result;
+    return true;
+  }
 
-  // add a new entry to hashmap
+  // add a new entry to hashmap. The entry is initialized before it is
+  // made reachable from the bucket with a releasing store, so a lock-free
+  // reader always sees a fully constructed entry.
   inline void add(oop key, JvmtiTagHashmapEntry* entry) {
     assert(key != NULL, "checking");
     assert(find(key) == NULL, "duplicate detected");
     unsigned int h = hash(key);
     JvmtiTagHashmapEntry* anchor = _table[h];
     if (anchor == NULL) {
-      _table[h] = entry;
       entry->set_next(NULL);
     } else {
       entry->set_next(anchor);
-      _table[h] = entry;
     }
+    OrderAccess::release_store(&_table[h], entry);
 
     _entry_count++;
     if (log_is_enabled(Debug, jvmti, objecttagging) && entry_count() >= trace_threshold()) {
@@ -438,7 +513,10 @@ JvmtiTagMap::JvmtiTagMap(JvmtiEnv* env) :
   _env(env),
   _lock(Mutex::nonleaf+2, "JvmtiTagMap._lock", false),
   _free_entries(NULL),
-  _free_entries_count(0)
+  _free_entries_count(0),
+  _sweep_claim(0),
+  _dead_entries(NULL),
+  _moved_entries(NULL)
 {
   assert(JvmtiThreadState_lock->is_locked(), "sanity check");
   assert(((JvmtiEnvBase *)env)->tag_map() == NULL, "tag map already exists for environment");
@@ -502,6 +580,13 @@ JvmtiTagHashmapEntry* JvmtiTagMap::create_entry(oop ref, jlong tag) {
 // destroy an entry by returning it to the free list
 void JvmtiTagMap::destroy_entry(JvmtiTagHashmapEntry* entry) {
   assert(SafepointSynchronize::is_at_safepoint() || is_locked(), "checking");
+  // A lock-free GetTag may still reference the entry after it has been
+  // unlinked; wait for such readers to leave their critical sections
+  // before the entry is freed or recycled. At a safepoint no reader can
+  // be inside a critical section.
+  if (!SafepointSynchronize::is_at_safepoint()) {
+    GlobalCounter::write_synchronize();
+  }
   // limit the size of the free list
   if (_free_entries_count >= max_free_entries) {
     delete entry;
@@ -756,11 +841,23 @@ void JvmtiTagMap::set_tag(jobject object, jlong tag) {
 
 // get the tag for an object
 jlong JvmtiTagMap::get_tag(jobject object) {
-  MutexLocker ml(lock());
-
   // resolve the object
   oop o = JNIHandles::resolve_non_null(object);
 
+  // Lock-free fast path. The critical section keeps unlinked entries and
+  // replaced tables from being freed while the bucket walk may still
+  // reference them, so GetTag does not contend with SetTag from other
+  // threads.
+  {
+    GlobalCounter::CriticalSection cs(Thread::current());
+    jlong tag;
+    if (hashmap()->find_lock_free(o, &tag)) {
+      return tag;
+    }
+  }
+
+  // a concurrent resize was detected - retry under the lock
+  MutexLocker ml(lock());
   return tag_for(this, o);
 }
 
@@ -1612,18 +1709,21 @@ jvmtiError JvmtiTagMap::get_objects_with_tags(const jlong* tags,
 // ObjectMarker is used to support the marking objects when walking the
 // heap.
 //
-// This implementation uses the existing mark bits in an object for
-// marking. Objects that are marked must later have their headers restored.
-// As most objects are unlocked and don't have their identity hash computed
-// we don't have to save their headers. Instead we save the headers that
-// are "interesting". Later when the headers are restored this implementation
-// restores all headers to their initial value and then restores the few
-// objects that had interesting headers.
+// Marking is normally done in a temporary bitmap with one bit per word of
+// the heap, committed for the duration of the heap walk only. This leaves
+// the object headers untouched, so nothing has to be saved before the walk
+// and no pass over the heap is needed afterwards to clear the mark bits.
 //
-// Future work: This implementation currently uses growable arrays to save
-// the oop and header of interesting objects. As an optimization we could
-// use the same technique as the GC and make use of the unused area
-// between top() and end().
+// If the bitmap cannot be used - because the heap's reserved address range
+// is many times its usable size (ZGC maps the heap at several aliases), or
+// because the memory for the bitmap is not available - marking falls back
+// to using the existing mark bits in the objects. Objects that are marked
+// this way must later have their headers restored. As most objects are
+// unlocked and don't have their identity hash computed we don't have to
+// save their headers. Instead we save the headers that are "interesting".
+// Later when the headers are restored this implementation restores all
+// headers to their initial value and then restores the few objects that
+// had interesting headers.
 //
 
 // An ObjectClosure used to restore the mark bits of an object
@@ -1639,14 +1739,25 @@ class RestoreMarksClosure : public ObjectClosure {
   }
 };
 
+// The mark bitmap is only needed for the duration of a heap walk, so it
+// is allocated on the C heap.
+class JvmtiHeapWalkBitMap : public MarkBitMap, public CHeapObj<mtInternal> {};
+
 // ObjectMarker provides the mark and visited functions
 class ObjectMarker : AllStatic {
  private:
-  // saved headers
+  // marking bitmap, or NULL if marking in the object headers
+  static JvmtiHeapWalkBitMap* _bitmap;
+  static char* _bitmap_storage;
+  static size_t _bitmap_storage_size;
+
+  // saved headers, used when marking in the object headers
   static GrowableArray<oop>* _saved_oop_stack;
   static GrowableArray<markOop>* _saved_mark_stack;
   static bool _needs_reset;                  // do we need to reset mark bits?
 
+  static bool init_bitmap();
+
  public:
   static void init();                       // initialize
   static void done();                       // clean-up
@@ -1658,10 +1769,39 @@ class ObjectMarker : AllStatic {
   static inline void set_needs_reset(bool v)  { _needs_reset = v; }
 };
 
+JvmtiHeapWalkBitMap* ObjectMarker::_bitmap = NULL;
+char* ObjectMarker::_bitmap_storage = NULL;
+size_t ObjectMarker::_bitmap_storage_size = 0;
 GrowableArray<oop>* ObjectMarker::_saved_oop_stack = NULL;
 GrowableArray<markOop>* ObjectMarker::_saved_mark_stack = NULL;
 bool ObjectMarker::_needs_reset = true;  // need to reset mark bits by default
 
+// Reserve and commit storage for a bitmap with one bit per word of the
+// heap's reserved region. Returns false if the reserved region is many
+// times larger than the usable heap, or if the memory is not available,
+// in which case the caller marks in the object headers instead.
+bool ObjectMarker::init_bitmap() {
+  MemRegion heap = Universe::heap()->reserved_region();
+  if (heap.byte_size() / 2 > Universe::heap()->max_capacity()) {
+    return false;
+  }
+  size_t size = MarkBitMap::compute_size(heap.byte_size());
+  char* storage = os::reserve_memory(size);
+  if (storage == NULL) {
+    return false;
+  }
+  if (!os::commit_memory(storage, size, !ExecMem)) {
+    os::release_memory(storage, size);
+    return false;
+  }
+  // freshly committed memory is zeroed so all bits start out clear
+  _bitmap = new JvmtiHeapWalkBitMap();
+  _bitmap->initialize(heap, MemRegion((HeapWord*)storage, size / HeapWordSize));
+  _bitmap_storage = storage;
+  _bitmap_storage_size = size;
+  return true;
+}
+
 // initialize ObjectMarker - prepares for object marking
 void ObjectMarker::init() {
   assert(Thread::current()->is_VM_thread(), "must be VMThread");
@@ -1669,6 +1809,11 @@ void ObjectMarker::init() {
   // prepare heap for iteration
   Universe::heap()->ensure_parsability(false);  // no need to retire TLABs
 
+  // prefer marking in a bitmap; fall back to the object headers
+  if (init_bitmap()) {
+    return;
+  }
+
   // create stacks for interesting headers
   _saved_mark_stack = new (ResourceObj::C_HEAP, mtInternal) GrowableArray<markOop>(4000, true);
   _saved_oop_stack = new (ResourceObj::C_HEAP, mtInternal) GrowableArray<oop>(4000, true);
@@ -1678,8 +1823,22 @@ void ObjectMarker::init() {
   }
 }
 
-// Object marking is done so restore object headers
+// Object marking is done so discard the bitmap or restore object headers
 void ObjectMarker::done() {
+  if (_bitmap != NULL) {
+    // the object headers were not disturbed - just discard the bitmap
+    delete _bitmap;
+    _bitmap = NULL;
+    os::release_memory(_bitmap_storage, _bitmap_storage_size);
+    _bitmap_storage = NULL;
+    _bitmap_storage_size = 0;
+
+    // restore the flag to its default in case a later walk has to mark
+    // in the object headers
+    set_needs_reset(true);
+    return;
+  }
+
   // iterate over all objects and restore the mark bits to
   // their initial value
   RestoreMarksClosure blk;
@@ -1710,7 +1869,12 @@ void ObjectMarker::done() {
 // mark an object
 inline void ObjectMarker::mark(oop o) {
   assert(Universe::heap()->is_in(o), "sanity check");
-  assert(!o->mark()->is_marked(), "should only mark an object once");
+  assert(!visited(o), "should only mark an object once");
+
+  if (_bitmap != NULL) {
+    _bitmap->mark((HeapWord*)o);
+    return;
+  }
 
   // object's mark word
   markOop mark = o->mark();
@@ -1726,6 +1890,9 @@ inline void ObjectMarker::mark(oop o) {
 
 // return true if object is marked
 inline bool ObjectMarker::visited(oop o) {
+  if (_bitmap != NULL) {
+    return _bitmap->is_marked(o);
+  }
   return o->mark()->is_marked();
 }
 
@@ -3310,6 +3477,26 @@ void JvmtiTagMap::follow_references(jint heap_filter,
 
 
 void JvmtiTagMap::weak_oops_do(BoolObjectClosure* is_alive, OopClosure* f) {
+  weak_oops_do_prologue();
+  weak_oops_do_parallel(is_alive, f);
+  weak_oops_do_epilogue(NULL, NULL);
+}
+
+void JvmtiTagMap::weak_oops_do_prologue() {
+  if (JvmtiEnv::environments_might_exist()) {
+    JvmtiEnvIterator it;
+    for (JvmtiEnvBase* env = it.first(); env != NULL; env = it.next(env)) {
+      JvmtiTagMap* tag_map = env->tag_map_acquire();
+      if (tag_map != NULL) {
+        assert(tag_map->_dead_entries == NULL && tag_map->_moved_entries == NULL,
+               "leftover entries from a previous sweep");
+        tag_map->_sweep_claim = 0;
+      }
+    }
+  }
+}
+
+void JvmtiTagMap::weak_oops_do_parallel(BoolObjectClosure* is_alive, OopClosure* f) {
   // No locks during VM bring-up (0 threads) and no safepoints after main
   // thread creation and before VMThread creation (1 thread); initial GC
   // verification can happen in that window which gets to here.
@@ -3327,98 +3514,165 @@ void JvmtiTagMap::weak_oops_do(BoolObjectClosure* is_alive, OopClosure* f) {
   }
 }
 
-void JvmtiTagMap::do_weak_oops(BoolObjectClosure* is_alive, OopClosure* f) {
+void JvmtiTagMap::weak_oops_do_epilogue(size_t* num_dead, size_t* num_total) {
+  size_t total_dead = 0;
+  size_t total_entries = 0;
+  if (JvmtiEnv::environments_might_exist()) {
+    JvmtiEnvIterator it;
+    for (JvmtiEnvBase* env = it.first(); env != NULL; env = it.next(env)) {
+      JvmtiTagMap* tag_map = env->tag_map_acquire();
+      if (tag_map != NULL) {
+        size_t dead = 0;
+        size_t total = 0;
+        tag_map->finish_weak_oops(&dead, &total);
+        total_dead += dead;
+        total_entries += total;
+      }
+    }
+  }
+  if (num_dead != NULL) {
+    *num_dead = total_dead;
+  }
+  if (num_total != NULL) {
+    *num_total = total_entries;
+  }
+}
 
-  // does this environment have the OBJECT_FREE event enabled
-  bool post_object_free = env()->is_enabled(JVMTI_EVENT_OBJECT_FREE);
+// push an unlinked entry onto one of the sweep lists. Several workers
+// may push onto the same list concurrently.
+static void add_to_sweep_list(JvmtiTagHashmapEntry* volatile* list,
+                              JvmtiTagHashmapEntry* entry) {
+  JvmtiTagHashmapEntry* head;
+  do {
+    head = Atomic::load(list);
+    entry->set_next(head);
+  } while (Atomic::cmpxchg(entry, list, head) != head);
+}
 
-  // counters used for trace message
-  int freed = 0;
-  int moved = 0;
+// Sweep pass over the entries of this tag map during GC. May be executed
+// by several GC workers at the same time; workers claim chunks of buckets
+// and unlink dead entries and entries whose bucket changed onto the sweep
+// lists, which finish_weak_oops() disposes of after all workers are done.
+void JvmtiTagMap::do_weak_oops(BoolObjectClosure* is_alive, OopClosure* f) {
+  // Number of buckets claimed at a time. Small enough to balance the load
+  // between the workers, large enough to keep the shared claim counter
+  // out of the hot loop.
+  const int chunk_size = 64;
 
   JvmtiTagHashmap* hashmap = this->hashmap();
-
-  // reenable sizing (if disabled)
-  hashmap->set_resizing_enabled(true);
-
-  // if the hashmap is empty then we can skip it
-  if (hashmap->_entry_count == 0) {
-    return;
-  }
-
-  // now iterate through each entry in the table
-
   JvmtiTagHashmapEntry** table = hashmap->table();
   int size = hashmap->size();
 
-  JvmtiTagHashmapEntry* delayed_add = NULL;
-
-  for (int pos = 0; pos < size; ++pos) {
-    JvmtiTagHashmapEntry* entry = table[pos];
-    JvmtiTagHashmapEntry* prev = NULL;
-
-    while (entry != NULL) {
-      JvmtiTagHashmapEntry* next = entry->next();
-
-      // has object been GC'ed
-      if (!is_alive->do_object_b(entry->object_peek())) {
-        // grab the tag
-        jlong tag = entry->tag();
-        guarantee(tag != 0, "checking");
+  for (;;) {
+    int chunk_start = (Atomic::add(1, &_sweep_claim) - 1) * chunk_size;
+    if (chunk_start >= size) {
+      return;
+    }
+    int chunk_end = MIN2(chunk_start + chunk_size, size);
 
-        // remove GC'ed entry from hashmap and return the
-        // entry to the free list
-        hashmap->remove(prev, pos, entry);
-        destroy_entry(entry);
+    for (int pos = chunk_start; pos < chunk_end; ++pos) {
+      JvmtiTagHashmapEntry* entry = table[pos];
+      JvmtiTagHashmapEntry* prev = NULL;
 
-        // post the event to the profiler
-        if (post_object_free) {
-          JvmtiExport::post_object_free(env(), tag);
-        }
-
-        ++freed;
-      } else {
-        f->do_oop(entry->object_addr());
-        oop new_oop = entry->object_peek();
+      while (entry != NULL) {
+        JvmtiTagHashmapEntry* next = entry->next();
 
-        // if the object has moved then re-hash it and move its
-        // entry to its new location.
-        unsigned int new_pos = JvmtiTagHashmap::hash(new_oop, size);
-        if (new_pos != (unsigned int)pos) {
+        // has object been GC'ed
+        if (!is_alive->do_object_b(entry->object_peek())) {
+          // unlink the entry and keep it for the epilogue, which posts
+          // the ObjectFree event and returns it to the free list
           if (prev == NULL) {
             table[pos] = next;
           } else {
             prev->set_next(next);
           }
-          if (new_pos < (unsigned int)pos) {
-            entry->set_next(table[new_pos]);
-            table[new_pos] = entry;
+          add_to_sweep_list(&_dead_entries, entry);
+        } else {
+          f->do_oop(entry->object_addr());
+          oop new_oop = entry->object_peek();
+
+          // if the object has moved then its entry belongs in another
+          // bucket. Unlink it and let the epilogue re-add it - the
+          // destination bucket may be owned by another worker right now.
+          unsigned int new_pos = JvmtiTagHashmap::hash(new_oop, size);
+          if (new_pos != (unsigned int)pos) {
+            if (prev == NULL) {
+              table[pos] = next;
+            } else {
+              prev->set_next(next);
+            }
+            add_to_sweep_list(&_moved_entries, entry);
           } else {
-            // Delay adding this entry to it's new position as we'd end up
-            // hitting it again during this iteration.
-            entry->set_next(delayed_add);
-            delayed_add = entry;
+            // object didn't move
+            prev = entry;
           }
-          moved++;
-        } else {
-          // object didn't move
-          prev = entry;
         }
-      }
 
-      entry = next;
+        entry = next;
+      }
     }
   }
+}
 
-  // Re-add all the entries which were kept aside
-  while (delayed_add != NULL) {
-    JvmtiTagHashmapEntry* next = delayed_add->next();
-    unsigned int pos = JvmtiTagHashmap::hash(delayed_add->object_peek(), size);
-    delayed_add->set_next(table[pos]);
-    table[pos] = delayed_add;
-    delayed_add = next;
+// Dispose of the entries collected by the sweep pass: re-add entries
+// whose object moved to their new bucket, post ObjectFree events for dead
+// entries and return them to the free list. Runs single-threaded after
+// all sweep workers have finished. Returns the number of dead entries and
+// the number of entries that were examined through the out arguments.
+void JvmtiTagMap::finish_weak_oops(size_t* num_dead, size_t* num_total) {
+  JvmtiTagHashmap* hashmap = this->hashmap();
+  JvmtiTagHashmapEntry** table = hashmap->table();
+  int size = hashmap->size();
+
+  // counters used for trace message
+  int freed = 0;
+  int moved = 0;
+
+  // does this environment have the OBJECT_FREE event enabled
+  bool post_object_free = env()->is_enabled(JVMTI_EVENT_OBJECT_FREE);
+
+  // re-add entries whose object was moved into another bucket
+  JvmtiTagHashmapEntry* entry = _moved_entries;
+  _moved_entries = NULL;
+  while (entry != NULL) {
+    JvmtiTagHashmapEntry* next = entry->next();
+    unsigned int pos = JvmtiTagHashmap::hash(entry->object_peek(), size);
+    entry->set_next(table[pos]);
+    table[pos] = entry;
+    entry = next;
+    moved++;
+  }
+
+  // free dead entries and post events to the profiler
+  entry = _dead_entries;
+  _dead_entries = NULL;
+  while (entry != NULL) {
+    JvmtiTagHashmapEntry* next = entry->next();
+
+    // grab the tag
+    jlong tag = entry->tag();
+    guarantee(tag != 0, "checking");
+
+    assert(hashmap->_entry_count > 0, "checking");
+    hashmap->_entry_count--;
+    destroy_entry(entry);
+
+    if (post_object_free) {
+      JvmtiExport::post_object_free(env(), tag);
+    }
+
+    entry = next;
+    freed++;
   }
 
-  log_debug(jvmti, objecttagging)("(%d->%d, %d freed, %d total moves)",
-                                  hashmap->_entry_count + freed, hashmap->_entry_count, freed, moved);
+  *num_dead = freed;
+  *num_total = hashmap->entry_count() + freed;
+
+  // reenable sizing (if disabled)
+  hashmap->set_resizing_enabled(true);
+
+  if (hashmap->entry_count() + freed > 0) {
+    log_debug(jvmti, objecttagging)("(%d->%d, %d freed, %d total moves)",
+                                    hashmap->_entry_count + freed, hashmap->_entry_count, freed, moved);
+  }
 }
@@ -51,6 +51,13 @@ class JvmtiTagMap :  public CHeapObj<mtInternal> {
   JvmtiTagHashmapEntry* _free_entries;              // free list for this environment
   int _free_entries_count;                          // number of entries on the free list
 
+  // State for the chunked weak oops sweep during GC. Workers claim chunks
+  // of buckets via _sweep_claim; entries they unlink are collected on the
+  // lists below and disposed of by finish_weak_oops().
+  volatile int _sweep_claim;                        // next bucket chunk to sweep
+  JvmtiTagHashmapEntry* volatile _dead_entries;     // unlinked dead entries
+  JvmtiTagHashmapEntry* volatile _moved_entries;    // live entries whose bucket changed
+
   // create a tag map
   JvmtiTagMap(JvmtiEnv* env);
 
@@ -59,6 +66,7 @@ class JvmtiTagMap :  public CHeapObj<mtInternal> {
   inline JvmtiEnv* env() const              { return _env; }
 
   void do_weak_oops(BoolObjectClosure* is_alive, OopClosure* f);
+  void finish_weak_oops(size_t* num_dead, size_t* num_total);
 
   // iterate over all entries in this tag map
   void entry_iterate(JvmtiTagHashmapEntryClosure* closure);
@@ -122,6 +130,19 @@ class JvmtiTagMap :  public CHeapObj<mtInternal> {
 
   static void weak_oops_do(
       BoolObjectClosure* is_alive, OopClosure* f) NOT_JVMTI_RETURN;
+
+  // Chunked form of weak_oops_do for use by parallel GC workers. The
+  // prologue is called once before the workers run, each worker then
+  // calls weak_oops_do_parallel and claims chunks of buckets until none
+  // remain, and the epilogue is called once afterwards to re-bucket moved
+  // entries, post ObjectFree events and free dead entries. The number of
+  // dead and of examined entries are returned through the epilogue
+  // arguments, which may be NULL.
+  static void weak_oops_do_prologue() NOT_JVMTI_RETURN;
+  static void weak_oops_do_parallel(
+      BoolObjectClosure* is_alive, OopClosure* f) NOT_JVMTI_RETURN;
+  static void weak_oops_do_epilogue(
+      size_t* num_dead, size_t* num_total) NOT_JVMTI_RETURN;
 };
 
 #endif // SHARE_PRIMS_JVMTITAGMAP_HPP
@@ -388,6 +388,19 @@ address NativeLookup::lookup_base(const methodHandle& method, bool& in_base_libr
 }
 
 
+// The per-Method resolved-entry cache is the has_native_function() check
+// below: a successful lookup is stored on the Method by
+// set_native_function() and every later call short-circuits here, so the
+// string building and multi-style dlsym probing in lookup_base() run once
+// per native method, lazily at its first invocation.  RegisterNatives
+// does not need a hashed side registry either -- it binds the supplied
+// function pointer straight onto the Method (jni.cpp), never entering
+// this path.  The bindings that do not survive are the intended ones:
+// class redefinition replaces the Method objects, and a JVMTI
+// NativeMethodBind agent may rewrite the entry, so caching resolutions
+// past those events would hand back stale or un-instrumented code.
+// Batching a whole class's natives would not help: the per-symbol dlsym
+// probe is the cost, and it is unavoidable per name.
 address NativeLookup::lookup(const methodHandle& method, bool& in_base_library, TRAPS) {
   if (!method->has_native_function()) {
     address entry = lookup_base(method, in_base_library, CHECK_NULL);
@@ -48,7 +48,11 @@ static const size_t END_SIZE = 24;
 // If a chain gets to 32 something might be wrong
 static const size_t GROW_HINT = 32;
 
-static const size_t ResolvedMethodTableSizeLog = 10;
+static size_t ceil_log2(size_t val) {
+  size_t ret;
+  for (ret = 1; ((size_t)1 << ret) < val; ++ret);
+  return ret;
+}
 
 unsigned int method_hash(const Method* method) {
   unsigned int name_hash = method->name()->identity_hash();
@@ -88,7 +92,7 @@ class ResolvedMethodTableConfig : public ResolvedMethodTableHash::BaseConfig {
 };
 
 static ResolvedMethodTableHash* _local_table           = NULL;
-static size_t                   _current_size          = (size_t)1 << ResolvedMethodTableSizeLog;
+static size_t                   _current_size          = 0;
 
 OopStorage*              ResolvedMethodTable::_weak_handles          = NULL;
 volatile bool            ResolvedMethodTable::_has_work              = false;
@@ -97,12 +101,14 @@ volatile size_t          _items_count           = 0;
 volatile size_t          _uncleaned_items_count = 0;
 
 void ResolvedMethodTable::create_table() {
-  _local_table  = new ResolvedMethodTableHash(ResolvedMethodTableSizeLog, END_SIZE, GROW_HINT);
+  size_t start_size_log_2 = ceil_log2(ResolvedMethodTableSize);
+  _current_size = ((size_t)1) << start_size_log_2;
+  _local_table  = new ResolvedMethodTableHash(start_size_log_2, END_SIZE, GROW_HINT);
   _weak_handles = new OopStorage("ResolvedMethodTable weak",
                                  ResolvedMethodTableWeakAlloc_lock,
                                  ResolvedMethodTableWeakActive_lock);
   log_trace(membername, table)("Start size: " SIZE_FORMAT " (" SIZE_FORMAT ")",
-                               _current_size, ResolvedMethodTableSizeLog);
+                               _current_size, start_size_log_2);
 }
 
 size_t ResolvedMethodTable::table_size() {
@@ -391,16 +391,32 @@ UNSAFE_ENTRY(void, Unsafe_SetMemory0(JNIEnv *env, jobject unsafe, jobject obj, j
   Copy::fill_to_memory_atomic(p, sz, value);
 } UNSAFE_END
 
-UNSAFE_ENTRY(void, Unsafe_CopyMemory0(JNIEnv *env, jobject unsafe, jobject srcObj, jlong srcOffset, jobject dstObj, jlong dstOffset, jlong size)) {
+// This function is a leaf since if the source and destination are both in native memory
+// the copy may potentially be very large, and we don't want to disable GC if we can avoid it.
+// If either source or destination (or both) are on the heap, the function will enter VM using
+// JVM_ENTRY_FROM_LEAF
+UNSAFE_LEAF(void, Unsafe_CopyMemory0(JNIEnv *env, jobject unsafe, jobject srcObj, jlong srcOffset, jobject dstObj, jlong dstOffset, jlong size)) {
   size_t sz = (size_t)size;
 
-  oop srcp = JNIHandles::resolve(srcObj);
-  oop dstp = JNIHandles::resolve(dstObj);
+  if (srcObj == NULL && dstObj == NULL) {
+    // Both src & dst are in native memory
+    void* src = addr_from_java(srcOffset);
+    void* dst = addr_from_java(dstOffset);
+
+    Copy::conjoint_memory_atomic(src, dst, sz);
+  } else {
+    // At least one of src/dst are on heap, transition to VM to access raw pointers
 
-  void* src = index_oop_from_field_offset_long(srcp, srcOffset);
-  void* dst = index_oop_from_field_offset_long(dstp, dstOffset);
+    JVM_ENTRY_FROM_LEAF(env, void, Unsafe_CopyMemory0) {
+      oop srcp = JNIHandles::resolve(srcObj);
+      oop dstp = JNIHandles::resolve(dstObj);
 
-  Copy::conjoint_memory_atomic(src, dst, sz);
+      void* src = index_oop_from_field_offset_long(srcp, srcOffset);
+      void* dst = index_oop_from_field_offset_long(dstp, dstOffset);
+
+      Copy::conjoint_memory_atomic(src, dst, sz);
+    } JVM_END
+  }
 } UNSAFE_END
 
 // This function is a leaf since if the source and destination are both in native memory
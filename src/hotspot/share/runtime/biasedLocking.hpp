@@ -106,6 +106,17 @@
 // the instance's bias pattern differs from the prototype header's and
 // causes the bias to be revoked without reaching a safepoint or,
 // again, a bulk heap sweep.
+//
+// A revocation-free replacement -- encoding the owning thread in the
+// mark word directly and keeping lock records purely thread-local, so
+// that neither revocation safepoints nor displaced-header CASes are
+// needed -- has been proposed more than once. It is not a local change
+// to this file: every mark word consumer (identity hash, GC age bits,
+// the displaced-header convention relied on by deoptimization and
+// inflation) and the lock fast paths emitted by the interpreter, C1
+// and C2 on every platform bake in the current encoding. Workloads
+// whose locks migrate between threads should run with
+// -XX:-UseBiasedLocking instead of waiting out revocations.
 
 // Biased locking counters
 class BiasedLockingCounters {
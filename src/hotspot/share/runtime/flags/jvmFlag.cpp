@@ -31,6 +31,7 @@
 #include "runtime/flags/jvmFlagWriteableList.hpp"
 #include "runtime/flags/jvmFlagRangeList.hpp"
 #include "runtime/globals_extension.hpp"
+#include "runtime/orderAccess.hpp"
 #include "utilities/defaultStream.hpp"
 #include "utilities/stringUtils.hpp"
 
@@ -888,15 +889,56 @@ static JVMFlag flagTable[] = {
 JVMFlag* JVMFlag::flags = flagTable;
 size_t JVMFlag::numFlags = (sizeof(flagTable) / sizeof(JVMFlag));
 
-inline bool str_equal(const char* s, size_t s_len, const char* q, size_t q_len) {
-  if (s_len != q_len) return false;
-  return memcmp(s, q, q_len) == 0;
+extern "C" {
+  static int compare_flags_by_name(const void* void_a, const void* void_b) {
+    return strcmp((*((JVMFlag**) void_a))->_name, (*((JVMFlag**) void_b))->_name);
+  }
+}
+
+// Name-sorted index over flagTable, so lookups can binary search instead
+// of scanning the whole table.  Normally the index is built by the first
+// lookup during single-threaded argument parsing and is read-only from
+// then on; the acquire/release pair makes a late first build safe for
+// concurrent lookers-up (jcmd, JFR, management API) as well, at worst
+// leaking one losing copy.
+static JVMFlag** volatile sorted_flag_index = NULL;
+
+static JVMFlag** get_sorted_flag_index() {
+  JVMFlag** index = OrderAccess::load_acquire(&sorted_flag_index);
+  if (index == NULL) {
+    // The last entry is the null entry.
+    const size_t length = JVMFlag::numFlags - 1;
+    JVMFlag** array = NEW_C_HEAP_ARRAY(JVMFlag*, length, mtArguments);
+    for (size_t i = 0; i < length; i++) {
+      array[i] = &flagTable[i];
+    }
+    qsort(array, length, sizeof(JVMFlag*), compare_flags_by_name);
+    OrderAccess::release_store(&sorted_flag_index, array);
+    index = array;
+  }
+  return index;
 }
 
 // Search the flag table for a named flag
 JVMFlag* JVMFlag::find_flag(const char* name, size_t length, bool allow_locked, bool return_flag) {
-  for (JVMFlag* current = &flagTable[0]; current->_name != NULL; current++) {
-    if (str_equal(current->_name, current->get_name_length(), name, length)) {
+  JVMFlag** index = get_sorted_flag_index();
+  size_t lo = 0;
+  size_t hi = numFlags - 1;  // exclude the null entry
+  while (lo < hi) {
+    const size_t mid = lo + ((hi - lo) >> 1);
+    JVMFlag* current = index[mid];
+    const size_t current_length = current->get_name_length();
+    // strcmp-style comparison of the (name, length) query against the
+    // NUL-terminated table entry
+    int cmp = memcmp(name, current->_name, MIN2(length, current_length));
+    if (cmp == 0 && length != current_length) {
+      cmp = (length < current_length) ? -1 : 1;
+    }
+    if (cmp < 0) {
+      hi = mid;
+    } else if (cmp > 0) {
+      lo = mid + 1;
+    } else {
       // Found a matching entry.
       // Don't report notproduct and develop flags in product builds.
       if (current->is_constant_in_binary()) {
@@ -373,6 +373,10 @@ const size_t minimumSymbolTableSize = 1024;
   diagnostic(bool, UseVectorizedMismatchIntrinsic, false,                   \
           "Enables intrinsification of ArraysSupport.vectorizedMismatch()") \
                                                                             \
+  diagnostic(bool, UseStringHashCodeIntrinsic, false,                       \
+          "Enables intrinsification of StringLatin1.hashCode() and "        \
+          "StringUTF16.hashCode()")                                         \
+                                                                            \
   diagnostic(ccstrlist, DisableIntrinsic, "",                               \
          "do not expand intrinsics whose (internal) names appear here")     \
                                                                             \
@@ -466,6 +470,12 @@ const size_t minimumSymbolTableSize = 1024;
   develop(bool, UseMallocOnly, false,                                       \
           "Use only malloc/free for allocation (no resource area/arena)")   \
                                                                             \
+  product(uintx, ResourceAreaRetainedSize, 0,                               \
+          "Maximum number of bytes of grown resource area chunks to "       \
+          "retain per thread across resource marks for reuse "              \
+          "(0 means free retired chunks eagerly)")                          \
+          range(0, max_uintx)                                               \
+                                                                            \
   develop(bool, PrintMallocStatistics, false,                               \
           "Print malloc/free statistics")                                   \
                                                                             \
@@ -806,6 +816,12 @@ const size_t minimumSymbolTableSize = 1024;
   product(bool, CompactFields, true,                                        \
           "Allocate nonstatic fields in gaps between previous fields")      \
                                                                             \
+  experimental(ccstr, FieldLayoutHintsFile, NULL,                           \
+          "File listing hot fields as \"class field\" pairs, one per "      \
+          "line with the class in internal form; hinted fields are "        \
+          "allocated before unhinted ones within their size class when "    \
+          "the declaring class is laid out")                                \
+                                                                            \
   notproduct(bool, PrintFieldLayout, false,                                 \
           "Print field layout for each class")                              \
                                                                             \
@@ -1171,6 +1187,16 @@ const size_t minimumSymbolTableSize = 1024;
   product(bool, DisplayVMOutputToStdout, false,                             \
           "If DisplayVMOutput is true, display all VM output to stdout")    \
                                                                             \
+  product(bool, AsyncLogging, false,                                        \
+          "Write unified logging file output from a dedicated thread "      \
+          "instead of the logging thread")                                  \
+                                                                            \
+  product(size_t, AsyncLogBufferSize, 2*M,                                  \
+          "Memory budget, in bytes, for buffering asynchronous log "        \
+          "messages; messages arriving while the buffer is exhausted "      \
+          "are dropped")                                                    \
+          range(1*K, max_uintx)                                             \
+                                                                            \
   product(bool, ErrorFileToStderr, false,                                   \
           "If true, error data is printed to stderr instead of a file")     \
                                                                             \
@@ -2092,6 +2118,18 @@ const size_t minimumSymbolTableSize = 1024;
           "Back edge threshold at which tier 4 OSR compilation is invoked") \
           range(0, max_jint)                                                \
                                                                             \
+  product(intx, Tier4RecompilationBackoff, 2,                               \
+          "Tier 4 thresholds double with each decompilation of a method "   \
+          "beyond this count (0 turns the backoff off)")                    \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(intx, Tier4RecompilationBudget, 50000,                            \
+          "Total number of bytecodes worth of tier 4 recompilation a "      \
+          "single method may consume (decompile count times method size) "  \
+          "before it settles at a tier 1 compilation level "                \
+          "(0 turns the budget off)")                                       \
+          range(0, max_jint)                                                \
+                                                                            \
   product(intx, Tier3DelayOn, 5,                                            \
           "If C2 queue size grows over this amount per compiler thread "    \
           "stop compiling at tier 3 and start compiling at tier 2")         \
@@ -2287,6 +2325,12 @@ const size_t minimumSymbolTableSize = 1024;
   diagnostic(bool, AllowArchivingWithJavaAgent, false,                      \
           "Allow Java agent to be run with CDS dumping")                    \
                                                                             \
+  diagnostic(ccstr, ExtraArchiveSubgraphEntryFields, NULL,                  \
+          "Comma-separated list of additional static fields "               \
+          "(<class>.<field>, class names in slash form, boot classes "      \
+          "only) whose object sub-graphs are archived in the open "         \
+          "archive heap region at CDS dump time")                           \
+                                                                            \
   diagnostic(bool, PrintMethodHandleStubs, false,                           \
           "Print generated stub code for method handles")                   \
                                                                             \
@@ -2351,6 +2395,10 @@ const size_t minimumSymbolTableSize = 1024;
           "Number of buckets in the JVM internal Symbol table")             \
           range(minimumSymbolTableSize, 111*defaultSymbolTableSize)         \
                                                                             \
+  experimental(uintx, ResolvedMethodTableSize, 1024,                        \
+          "Number of buckets in the JVM internal ResolvedMethod table")     \
+          range(128, 16777216ul)                                            \
+                                                                            \
   product(bool, UseStringDeduplication, false,                              \
           "Use string deduplication")                                       \
                                                                             \
@@ -2460,6 +2508,19 @@ const size_t minimumSymbolTableSize = 1024;
   JFR_ONLY(product(ccstr, StartFlightRecording, NULL,                       \
           "Start flight recording with options"))                           \
                                                                             \
+  JFR_ONLY(diagnostic(ccstr, JfrStreamRingFile, NULL,                       \
+          "Path to a memory-mapped file through which flushed JFR "         \
+          "buffers are published to a same-host consumer"))                 \
+                                                                            \
+  JFR_ONLY(diagnostic(size_t, JfrStreamRingSize, 8*M,                       \
+          "Capacity in bytes of the memory-mapped JFR stream ring "         \
+          "buffer"))                                                        \
+                                                                            \
+  JFR_ONLY(diagnostic(uintx, JfrPathToGcRootsSliceMillis, 0,                \
+          "Maximum time in milliseconds a single safepoint may spend "      \
+          "reconstructing reference chains for OldObjectSample events "     \
+          "(0 means the reconstruction runs in one safepoint)"))            \
+                                                                            \
   experimental(bool, UseFastUnorderedTimeStamps, false,                     \
           "Use platform unstable time where supported for timestamps only")
 
@@ -26,6 +26,7 @@
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/orderAccess.hpp"
@@ -38,9 +39,20 @@
 #include "utilities/formatBuffer.hpp"
 #include "utilities/preserveException.hpp"
 
-class HandshakeOperation: public StackObj {
+// Operations are queued per target JavaThread and linked through _next, so
+// each target needs its own operation instance. Synchronous operations are
+// resource or stack allocated by the requester, which waits for completion;
+// asynchronous operations are heap allocated and deleted by whoever drained
+// them from the target's queue.
+class HandshakeOperation: public ResourceObj {
+  HandshakeOperation* _next;
 public:
+  HandshakeOperation() : _next(NULL) {}
+  virtual ~HandshakeOperation() {}
   virtual void do_handshake(JavaThread* thread) = 0;
+  virtual bool is_async() const { return false; }
+  HandshakeOperation* next() const { return _next; }
+  void set_next(HandshakeOperation* op) { _next = op; }
 };
 
 class HandshakeThreadsOperation: public HandshakeOperation {
@@ -50,10 +62,10 @@ class HandshakeThreadsOperation: public HandshakeOperation {
 public:
   HandshakeThreadsOperation(ThreadClosure* cl) : _thread_cl(cl) {}
   void do_handshake(JavaThread* thread);
-  bool thread_has_completed() { return _done.trywait(); }
+  static bool thread_has_completed() { return _done.trywait(); }
 
 #ifdef ASSERT
-  void check_state() {
+  static void check_state() {
     assert(!_done.trywait(), "Must be zero");
   }
 #endif
@@ -61,6 +73,21 @@ public:
 
 Semaphore HandshakeThreadsOperation::_done(0);
 
+// An asynchronous operation owns its closure and has no requester to signal:
+// do_handshake reports completion to the closure itself and the operation is
+// deleted by the thread that drained it from the queue, or cancelled if the
+// target exits with the operation still pending.
+class AsyncHandshakeOperation: public HandshakeOperation {
+  AsyncHandshakeClosure* _closure;
+
+public:
+  AsyncHandshakeOperation(AsyncHandshakeClosure* cl) : _closure(cl) {}
+  virtual ~AsyncHandshakeOperation() { delete _closure; }
+  bool is_async() const { return true; }
+  void cancel() { _closure->completed(false); }
+  void do_handshake(JavaThread* thread);
+};
+
 class VM_Handshake: public VM_Operation {
   const jlong _handshake_timeout;
  public:
@@ -69,19 +96,13 @@ class VM_Handshake: public VM_Operation {
   bool evaluate_concurrently() const { return false; }
 
  protected:
-  HandshakeThreadsOperation* const _op;
-
-  VM_Handshake(HandshakeThreadsOperation* op) :
-      _handshake_timeout(TimeHelper::millis_to_counter(HandshakeTimeout)), _op(op) {}
-
-  void set_handshake(JavaThread* target) {
-    target->set_handshake_operation(_op);
-  }
+  VM_Handshake() :
+      _handshake_timeout(TimeHelper::millis_to_counter(HandshakeTimeout)) {}
 
   // This method returns true for threads completed their operation
   // and true for threads canceled their operation.
   // A cancellation can happen if the thread is exiting.
-  bool poll_for_completed_thread() { return _op->thread_has_completed(); }
+  bool poll_for_completed_thread() { return HandshakeThreadsOperation::thread_has_completed(); }
 
   bool handshake_has_timed_out(jlong start_time);
   static void handle_timeout();
@@ -108,19 +129,20 @@ void VM_Handshake::handle_timeout() {
 }
 
 class VM_HandshakeOneThread: public VM_Handshake {
+  HandshakeThreadsOperation* const _op;
   JavaThread* _target;
   bool _thread_alive;
  public:
   VM_HandshakeOneThread(HandshakeThreadsOperation* op, JavaThread* target) :
-    VM_Handshake(op), _target(target), _thread_alive(false) {}
+    _op(op), _target(target), _thread_alive(false) {}
 
   void doit() {
-    DEBUG_ONLY(_op->check_state();)
+    DEBUG_ONLY(HandshakeThreadsOperation::check_state();)
     TraceTime timer("Performing single-target operation (vmoperation doit)", TRACETIME_LOG(Info, handshake));
 
     ThreadsListHandle tlh;
     if (tlh.includes(_target)) {
-      set_handshake(_target);
+      _target->set_handshake_operation(_op);
       _thread_alive = true;
     } else {
       return;
@@ -141,7 +163,7 @@ class VM_HandshakeOneThread: public VM_Handshake {
         _target->handshake_process_by_vmthread();
       }
     } while (!poll_for_completed_thread());
-    DEBUG_ONLY(_op->check_state();)
+    DEBUG_ONLY(HandshakeThreadsOperation::check_state();)
   }
 
   VMOp_Type type() const { return VMOp_HandshakeOneThread; }
@@ -150,17 +172,21 @@ class VM_HandshakeOneThread: public VM_Handshake {
 };
 
 class VM_HandshakeAllThreads: public VM_Handshake {
+  ThreadClosure* _thread_cl;
  public:
-  VM_HandshakeAllThreads(HandshakeThreadsOperation* op) : VM_Handshake(op) {}
+  VM_HandshakeAllThreads(ThreadClosure* cl) : _thread_cl(cl) {}
 
   void doit() {
-    DEBUG_ONLY(_op->check_state();)
+    DEBUG_ONLY(HandshakeThreadsOperation::check_state();)
     TraceTime timer("Performing operation (vmoperation doit)", TRACETIME_LOG(Info, handshake));
 
+    // Each target thread queues its own operation instance; they share the
+    // closure and live in the resource area until all threads have completed.
+    ResourceMark rm;
     JavaThreadIteratorWithHandle jtiwh;
     int number_of_threads_issued = 0;
     for (JavaThread *thr = jtiwh.next(); thr != NULL; thr = jtiwh.next()) {
-      set_handshake(thr);
+      thr->set_handshake_operation(new HandshakeThreadsOperation(_thread_cl));
       number_of_threads_issued++;
     }
 
@@ -201,7 +227,7 @@ class VM_HandshakeAllThreads: public VM_Handshake {
 
     } while (number_of_threads_issued > number_of_threads_completed);
     assert(number_of_threads_issued == number_of_threads_completed, "Must be the same");
-    DEBUG_ONLY(_op->check_state();)
+    DEBUG_ONLY(HandshakeThreadsOperation::check_state();)
   }
 
   VMOp_Type type() const { return VMOp_HandshakeAllThreads; }
@@ -248,10 +274,20 @@ void HandshakeThreadsOperation::do_handshake(JavaThread* thread) {
   _done.signal();
 }
 
+void AsyncHandshakeOperation::do_handshake(JavaThread* thread) {
+  // Only actually execute the operation for non terminated threads.
+  bool executed = false;
+  if (!thread->is_terminated()) {
+    _closure->do_thread(thread);
+    executed = true;
+  }
+  // There is no requester to signal; report completion to the closure.
+  _closure->completed(executed);
+}
+
 void Handshake::execute(ThreadClosure* thread_cl) {
   if (ThreadLocalHandshakes) {
-    HandshakeThreadsOperation cto(thread_cl);
-    VM_HandshakeAllThreads handshake(&cto);
+    VM_HandshakeAllThreads handshake(thread_cl);
     VMThread::execute(&handshake);
   } else {
     VM_HandshakeFallbackOperation op(thread_cl);
@@ -272,16 +308,89 @@ bool Handshake::execute(ThreadClosure* thread_cl, JavaThread* target) {
   }
 }
 
-HandshakeState::HandshakeState() : _operation(NULL), _semaphore(1), _thread_in_process_handshake(false) {}
+void Handshake::execute_async(AsyncHandshakeClosure* cl, JavaThread* target) {
+  if (!ThreadLocalHandshakes) {
+    // Without thread-local polls there is no per-thread queue to post to;
+    // degrade to executing the closure at a safepoint like the synchronous
+    // paths do.
+    class FallbackThreadClosure : public ThreadClosure {
+      AsyncHandshakeClosure* _cl;
+     public:
+      FallbackThreadClosure(AsyncHandshakeClosure* cl) : _cl(cl) {}
+      void do_thread(Thread* thread) { _cl->do_thread((JavaThread*)thread); }
+    } fallback_cl(cl);
+    VM_HandshakeFallbackOperation op(&fallback_cl, target);
+    VMThread::execute(&op);
+    cl->completed(op.thread_alive());
+    delete cl;
+    return;
+  }
+
+  AsyncHandshakeOperation* op = new (ResourceObj::C_HEAP, mtThread) AsyncHandshakeOperation(cl);
+  ThreadsListHandle tlh;
+  if (tlh.includes(target)) {
+    target->set_handshake_operation(op);
+  } else {
+    // Target has already exited; cancel without running the closure.
+    op->cancel();
+    delete op;
+  }
+}
+
+HandshakeState::HandshakeState() : _queue(NULL), _semaphore(1), _thread_in_process_handshake(false) {}
+
+HandshakeState::~HandshakeState() {
+  // The owning thread is gone, so no other thread can reference it to post
+  // new operations and nobody is processing. Synchronous operations always
+  // complete before their target can exit, so anything left in the queue is
+  // asynchronous and is cancelled without running its closure.
+  HandshakeOperation* op = _queue;
+  _queue = NULL;
+  while (op != NULL) {
+    HandshakeOperation* next = op->next();
+    assert(op->is_async(), "a synchronous handshake cannot outlive its target");
+    ((AsyncHandshakeOperation*)op)->cancel();
+    delete op;
+    op = next;
+  }
+}
 
 void HandshakeState::set_operation(JavaThread* target, HandshakeOperation* op) {
-  _operation = op;
+  // Both the VM thread (synchronous handshakes) and requesting threads
+  // (asynchronous handshakes) post here, so link the operation with a CAS.
+  HandshakeOperation* head;
+  do {
+    head = _queue;
+    op->set_next(head);
+  } while (Atomic::cmpxchg(op, &_queue, head) != head);
   SafepointMechanism::arm_local_poll_release(target);
 }
 
+HandshakeOperation* HandshakeState::claim_pending_operations() {
+  // Called while holding the semaphore. Detach the whole queue and reverse
+  // it so the operations execute in the order they were posted.
+  HandshakeOperation* list = Atomic::xchg((HandshakeOperation*)NULL, &_queue);
+  HandshakeOperation* ops = NULL;
+  while (list != NULL) {
+    HandshakeOperation* next = list->next();
+    list->set_next(ops);
+    ops = list;
+    list = next;
+  }
+  return ops;
+}
+
 void HandshakeState::clear_handshake(JavaThread* target) {
-  _operation = NULL;
-  SafepointMechanism::disarm_if_needed(target, true /* release */);
+  // Only disarm if no new operation was posted since the queue was claimed.
+  // A poster arms the poll after linking its operation, so re-checking the
+  // queue after disarming cannot lose a wakeup.
+  if (_queue == NULL) {
+    SafepointMechanism::disarm_if_needed(target, true /* release */);
+    OrderAccess::fence();
+    if (_queue != NULL) {
+      SafepointMechanism::arm_local_poll_release(target);
+    }
+  }
 }
 
 void HandshakeState::process_self_inner(JavaThread* thread) {
@@ -292,13 +401,26 @@ void HandshakeState::process_self_inner(JavaThread* thread) {
   if (!_semaphore.trywait()) {
     _semaphore.wait_with_safepoint_check(thread);
   }
-  HandshakeOperation* op = OrderAccess::load_acquire(&_operation);
+  HandshakeOperation* op = claim_pending_operations();
   if (op != NULL) {
     HandleMark hm(thread);
     CautiouslyPreserveExceptionMark pem(thread);
-    // Disarm before execute the operation
+    // Disarm before executing the operations
     clear_handshake(thread);
-    op->do_handshake(thread);
+    while (op != NULL) {
+      HandshakeOperation* next = op->next();
+      // A synchronous operation lives on the requester's stack, and its
+      // do_handshake signals the requester on completion. The requester's
+      // frame can unwind the moment that happens, so read everything
+      // needed from the operation first and make do_handshake the last
+      // access to a synchronous one.
+      bool async = op->is_async();
+      op->do_handshake(thread);
+      if (async) {
+        delete op;
+      }
+      op = next;
+    }
   }
   _semaphore.signal();
 }
@@ -369,8 +491,20 @@ void HandshakeState::process_by_vmthread(JavaThread* target) {
   // getting caught by the semaphore.
   if (vmthread_can_process_handshake(target)) {
     guarantee(!_semaphore.trywait(), "we should already own the semaphore");
-    _operation->do_handshake(target);
-    // Disarm after VM thread have executed the operation.
+    HandshakeOperation* op = claim_pending_operations();
+    while (op != NULL) {
+      HandshakeOperation* next = op->next();
+      // As in process_self_inner: a synchronous operation may be destroyed
+      // by the unblocked requester once do_handshake signals completion,
+      // so it must not be touched afterwards.
+      bool async = op->is_async();
+      op->do_handshake(target);
+      if (async) {
+        delete op;
+      }
+      op = next;
+    }
+    // Disarm after VM thread have executed the operations.
     clear_handshake(target);
     // Release the thread
   }
@@ -29,8 +29,9 @@
 #include "runtime/flags/flagSetting.hpp"
 #include "runtime/semaphore.hpp"
 
-class ThreadClosure;
+class AsyncHandshakeClosure;
 class JavaThread;
+class ThreadClosure;
 
 // A handshake operation is a callback that is executed for each JavaThread
 // while that thread is in a safepoint safe state. The callback is executed
@@ -42,20 +43,41 @@ class Handshake : public AllStatic {
   // Execution of handshake operation
   static void execute(ThreadClosure* thread_cl);
   static bool execute(ThreadClosure* thread_cl, JavaThread* target);
+  static void execute_async(AsyncHandshakeClosure* cl, JavaThread* target);
+};
+
+// An asynchronous handshake closure is heap allocated and handed over to the
+// handshake framework by Handshake::execute_async; the requester does not
+// wait. The closure is executed by the target thread at its next poll
+// transition, or by the VM thread on the target's behalf while the target is
+// blocked during a later handshake. Multiple pending closures are executed
+// in one poll transition, in posting order. completed() is invoked after
+// do_thread has run, or with executed == false if the target exited first,
+// after which the closure is deleted by the framework.
+class AsyncHandshakeClosure : public CHeapObj<mtThread> {
+ public:
+  virtual ~AsyncHandshakeClosure() {}
+  virtual void do_thread(JavaThread* thread) = 0;
+  virtual void completed(bool executed) {}
 };
 
 class HandshakeOperation;
 
-// The HandshakeState keep tracks of an ongoing handshake for one JavaThread.
-// VM thread and JavaThread are serialized with the semaphore making sure
-// the operation is only done by either VM thread on behalf of the JavaThread
-// or the JavaThread itself.
+// The HandshakeState keeps track of the pending handshake operations for one
+// JavaThread. Several operations may be pending at the same time; they are
+// queued and all of them are executed in one poll transition. VM thread and
+// JavaThread are serialized with the semaphore making sure the queue is only
+// drained by either VM thread on behalf of the JavaThread or the JavaThread
+// itself.
 class HandshakeState {
-  HandshakeOperation* volatile _operation;
+  // Lock-free stack of pending operations. Operations are pushed with a CAS
+  // and detached wholesale by the processing side under the semaphore.
+  HandshakeOperation* volatile _queue;
 
   Semaphore _semaphore;
   bool _thread_in_process_handshake;
 
+  HandshakeOperation* claim_pending_operations();
   bool claim_handshake_for_vmthread();
   bool vmthread_can_process_handshake(JavaThread* target);
 
@@ -64,11 +86,12 @@ class HandshakeState {
   void process_self_inner(JavaThread* thread);
 public:
   HandshakeState();
+  ~HandshakeState();
 
   void set_operation(JavaThread* thread, HandshakeOperation* op);
 
   bool has_operation() const {
-    return _operation != NULL;
+    return _queue != NULL;
   }
 
   void process_by_self(JavaThread* thread) {
@@ -64,6 +64,7 @@ void VM_Version_init();
 void os_init_globals();        // depends on VM_Version_init, before universe_init
 void stubRoutines_init1();
 jint universe_init();          // depends on codeCache_init and stubRoutines_init
+void fieldLayoutHints_init();  // needs the symbol table, before any class is laid out
 // depends on universe_init, must be before interpreter_init (currently only on SPARC)
 void gc_barrier_stubs_init();
 void interpreter_init();       // before any methods loaded
@@ -119,6 +120,7 @@ jint init_globals() {
   if (status != JNI_OK)
     return status;
 
+  fieldLayoutHints_init();   // depends on universe_init, before any class is laid out
   gc_barrier_stubs_init();   // depends on universe_init, must be before interpreter_init
   interpreter_init();        // before any methods loaded
   invocationCounter_init();  // before any methods loaded
@@ -449,6 +449,32 @@ void JNIHandleBlock::release_block(JNIHandleBlock* block, Thread* thread) {
 }
 
 
+void JNIHandleMark::push_jni_handle_block(Thread* thread) {
+  if (thread != NULL) {
+    // Allocate a new block for JNI handles.
+    // Inlined code from jni_PushLocalFrame()
+    JNIHandleBlock* prev_handles = thread->active_handles();
+    JNIHandleBlock* entry_handles = JNIHandleBlock::allocate_block(thread);
+    assert(entry_handles != NULL && prev_handles != NULL, "should not be NULL");
+    entry_handles->set_pop_frame_link(prev_handles);  // make sure prev handles get gc'd.
+    thread->set_active_handles(entry_handles);
+  }
+}
+
+
+void JNIHandleMark::pop_jni_handle_block(Thread* thread) {
+  if (thread != NULL) {
+    // Release our JNI handle block
+    JNIHandleBlock* entry_handles = thread->active_handles();
+    JNIHandleBlock* prev_handles = entry_handles->pop_frame_link();
+    // restore
+    thread->set_active_handles(prev_handles);
+    entry_handles->set_pop_frame_link(NULL);
+    JNIHandleBlock::release_block(entry_handles, thread);  // may block
+  }
+}
+
+
 void JNIHandleBlock::oops_do(OopClosure* f) {
   JNIHandleBlock* current_chain = this;
   // Iterate over chain of blocks, followed by chains linked through the
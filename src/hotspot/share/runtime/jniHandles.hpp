@@ -206,4 +206,21 @@ class JNIHandleBlock : public CHeapObj<mtInternal> {
   #endif
 };
 
+// A JNIHandleMark installs a fresh block of JNI handles for a scope of
+// native code that creates many local handles, and bulk-releases the whole
+// block chain when the scope exits instead of letting the handles live
+// until the enclosing native frame returns. The blocks come from and are
+// returned to the owning thread's free list, so steady state use takes no
+// locks.
+class JNIHandleMark : public StackObj {
+  Thread* _thread;
+ public:
+  JNIHandleMark(Thread* thread) : _thread(thread) { push_jni_handle_block(thread); }
+  ~JNIHandleMark() { pop_jni_handle_block(_thread); }
+
+ private:
+  static void push_jni_handle_block(Thread* thread);
+  static void pop_jni_handle_block(Thread* thread);
+};
+
 #endif // SHARE_RUNTIME_JNIHANDLES_HPP
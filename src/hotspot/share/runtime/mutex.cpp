@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "logging/log.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/osThread.hpp"
@@ -60,6 +61,7 @@ void Monitor::lock(Thread * self) {
   DEBUG_ONLY(int retry_cnt = 0;)
   while (!_lock.try_lock()) {
     // The lock is contended
+    Atomic::inc(&_contended_count);
 
   #ifdef ASSERT
     check_block_state(self);
@@ -101,7 +103,11 @@ void Monitor::lock() {
 void Monitor::lock_without_safepoint_check(Thread * self) {
   check_safepoint_state(self, false);
   assert(_owner != self, "invariant");
-  _lock.lock();
+  if (!_lock.try_lock()) {
+    // The lock is contended
+    Atomic::inc(&_contended_count);
+    _lock.lock();
+  }
   assert_owner(NULL);
   set_owner(self);
 }
@@ -262,6 +268,7 @@ Monitor::~Monitor() {
 
 void Monitor::ClearMonitor(Monitor * m, const char *name) {
   m->_owner             = NULL;
+  m->_contended_count   = 0;
   if (name == NULL) {
     strcpy(m->_name, "UNKNOWN");
   } else {
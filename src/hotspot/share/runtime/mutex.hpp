@@ -77,6 +77,7 @@ class Monitor : public CHeapObj<mtSynchronizer> {
   Thread * volatile _owner;              // The owner of the lock
   os::PlatformMonitor _lock;             // Native monitor implementation
   char _name[MONITOR_NAME_LEN];          // Name of mutex/monitor
+  volatile intx _contended_count;        // Number of contended acquisitions (approximate)
 
   // Debugging fields for naming, deadlock detection, etc. (some only used in debug mode)
 #ifndef PRODUCT
@@ -184,6 +185,10 @@ class Monitor : public CHeapObj<mtSynchronizer> {
   void jvm_raw_unlock();
   const char *name() const                  { return _name; }
 
+  // Number of acquisitions that found the lock held and had to block.
+  // Updated without synchronization, so the count is approximate.
+  intx contended_count() const              { return _contended_count; }
+
   void print_on_error(outputStream* st) const;
 
   #ifndef PRODUCT
@@ -129,6 +129,7 @@ Monitor* RootRegionScan_lock          = NULL;
 Monitor* GCTaskManager_lock           = NULL;
 
 Mutex*   Management_lock              = NULL;
+Mutex*   DCmdAsyncJobs_lock           = NULL;
 Monitor* Service_lock                 = NULL;
 Monitor* PeriodicTask_lock            = NULL;
 Monitor* RedefineClasses_lock         = NULL;
@@ -252,6 +253,10 @@ void mutex_init() {
     def(StringDedupQueue_lock      , PaddedMonitor, leaf,        true,  Monitor::_safepoint_check_never);
     def(StringDedupTable_lock      , PaddedMutex  , leaf,        true,  Monitor::_safepoint_check_never);
   }
+  if (UseParallelGC) {
+    def(StringDedupQueue_lock      , PaddedMonitor, leaf,        true,  Monitor::_safepoint_check_never);
+    def(StringDedupTable_lock      , PaddedMutex  , leaf,        true,  Monitor::_safepoint_check_never);
+  }
   def(ParGCRareEvent_lock          , PaddedMutex  , leaf     ,   true,  Monitor::_safepoint_check_always);
   def(CGCPhaseManager_lock         , PaddedMonitor, leaf,        false, Monitor::_safepoint_check_always);
   def(CodeCache_lock               , PaddedMutex  , special,     true,  Monitor::_safepoint_check_never);
@@ -320,6 +325,7 @@ void mutex_init() {
 
   def(JvmtiThreadState_lock        , PaddedMutex  , nonleaf+2,   false, Monitor::_safepoint_check_always); // Used by JvmtiThreadState/JvmtiEventController
   def(Management_lock              , PaddedMutex  , nonleaf+2,   false, Monitor::_safepoint_check_always); // used for JVM management
+  def(DCmdAsyncJobs_lock           , PaddedMutex  , leaf,        true,  Monitor::_safepoint_check_never);  // protects the list of asynchronous diagnostic command jobs
 
   def(Compile_lock                 , PaddedMutex  , nonleaf+3,   true,  Monitor::_safepoint_check_always);
   def(MethodData_lock              , PaddedMutex  , nonleaf+3,   false, Monitor::_safepoint_check_always);
@@ -399,3 +405,18 @@ void print_owned_locks_on_error(outputStream* st) {
   }
   if (none) st->print_cr("None");
 }
+
+// Print the contended acquisition count of every named mutex/monitor that
+// has seen contention; called by the VM.native_lock_stats diagnostic command.
+void print_lock_contention_counts(outputStream* st) {
+  st->print_cr("Contended VM mutex/monitor acquisitions since VM start:");
+  bool none = true;
+  for (int i = 0; i < _num_mutex; i++) {
+    intx count = _mutex_array[i]->contended_count();
+    if (count > 0) {
+      st->print_cr(INTX_FORMAT_W(12) "  %s", count, _mutex_array[i]->name());
+      none = false;
+    }
+  }
+  if (none) st->print_cr("None");
+}
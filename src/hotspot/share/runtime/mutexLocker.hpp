@@ -124,6 +124,7 @@ extern Mutex*   OldSets_lock;                    // protects the old region sets
 extern Monitor* RootRegionScan_lock;             // used to notify that the CM threads have finished scanning the IM snapshot regions
 
 extern Mutex*   Management_lock;                 // a lock used to serialize JVM management
+extern Mutex*   DCmdAsyncJobs_lock;              // protects the list of asynchronous diagnostic command jobs
 extern Monitor* Service_lock;                    // a lock used for service thread operation
 extern Monitor* PeriodicTask_lock;               // protects the periodic task structure
 extern Monitor* RedefineClasses_lock;            // locks classes from parallel redefinition
@@ -182,6 +183,10 @@ extern Mutex*   JVMCIGlobalActive_lock;          // JVMCI global storage active
 // by fatal error handler.
 void print_owned_locks_on_error(outputStream* st);
 
+// Print per-lock contention counts; called by the VM.native_lock_stats
+// diagnostic command.
+void print_lock_contention_counts(outputStream* st);
+
 char *lock_name(Mutex *mutex);
 
 // for debugging: check that we're already owning this lock (or are at a safepoint)
@@ -1487,12 +1487,15 @@ void ObjectMonitor::notify(TRAPS) {
 }
 
 
-// The current implementation of notifyAll() transfers the waiters one-at-a-time
-// from the waitset to the EntryList. This could be done more efficiently with a
-// single bulk transfer but in practice it's not time-critical. Beware too,
-// that in prepend-mode we invert the order of the waiters. Let's say that the
-// waitset is "ABCD" and the EntryList is "XYZ". After a notifyAll() in prepend
-// mode the waitset will be empty and the EntryList will be "DCBAXYZ".
+// notifyAll() transfers the waiters from the waitset to the entry lists in
+// one bulk splice: the whole waitset is dequeued under a single
+// _WaitSetLock acquisition and pushed onto the _cxq with a single CAS,
+// rather than paying a lock round-trip and a CAS per waiter. With a large
+// waitset this also keeps newly arriving enter() traffic from interleaving
+// with the transfer. Beware that, as with the one-at-a-time transfer, in
+// prepend-mode we invert the order of the waiters. Let's say that the
+// waitset is "ABCD" and the EntryList is "XYZ". After a notifyAll() in
+// prepend mode the waitset will be empty and the EntryList will be "DCBAXYZ".
 
 void ObjectMonitor::notifyAll(TRAPS) {
   CHECK_OWNER();
@@ -1502,10 +1505,52 @@ void ObjectMonitor::notifyAll(TRAPS) {
 
   DTRACE_MONITOR_PROBE(notifyAll, this, object(), THREAD);
   int tally = 0;
-  while (_WaitSet != NULL) {
+
+  // Chain of notified waiters destined for the _cxq, in reverse wait
+  // order, so that the single push below leaves the same order behind as
+  // prepending the waiters to the _cxq one notification at a time.
+  ObjectWaiter * chain = NULL;
+  ObjectWaiter * chain_tail = NULL;
+
+  Thread::SpinAcquire(&_WaitSetLock, "WaitSet - notifyall");
+  for (ObjectWaiter * iterator = DequeueWaiter(); iterator != NULL;
+       iterator = DequeueWaiter()) {
+    guarantee(iterator->TState == ObjectWaiter::TS_WAIT, "invariant");
+    guarantee(iterator->_notified == 0, "invariant");
     tally++;
-    INotify(THREAD);
+
+    iterator->_notified = 1;
+    iterator->_notifier_tid = JFR_THREAD_ID(THREAD);
+
+    if (chain == NULL && _EntryList == NULL) {
+      // As in INotify, the first notified waiter proceeds directly to an
+      // empty EntryList; the rest are destined for the _cxq.
+      iterator->TState = ObjectWaiter::TS_ENTER;
+      iterator->_next = iterator->_prev = NULL;
+      _EntryList = iterator;
+    } else {
+      iterator->TState = ObjectWaiter::TS_CXQ;
+      iterator->_next = chain;
+      chain = iterator;
+      if (chain_tail == NULL) {
+        chain_tail = iterator;
+      }
+    }
+
+    iterator->wait_reenter_begin(this);
+  }
+
+  if (chain != NULL) {
+    // Splice the whole chain onto the front of the _cxq.
+    for (;;) {
+      ObjectWaiter * front = _cxq;
+      chain_tail->_next = front;
+      if (Atomic::cmpxchg(chain, &_cxq, front) == front) {
+        break;
+      }
+    }
   }
+  Thread::SpinRelease(&_WaitSetLock);
 
   OM_PERFDATA_OP(Notifications, inc(tally));
 }
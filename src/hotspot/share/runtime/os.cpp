@@ -1736,6 +1736,16 @@ void os::commit_memory_or_exit(char* addr, size_t size, size_t alignment_hint,
   MemTracker::record_virtual_memory_commit((address)addr, size, CALLER_PC);
 }
 
+// Uncommit is deliberately eager.  A lazy tier that only advised the
+// kernel (MADV_FREE style) and kept the range reusable was considered
+// and rejected: commit_memory promises zero-filled pages and callers
+// (e.g. G1's page-based virtual space) build their dirty-page tracking
+// on that, lazily freed pages still count against a cgroup memory limit
+// until the kernel reclaims them -- so the memory the shrink was meant
+// to return is not actually available to neighbors under exactly the
+// containerized conditions that motivate shrinking -- and on Linux the
+// uncommitted range is remapped PROT_NONE so stray accesses fault
+// instead of silently reviving discarded data.
 bool os::uncommit_memory(char* addr, size_t bytes) {
   bool res;
   if (MemTracker::tracking_level() > NMT_minimal) {
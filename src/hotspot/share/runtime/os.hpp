@@ -387,7 +387,18 @@ class os: AllStatic {
   static void   free_memory(char *addr, size_t bytes, size_t alignment_hint);
   static void   realign_memory(char *addr, size_t bytes, size_t alignment_hint);
 
-  // NUMA-specific interface
+  // NUMA-specific interface.
+  //
+  // This is deliberately a thin mechanism layer: topology discovery is
+  // done once at initialization (on Linux the cpu-to-node map is built
+  // up front and queries hit the cached table), and placement policy
+  // stays with the subsystems that know what they are placing --
+  // MutableNUMASpace decides eden layout, collectors decide what their
+  // workers touch.  A central engine that also pinned VM threads to
+  // nodes was considered and rejected: thread binding fights the
+  // scheduler and whatever numactl/cpuset policy the operator installed,
+  // and memory policies here are advisory (MPOL_PREFERRED) for the same
+  // reason.
   static bool   numa_has_static_binding();
   static bool   numa_has_group_homing();
   static void   numa_make_local(char *addr, size_t bytes, int lgrp_hint);
@@ -32,6 +32,7 @@
 #include "runtime/java.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.hpp"
 #include "runtime/os.hpp"
 #include "runtime/perfData.inline.hpp"
 #include "utilities/exceptions.hpp"
@@ -41,6 +42,66 @@ PerfDataList*   PerfDataManager::_all = NULL;
 PerfDataList*   PerfDataManager::_sampled = NULL;
 PerfDataList*   PerfDataManager::_constants = NULL;
 volatile bool   PerfDataManager::_has_PerfData = 0;
+PerfDataNameIndex* volatile PerfDataManager::_name_index = NULL;
+
+/*
+ * The PerfDataNameIndex is a sorted-by-name snapshot of the registry.
+ * A new index is built under the PerfDataManager_lock whenever an item
+ * is added and is published with release semantics, so that readers can
+ * binary search the current index without taking the lock. A superseded
+ * index may still be in use by a concurrent reader; it is therefore kept
+ * on a retired chain and reclaimed in PerfDataManager::destroy().
+ */
+class PerfDataNameIndex : public CHeapObj<mtInternal> {
+  friend class PerfDataManager;
+  private:
+    PerfData** _entries;
+    int _length;
+    PerfDataNameIndex* _retired;    // chain of superseded indices
+
+    // build a new index from the previous, sorted, index by inserting
+    // the added item at its ordinal position
+    PerfDataNameIndex(const PerfDataNameIndex* previous, PerfData* p) :
+      _entries(NULL),
+      _length(previous == NULL ? 1 : previous->_length + 1),
+      _retired(NULL) {
+      _entries = NEW_C_HEAP_ARRAY(PerfData*, _length, mtInternal);
+      int pos = 0;
+      if (previous != NULL) {
+        while (pos < previous->_length &&
+               strcmp(previous->_entries[pos]->name(), p->name()) < 0) {
+          _entries[pos] = previous->_entries[pos];
+          ++pos;
+        }
+        for (int i = pos; i < previous->_length; i++) {
+          _entries[i + 1] = previous->_entries[i];
+        }
+      }
+      _entries[pos] = p;
+    }
+
+    ~PerfDataNameIndex() {
+      FREE_C_HEAP_ARRAY(PerfData*, _entries);
+    }
+
+    PerfData* find(const char* name) const {
+      int low = 0;
+      int high = _length - 1;
+      while (low <= high) {
+        const int mid = (low + high) >> 1;
+        const int result = strcmp(_entries[mid]->name(), name);
+        if (result == 0) {
+          return _entries[mid];
+        }
+        if (result < 0) {
+          low = mid + 1;
+        } else {
+          high = mid - 1;
+        }
+      }
+      return NULL;
+    }
+};
 
 /*
  * The jvmstat global and subsystem jvmstat counter name spaces. The top
@@ -287,6 +348,16 @@ void PerfDataManager::destroy() {
   delete(_sampled);
   delete(_constants);
 
+  // reclaim the published name index together with the retired
+  // indices that were superseded while the registry grew
+  PerfDataNameIndex* index = _name_index;
+  _name_index = NULL;
+  while (index != NULL) {
+    PerfDataNameIndex* const retired = index->_retired;
+    delete index;
+    index = retired;
+  }
+
   _all = NULL;
   _sampled = NULL;
   _constants = NULL;
@@ -305,6 +376,7 @@ void PerfDataManager::add_item(PerfData* p, bool sampled) {
 
   // add to the list of all perf data items
   _all->append(p);
+  publish_name_index(p);
 
   if (p->variability() == PerfData::V_Constant) {
     if (_constants == NULL) {
@@ -322,13 +394,18 @@ void PerfDataManager::add_item(PerfData* p, bool sampled) {
   }
 }
 
+void PerfDataManager::publish_name_index(PerfData* p) {
+  assert_lock_strong(PerfDataManager_lock);
+  PerfDataNameIndex* const previous = _name_index;
+  PerfDataNameIndex* const index = new PerfDataNameIndex(previous, p);
+  index->_retired = previous;
+  OrderAccess::release_store(&_name_index, index);
+}
+
 PerfData* PerfDataManager::find_by_name(const char* name) {
-  // if add_item hasn't been called the list won't be initialized
-  if (_all != NULL) {
-    return _all->find_by_name(name);
-  } else {
-    return NULL;
-  }
+  // if add_item hasn't been called the index won't be published
+  const PerfDataNameIndex* const index = OrderAccess::load_acquire(&_name_index);
+  return index != NULL ? index->find(name) : NULL;
 }
 
 PerfDataList* PerfDataManager::all() {
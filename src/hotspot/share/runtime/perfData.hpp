@@ -662,6 +662,8 @@ class PerfDataList : public CHeapObj<mtInternal> {
  * subtypes via a set a factory methods and for managing lists
  * of the various PerfData types.
  */
+class PerfDataNameIndex;
+
 class PerfDataManager : AllStatic {
 
   friend class StatSampler;   // for access to protected PerfDataList methods
@@ -672,10 +674,14 @@ class PerfDataManager : AllStatic {
     static PerfDataList* _constants;
     static const char* _name_spaces[];
     static volatile bool _has_PerfData;
+    static PerfDataNameIndex* volatile _name_index;
 
     // add a PerfData item to the list(s) of know PerfData objects
     static void add_item(PerfData* p, bool sampled);
 
+    // rebuild the sorted name index and publish it for lock-free readers
+    static void publish_name_index(PerfData* p);
+
   protected:
     // return the list of all known PerfData items
     static PerfDataList* all();
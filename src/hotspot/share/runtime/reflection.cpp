@@ -1197,6 +1197,18 @@ static oop invoke(InstanceKlass* klass,
 // This would be nicer if, say, java.lang.reflect.Method was a subclass
 // of java.lang.reflect.Constructor
 
+// This slow path and the Java-side generated accessors are not the only
+// invocation scheme: shared per-signature-shape invokers already exist in
+// the method handle machinery, where erased LambdaForms are interned and
+// reused across all handles of the same basic-type shape, and where C2
+// folds the whole chain when the MethodHandle is constant.  A parallel set
+// of VM trampolines taking (Method*, argument buffer) would duplicate that
+// without the appendix/LambdaForm plumbing C2 needs to devirtualize, so
+// reflection-heavy callers wanting compiled, shareable invokers should go
+// through MethodHandles/Lookup.unreflect rather than Method.invoke.  The
+// per-method bytecode accessors on the Java side remain gated by
+// -Dsun.reflect.inflationThreshold for callers that stay here.
+
 oop Reflection::invoke_method(oop method_mirror, Handle receiver, objArrayHandle args, TRAPS) {
   oop mirror             = java_lang_reflect_Method::clazz(method_mirror);
   int slot               = java_lang_reflect_Method::slot(method_mirror);
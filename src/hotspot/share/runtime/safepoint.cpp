@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "classfile/classLoaderDataGraph.inline.hpp"
 #include "classfile/dictionary.hpp"
+#include "classfile/loaderConstraints.hpp"
 #include "classfile/stringTable.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
@@ -39,6 +40,7 @@
 #include "gc/shared/workgroup.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -194,7 +196,8 @@ static void back_off(int64_t start_time) {
   }
 }
 
-int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running)
+int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running,
+                                              StragglerInfo* stragglers, int* nof_stragglers)
 {
   JavaThreadIteratorWithHandle jtiwh;
 
@@ -224,6 +227,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   DEBUG_ONLY(assert_list_is_valid(tss_head, still_running);)
 
   *initial_running = still_running;
+  *nof_stragglers = 0;
 
   // If there is no thread still running, we are already done.
   if (still_running <= 0) {
@@ -253,6 +257,14 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
         --still_running;
+        // Remember the last few threads to reach their poll, so that a
+        // time-to-safepoint spike can be attributed to a thread instead
+        // of showing up only in the aggregate sync time.  The array is
+        // a ring holding the newest max_tracked_stragglers entries.
+        StragglerInfo* info = &stragglers[*nof_stragglers % max_tracked_stragglers];
+        info->_thread = cur_tss->thread();
+        info->_latency_ns = os::javaTimeNanos() - start_time;
+        (*nof_stragglers)++;
         *p_prev = NULL;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -278,6 +290,51 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   return iterations;
 }
 
+// Report the threads that were last to reach their safepoint poll.  This
+// runs after the VM is synchronized, so the stragglers are stopped (or
+// safely in native) and their last Java frame is stable, which lets a
+// time-to-safepoint spike be attributed to a thread and a code location --
+// typically a long JNI call or a compiled loop without a safepoint poll --
+// instead of showing up only as an aggregate sync time.
+void SafepointSynchronize::report_stragglers(const StragglerInfo* stragglers, int nof_stragglers) {
+  assert(Thread::current()->is_VM_thread(), "Only VM thread may report stragglers");
+  if (nof_stragglers == 0) {
+    return;
+  }
+
+  // The last entry belongs to the final thread to reach its poll; its
+  // latency is the time-to-safepoint of this synchronization.
+  RuntimeService::record_safepoint_straggler(
+      stragglers[(nof_stragglers - 1) % max_tracked_stragglers]._latency_ns);
+
+  // The entries form a ring holding the newest max_tracked_stragglers;
+  // report them oldest first.
+  const int first = (nof_stragglers > max_tracked_stragglers) ? nof_stragglers - max_tracked_stragglers : 0;
+  for (int i = first; i < nof_stragglers; i++) {
+    const StragglerInfo* info = &stragglers[i % max_tracked_stragglers];
+
+    EventSafepointStraggler event;
+    if (event.should_commit()) {
+      event.set_safepointId(_safepoint_counter);
+      event.set_straggler(JFR_THREAD_ID(info->_thread));
+      event.set_pollLatency(info->_latency_ns);
+      event.commit();
+    }
+
+    LogTarget(Debug, safepoint) lt;
+    if (lt.is_enabled()) {
+      ResourceMark rm;
+      LogStream ls(lt);
+      ls.print("Safepoint straggler (" JLONG_FORMAT " ns to reach poll): ", info->_latency_ns);
+      info->_thread->print_on(&ls);
+      if (info->_thread->has_last_Java_frame()) {
+        ls.print("  last Java frame: ");
+        info->_thread->last_frame().print_value_on(&ls, info->_thread);
+      }
+    }
+  }
+}
+
 void SafepointSynchronize::arm_safepoint() {
   // Begin the process of bringing the system to a safepoint.
   // Java threads can be in several different states and are
@@ -382,12 +439,15 @@ void SafepointSynchronize::begin() {
 
   EventSafepointStateSynchronization sync_event;
   int initial_running = 0;
+  StragglerInfo stragglers[max_tracked_stragglers];
+  int nof_stragglers = 0;
 
   // Arms the safepoint, _current_jni_active_count and _waiting_to_block must be set before.
   arm_safepoint();
 
   // Will spin until all threads are safe.
-  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running);
+  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running,
+                                       stragglers, &nof_stragglers);
   assert(_waiting_to_block == 0, "No thread should be running");
 
 #ifndef PRODUCT
@@ -423,6 +483,8 @@ void SafepointSynchronize::begin() {
                                    initial_running,
                                    _waiting_to_block, iterations);
 
+  report_stragglers(stragglers, nof_stragglers);
+
   SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
 
   // We do the safepoint cleanup first since a GC related safepoint
@@ -621,11 +683,17 @@ public:
     }
 
     if (_subtasks.try_claim_task(SafepointSynchronize::SAFEPOINT_CLEANUP_SYSTEM_DICTIONARY_RESIZE)) {
-      if (Dictionary::does_any_dictionary_needs_resizing()) {
+      if (Dictionary::does_any_dictionary_needs_resizing() ||
+          LoaderConstraintTable::needs_resizing()) {
         const char* name = "resizing system dictionaries";
         EventSafepointCleanupTask event;
         TraceTime timer(name, TRACETIME_LOG(Info, safepoint, cleanup));
-        ClassLoaderDataGraph::resize_dictionaries();
+        if (Dictionary::does_any_dictionary_needs_resizing()) {
+          ClassLoaderDataGraph::resize_dictionaries();
+        }
+        if (LoaderConstraintTable::needs_resizing()) {
+          SystemDictionary::resize_loader_constraints();
+        }
 
         post_safepoint_cleanup_task_event(event, safepoint_id, name);
       }
@@ -108,9 +108,20 @@ class SafepointSynchronize : AllStatic {
   // For debug long safepoint
   static void print_safepoint_timeout();
 
+  // Straggler attribution: the last few threads to reach their poll
+  // during synchronization, with the elapsed synchronization time at
+  // which each of them got there.
+  struct StragglerInfo {
+    JavaThread* _thread;
+    jlong       _latency_ns;
+  };
+  static const int max_tracked_stragglers = 4;
+
   // Helper methods for safepoint procedure:
   static void arm_safepoint();
-  static int synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running);
+  static int synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running,
+                                 StragglerInfo* stragglers, int* nof_stragglers);
+  static void report_stragglers(const StragglerInfo* stragglers, int nof_stragglers);
   static void disarm_safepoint();
   static void increment_jni_active_count();
   static void decrement_waiting_to_block();
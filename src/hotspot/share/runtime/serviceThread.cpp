@@ -27,6 +27,7 @@
 #include "classfile/stringTable.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
+#include "interpreter/oopMapCache.hpp"
 #include "memory/universe.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
@@ -125,6 +126,7 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
     bool symboltable_work = false;
     bool resolved_method_table_work = false;
     bool protection_domain_table_work = false;
+    bool oopmap_cache_work = false;
     bool oopstorage_work = false;
     bool oopstorages_cleanup[oopstorage_count] = {}; // Zero (false) initialize.
     JvmtiDeferredEvent jvmti_event;
@@ -152,6 +154,7 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
               (symboltable_work = SymbolTable::has_work()) |
               (resolved_method_table_work = ResolvedMethodTable::has_work()) |
               (protection_domain_table_work = SystemDictionary::pd_cache_table()->has_work()) |
+              (oopmap_cache_work = OopMapCache::has_cleanup_work()) |
               (oopstorage_work = needs_oopstorage_cleanup(oopstorages,
                                                           oopstorages_cleanup,
                                                           oopstorage_count)))
@@ -198,6 +201,10 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
       SystemDictionary::pd_cache_table()->unlink();
     }
 
+    if (oopmap_cache_work) {
+      OopMapCache::cleanup_old_entries();
+    }
+
     if (oopstorage_work) {
       cleanup_oopstorages(oopstorages, oopstorages_cleanup, oopstorage_count);
     }
@@ -31,6 +31,7 @@
 #include "runtime/arguments.hpp"
 #include "runtime/java.hpp"
 #include "runtime/javaCalls.hpp"
+#include "runtime/orderAccess.hpp"
 #include "runtime/os.hpp"
 #include "runtime/perfData.inline.hpp"
 #include "runtime/statSampler.hpp"
@@ -51,6 +52,8 @@ class StatSamplerTask : public PeriodicTask {
 
 StatSamplerTask*              StatSampler::_task   = NULL;
 PerfDataList*                 StatSampler::_sampled = NULL;
+PerfCounter*                  StatSampler::_sample_epoch_begin = NULL;
+PerfCounter*                  StatSampler::_sample_epoch_end = NULL;
 
 /*
  * the initialize method is called from the engage() method
@@ -109,7 +112,7 @@ void StatSampler::disengage() {
   _task = NULL;
 
   // force a final sample
-  sample_data(_sampled);
+  collect_sample();
 }
 
 /*
@@ -169,7 +172,18 @@ void StatSampler::collect_sample() {
 
   assert(_sampled != NULL, "list not initialized");
 
+  // The epoch stamps bracket the sampling pass, seqlock style. An
+  // out-of-process reader that copies the whole perfdata region in one
+  // pass has a consistent set of sampled values if the copied
+  // sampleEpochBegin and sampleEpochEnd values are equal; otherwise a
+  // sampling pass was in progress and the copy should be retried.
+  _sample_epoch_begin->inc();
+  OrderAccess::storestore();
+
   sample_data(_sampled);
+
+  OrderAccess::storestore();
+  _sample_epoch_end->inc();
 }
 
 /*
@@ -327,6 +341,16 @@ void StatSampler::create_misc_perfdata() {
                                          VM_Version::internal_vm_info_string(),
                                          CHECK);
 
+  // epoch stamps bracketing each sampling pass, incremented by
+  // collect_sample(); readers copying the perfdata region use them to
+  // validate that the copy holds a consistent set of sampled values
+  _sample_epoch_begin = PerfDataManager::create_counter(SUN_RT,
+                                          "sampleEpochBegin",
+                                          PerfData::U_Events, CHECK);
+  _sample_epoch_end = PerfDataManager::create_counter(SUN_RT,
+                                          "sampleEpochEnd",
+                                          PerfData::U_Events, CHECK);
+
   // create sampled instrumentation objects
   create_sampled_perfdata();
 }
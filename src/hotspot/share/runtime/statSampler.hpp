@@ -46,6 +46,8 @@ class StatSampler : AllStatic {
 
     static StatSamplerTask* _task;
     static PerfDataList* _sampled;
+    static PerfCounter* _sample_epoch_begin;
+    static PerfCounter* _sample_epoch_end;
 
     static void collect_sample();
     static void create_misc_perfdata();
@@ -151,6 +151,19 @@ address StubRoutines::_montgomerySquare = NULL;
 
 address StubRoutines::_vectorizedMismatch = NULL;
 
+address StubRoutines::_stringLatin1HashCode = NULL;
+address StubRoutines::_stringUTF16HashCode = NULL;
+
+// The transcendental stubs are scalar only.  Multi-lane variants that
+// SuperWord could call in place of a pack of scalar calls would need
+// more than new kernels: a call inside the loop body keeps the loop
+// from ever reaching SuperWord (calls mean a safepoint and killed
+// registers, so the loop is not a vectorization candidate), and a
+// vector calling convention for stubs does not exist -- every platform
+// would need an ABI for passing/returning vector registers past a call
+// that today clobbers them.  Lane-accurate polynomial kernels also
+// cannot be shared with these scalar implementations, whose table-plus
+// -reduction algorithms do not vectorize.
 address StubRoutines::_dexp = NULL;
 address StubRoutines::_dlog = NULL;
 address StubRoutines::_dlog10 = NULL;
@@ -191,6 +191,9 @@ class StubRoutines: AllStatic {
 
   static address _vectorizedMismatch;
 
+  static address _stringLatin1HashCode;
+  static address _stringUTF16HashCode;
+
   static address _dexp;
   static address _dlog;
   static address _dlog10;
@@ -353,6 +356,9 @@ class StubRoutines: AllStatic {
 
   static address vectorizedMismatch()  { return _vectorizedMismatch; }
 
+  static address stringLatin1HashCode() { return _stringLatin1HashCode; }
+  static address stringUTF16HashCode()  { return _stringUTF16HashCode; }
+
   static address dexp()                { return _dexp; }
   static address dlog()                { return _dlog; }
   static address dlog10()              { return _dlog10; }
@@ -151,6 +151,7 @@ int      NMethodSweeper::_seen                         = 0;    // Nof. nmethod w
 
 volatile bool NMethodSweeper::_should_sweep            = false;// Indicates if we should invoke the sweeper
 volatile bool NMethodSweeper::_force_sweep             = false;// Indicates if we should force a sweep
+bool     NMethodSweeper::_fragmented_code_heap         = false;// The non-profiled code heap looked fragmented at the start of this sweep
 volatile int  NMethodSweeper::_bytes_changed           = 0;    // Counts the total nmethod size if the nmethod changed from:
                                                                //   1) alive       -> not_entrant
                                                                //   2) not_entrant -> zombie
@@ -424,6 +425,16 @@ void NMethodSweeper::possibly_sweep() {
   //                                              15 invocations of 'mark_active_nmethods.
   // Large ReservedCodeCacheSize:   (e.g., 256M + code Cache is 90% full). The formula
   //                                              computes: (256 / 16) - 10 = 6.
+  // A fragmented non-profiled code heap can fail allocations while its free
+  // ratio still looks comfortable: plenty of free space in total, but no
+  // contiguous block left that fits a new nmethod. Treat that state like a
+  // nearly full code cache so that flushing of cold methods sets in before
+  // allocation failures turn off compilation.
+  _fragmented_code_heap = CodeCache::is_heap_fragmented(CodeBlobType::MethodNonProfiled);
+  if (_fragmented_code_heap) {
+    _should_sweep = true;
+  }
+
   if (!_should_sweep) {
     const int time_since_last_sweep = _time_counter - _last_sweep;
     // ReservedCodeCacheSize has an 'unsigned' type. We need a 'signed' type for max_wait_time,
@@ -760,7 +771,15 @@ void NMethodSweeper::possibly_flush(nmethod* nm) {
       int reset_val = hotness_counter_reset_val();
       int time_since_reset = reset_val - nm->hotness_counter();
       int code_blob_type = CodeCache::get_code_blob_type(nm);
-      double threshold = -reset_val + (CodeCache::reverse_free_ratio(code_blob_type) * NmethodSweepActivity);
+      double reverse_free_ratio = CodeCache::reverse_free_ratio(code_blob_type);
+      if (_fragmented_code_heap && (!SegmentedCodeCache || code_blob_type == CodeBlobType::MethodNonProfiled)) {
+        // The heap has free space, but scattered into pieces too small to
+        // allocate from. Flush as if only StartAggressiveSweepingAt percent
+        // of the heap were free, so that cold neighbors of the free pieces
+        // go away and the free space can coalesce.
+        reverse_free_ratio = MAX2(reverse_free_ratio, 100.0 / (double)StartAggressiveSweepingAt);
+      }
+      double threshold = -reset_val + (reverse_free_ratio * NmethodSweepActivity);
       // The less free space in the code cache we have - the bigger reverse_free_ratio() is.
       // I.e., 'threshold' increases with lower available space in the code cache and a higher
       // NmethodSweepActivity. If the current hotness counter - which decreases from its initial
@@ -56,6 +56,17 @@ class CodeBlobClosure;
 //     cleared. After that, the nmethod can be evicted from the code cache. Each nmethod's
 //     state change happens during separate sweeps. It may take at least 3 sweeps before an
 //     nmethod's space is freed.
+//
+// Replacing the safepoint marking phase with nmethod entry barriers
+// (as concurrent class unloading uses via BarrierSetNMethod) would
+// remove the sweeper's safepoint work, but only for collectors that
+// arm nmethods at all -- BarrierSetNMethod::barrier_set_nmethod() is
+// NULL for the stop-the-world collectors this sweeper must also serve,
+// and an armed-entry scheme proves a method is *entered*, not that it
+// is absent from every stack, which is the property the marking phase
+// establishes before reclamation.  Until every collector provides both,
+// the safepoint piggyback stays; the sweep itself already runs outside
+// safepoints and yields the CodeCache_lock between chunks.
 
 class NMethodSweeper : public AllStatic {
  private:
@@ -74,6 +85,7 @@ class NMethodSweeper : public AllStatic {
   static volatile int  _sweep_started;            // Flag to control conc sweeper
   static volatile bool _should_sweep;             // Indicates if we should invoke the sweeper
   static volatile bool _force_sweep;              // Indicates if we should force a sweep
+  static bool      _fragmented_code_heap;         // The non-profiled code heap looked fragmented at the start of this sweep
   static volatile int _bytes_changed;             // Counts the total nmethod size if the nmethod changed from:
                                                   //   1) alive       -> not_entrant
                                                   //   2) not_entrant -> zombie
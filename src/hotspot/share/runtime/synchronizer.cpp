@@ -1126,15 +1126,29 @@ ObjectMonitor* ObjectSynchronizer::omAlloc(Thread * Self) {
     // Element [0] is reserved for global list linkage
     temp[0].set_object(CHAINMARKER);
 
-    // Consider carving out this thread's current request from the
-    // block in hand.  This avoids some lock traffic and redundant
-    // list activity.
+    // Carve this thread's current provision out of the block in hand
+    // before the remainder is published. This avoids the second trip
+    // through the gListLock that case 2 would otherwise take, and it
+    // keeps monitors whose storage this thread just first-touched with
+    // this thread rather than letting remote threads pull them off the
+    // global list.
+    int carve = Self->omFreeProvision;
+    if (carve > _BLOCKSIZE - 1) {
+      carve = _BLOCKSIZE - 1;
+    }
+    ObjectMonitor * remainder = temp + 1;
+    for (int i = 0; i < carve; i++) {
+      ObjectMonitor * take = remainder;
+      remainder = take->FreeNext;
+      take->Recycle();
+      omRelease(Self, take, false);
+    }
 
     // Acquire the gListLock to manipulate gBlockList and gFreeList.
     // An Oyama-Taura-Yonezawa scheme might be more efficient.
     Thread::muxAcquire(&gListLock, "omAlloc(2)");
     gMonitorPopulation += _BLOCKSIZE-1;
-    gMonitorFreeCount += _BLOCKSIZE-1;
+    gMonitorFreeCount += (_BLOCKSIZE-1) - carve;
 
     // Add the new block to the list of extant blocks (gBlockList).
     // The very first objectMonitor in a block is reserved and dedicated.
@@ -1144,9 +1158,12 @@ ObjectMonitor* ObjectSynchronizer::omAlloc(Thread * Self) {
     // the previous stores happen before we update gBlockList.
     OrderAccess::release_store(&gBlockList, temp);
 
-    // Add the new string of objectMonitors to the global free list
-    temp[_BLOCKSIZE - 1].FreeNext = gFreeList;
-    gFreeList = temp + 1;
+    // Add the uncarved remainder of the new string of objectMonitors to
+    // the global free list.
+    if (remainder != NULL) {
+      temp[_BLOCKSIZE - 1].FreeNext = gFreeList;
+      gFreeList = remainder;
+    }
     Thread::muxRelease(&gListLock);
   }
 }
@@ -44,6 +44,7 @@
 #include "jfr/jfrEvents.hpp"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
@@ -3884,6 +3885,10 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
 
   JFR_ONLY(Jfr::on_vm_init();)
 
+  // Start the flush thread for asynchronous logging, if requested. Log
+  // messages written before this point are written synchronously.
+  AsyncLogWriter::initialize();
+
   // Should be done after the heap is fully created
   main_thread->cache_global_variables();
 
@@ -24,6 +24,7 @@
  */
 
 #include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/orderAccess.hpp"
 #include "runtime/sharedRuntime.hpp"
@@ -123,6 +124,16 @@ void ThreadHeapSampler::pick_next_sample(size_t overflowed_bytes) {
   pick_next_geometric_sample();
 }
 
+static void send_allocation_sample_event(oop obj, size_t allocation_size, size_t sampled_bytes) {
+  EventObjectAllocationSample event;
+  if (event.should_commit()) {
+    event.set_objectClass(obj->klass());
+    event.set_allocationSize(allocation_size);
+    event.set_weight(sampled_bytes);
+    event.commit();
+  }
+}
+
 void ThreadHeapSampler::check_for_sampling(oop obj, size_t allocation_size, size_t bytes_since_allocation) {
   size_t total_allocated_bytes = bytes_since_allocation + allocation_size;
 
@@ -133,6 +144,7 @@ void ThreadHeapSampler::check_for_sampling(oop obj, size_t allocation_size, size
   }
 
   JvmtiExport::sampled_object_alloc_event_collector(obj);
+  send_allocation_sample_event(obj, allocation_size, total_allocated_bytes);
 
   size_t overflow_bytes = total_allocated_bytes - _bytes_until_sample;
   pick_next_sample(overflow_bytes);
@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/resourceArea.hpp"
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.inline.hpp"
@@ -622,6 +623,55 @@ JavaThread* ThreadsList::find_JavaThread_from_java_tid(jlong java_tid) const {
   return NULL;
 }
 
+// Find the JavaThreads for a whole array of java tids with a single pass
+// over the list, rather than one scan per tid. The result array must have
+// room for num_tids entries; an entry is set to NULL if the corresponding
+// thread does not exist or has terminated. Duplicated tids resolve to the
+// same thread. The caller is responsible for a ResourceMark.
+void ThreadsList::find_JavaThreads_from_java_tids(const jlong* java_tids, int num_tids, JavaThread** result) const {
+  assert(java_tids != NULL, "invariant");
+  assert(result != NULL, "invariant");
+  if (num_tids == 0) {
+    return;
+  }
+  // Open addressed table mapping a tid to its result slot, sized to keep
+  // the load factor below one half.
+  int table_size = 8;
+  while (table_size < num_tids * 2) {
+    table_size *= 2;
+  }
+  const int mask = table_size - 1;
+  int* const slots = NEW_RESOURCE_ARRAY(int, table_size);
+  for (int i = 0; i < table_size; i++) {
+    slots[i] = -1;
+  }
+  for (int i = 0; i < num_tids; i++) {
+    result[i] = NULL;
+    const julong tid = (julong)java_tids[i];
+    int index = (int)((tid ^ (tid >> 32)) & mask);
+    while (slots[index] != -1) {
+      index = (index + 1) & mask;
+    }
+    slots[index] = i;
+  }
+  for (uint t = 0; t < length(); t++) {
+    JavaThread* const thread = thread_at(t);
+    oop tobj = thread->threadObj();
+    // Ignore the thread if it hasn't run yet, has exited
+    // or is starting to exit.
+    if (tobj == NULL || thread->is_exiting()) {
+      continue;
+    }
+    const julong tid = (julong)java_lang_Thread::thread_id(tobj);
+    // Probe past matches as well; a duplicated tid occupies several slots.
+    for (int index = (int)((tid ^ (tid >> 32)) & mask); slots[index] != -1; index = (index + 1) & mask) {
+      if ((julong)java_tids[slots[index]] == tid) {
+        result[slots[index]] = thread;
+      }
+    }
+  }
+}
+
 void ThreadsList::inc_nested_handle_cnt() {
   // The increment needs to be MO_SEQ_CST so that the reference counter
   // update is seen before the subsequent hazard ptr update.
@@ -196,6 +196,7 @@ public:
   // Returns -1 if target is not found.
   int find_index_of_JavaThread(JavaThread* target);
   JavaThread* find_JavaThread_from_java_tid(jlong java_tid) const;
+  void find_JavaThreads_from_java_tids(const jlong* java_tids, int num_tids, JavaThread** result) const;
   bool includes(const JavaThread * const p) const;
 };
 
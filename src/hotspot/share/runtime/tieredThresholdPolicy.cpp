@@ -559,9 +559,14 @@ bool TieredThresholdPolicy::is_old(Method* method) {
   return method->invocation_count() > 50000 || method->backedge_count() > 500000;
 }
 
+// The benefit of compiling a method is its measured event rate scaled by
+// the accumulated event counts. The cost of compiling it is estimated by
+// its bytecode size: between two equally hot methods the smaller one is
+// compiled first since it starts paying off sooner.
 double TieredThresholdPolicy::weight(Method* method) {
   return (double)(method->rate() + 1) *
-    (method->invocation_count() + 1) * (method->backedge_count() + 1);
+    (method->invocation_count() + 1) * (method->backedge_count() + 1) /
+    (method->code_size() + 1);
 }
 
 // Apply heuristics and return true if x should be compiled before y
@@ -571,6 +576,18 @@ bool TieredThresholdPolicy::compare_methods(Method* x, Method* y) {
     return true;
   } else
     if (x->highest_comp_level() == y->highest_comp_level()) {
+      // Generated LambdaForm bytecode reaches the queue in large numbers
+      // during method handle and invokedynamic warmup, and most of it only
+      // runs a handful of times. Between two methods of equal level, serve
+      // the application method first; the lambda forms are still compiled
+      // once the queue drains, and genuinely hot ones keep accumulating
+      // events while they wait.
+      if (y->is_compiled_lambda_form() && !x->is_compiled_lambda_form()) {
+        return true;
+      }
+      if (x->is_compiled_lambda_form() && !y->is_compiled_lambda_form()) {
+        return false;
+      }
       if (weight(x) > weight(y)) {
         return true;
       }
@@ -607,6 +624,39 @@ double TieredThresholdPolicy::threshold_scale(CompLevel level, int feedback_k) {
   return k;
 }
 
+// A method that keeps deoptimizing with Action_reinterpret burns a C2
+// compiler thread every time it climbs back to level 4 and then traps out
+// again. Every such trip bumps the decompile count in the MDO (see
+// nmethod::inc_decompile_count()), so we use it as feedback: beyond
+// Tier4RecompilationBackoff decompilations the tier 4 thresholds double
+// with each further decompilation, making every trip exponentially longer
+// than the previous one.
+double TieredThresholdPolicy::recompilation_backoff(Method* method) {
+  MethodData* mdo = method->method_data();
+  if (Tier4RecompilationBackoff == 0 || mdo == NULL) {
+    return 1;
+  }
+  uint count = mdo->decompile_count();
+  if (count <= (uint)Tier4RecompilationBackoff) {
+    return 1;
+  }
+  // The counters saturate anyway, no point scaling beyond what they can reach.
+  uint excess = MIN2(count - (uint)Tier4RecompilationBackoff, (uint)16);
+  return (double)((uint64_t)1 << excess);
+}
+
+// Check if a method has used up its recompilation budget. The budget is
+// expressed in bytecodes so that recompiling a huge method, which costs
+// proportionally more C2 time, drains it faster than recompiling a small one.
+bool TieredThresholdPolicy::exceeds_recompilation_budget(Method* method) {
+  MethodData* mdo = method->method_data();
+  if (Tier4RecompilationBudget == 0 || mdo == NULL) {
+    return false;
+  }
+  uint count = mdo->decompile_count();
+  return count > 0 && (uint64_t)count * MAX2(method->code_size(), 1) > (uint64_t)Tier4RecompilationBudget;
+}
+
 // Call and loop predicates determine whether a transition to a higher
 // compilation level should be performed (pointers to predicate functions
 // are passed to common()).
@@ -626,6 +676,7 @@ bool TieredThresholdPolicy::loop_predicate(int i, int b, CompLevel cur_level, Me
   }
   case CompLevel_full_profile: {
     double k = threshold_scale(CompLevel_full_optimization, Tier4LoadFeedback);
+    k *= recompilation_backoff(method);
     return loop_predicate_helper<CompLevel_full_profile>(i, b, k, method);
   }
   default:
@@ -646,6 +697,7 @@ bool TieredThresholdPolicy::call_predicate(int i, int b, CompLevel cur_level, Me
   }
   case CompLevel_full_profile: {
     double k = threshold_scale(CompLevel_full_optimization, Tier4LoadFeedback);
+    k *= recompilation_backoff(method);
     return call_predicate_helper<CompLevel_full_profile>(i, b, k, method);
   }
   default:
@@ -846,6 +898,14 @@ CompLevel TieredThresholdPolicy::common(Predicate p, Method* method, CompLevel c
       break;
     }
   }
+  // A chronically unstable method that has spent its recompilation budget
+  // settles at C1 with counters instead of thrashing C2. Note that this
+  // keeps the method compilable, unlike the PerMethodRecompilationCutoff.
+  if (next_level == CompLevel_full_optimization &&
+      cur_level != CompLevel_full_optimization &&
+      exceeds_recompilation_budget(method)) {
+    next_level = CompLevel_limited_profile;
+  }
   return MIN2(next_level, (CompLevel)TieredStopAtLevel);
 }
 
@@ -202,6 +202,12 @@ class TieredThresholdPolicy : public CompilationPolicy {
   inline void update_rate(jlong t, Method* m);
   // Compute threshold scaling coefficient
   inline double threshold_scale(CompLevel level, int feedback_k);
+  // Compute the exponential tier 4 threshold backoff coefficient for a
+  // method that keeps deoptimizing.
+  inline double recompilation_backoff(Method* method);
+  // Check if a method has spent its cost-weighted recompilation budget and
+  // should settle at a C1 level instead of being recompiled with C2.
+  inline bool exceeds_recompilation_budget(Method* method);
   // If a method is old enough and is still in the interpreter we would want to
   // start profiling without waiting for the compiled method to arrive. This function
   // determines whether we should do that.
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/javaClasses.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "classfile/vmSymbols.hpp"
+#include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/javaCalls.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.inline.hpp"
+#include "services/diagnosticAsync.hpp"
+
+DCmdAsyncJob* DCmdAsyncManager::_jobs = NULL;
+int DCmdAsyncManager::_next_id = 1;
+
+DCmdAsyncJob::DCmdAsyncJob(DCmdSource source, const char* cmdline) :
+  _id(0),
+  _cmdline(os::strdup_check_oom(cmdline, mtInternal)),
+  _source(source),
+  _state(job_pending),
+  _start_time(os::javaTimeMillis()),
+  _output(),
+  _next(NULL) {}
+
+DCmdAsyncJob::~DCmdAsyncJob() {
+  os::free(_cmdline);
+}
+
+const char* DCmdAsyncJob::state_name() const {
+  switch (_state) {
+    case job_pending:   return "pending";
+    case job_running:   return "running";
+    case job_completed: return "completed";
+    case job_failed:    return "failed";
+    case job_cancelled: return "cancelled";
+    default:
+      ShouldNotReachHere();
+      return NULL;
+  }
+}
+
+DCmdAsyncJob* DCmdAsyncManager::find_job(int id) {
+  assert_lock_strong(DCmdAsyncJobs_lock);
+  for (DCmdAsyncJob* job = _jobs; job != NULL; job = job->_next) {
+    if (job->_id == id) {
+      return job;
+    }
+  }
+  return NULL;
+}
+
+void DCmdAsyncManager::remove_job(DCmdAsyncJob* job) {
+  assert_lock_strong(DCmdAsyncJobs_lock);
+  DCmdAsyncJob** p = &_jobs;
+  while (*p != job) {
+    p = &(*p)->_next;
+  }
+  *p = job->_next;
+}
+
+// Jobs are prepended to the list, so the oldest pending job is the last one.
+DCmdAsyncJob* DCmdAsyncManager::claim_pending_job() {
+  MutexLocker ml(DCmdAsyncJobs_lock, Mutex::_no_safepoint_check_flag);
+  DCmdAsyncJob* claimed = NULL;
+  for (DCmdAsyncJob* job = _jobs; job != NULL; job = job->_next) {
+    if (job->_state == DCmdAsyncJob::job_pending) {
+      claimed = job;
+    }
+  }
+  if (claimed != NULL) {
+    claimed->_state = DCmdAsyncJob::job_running;
+  }
+  return claimed;
+}
+
+void DCmdAsyncManager::worker_entry(JavaThread* thread, TRAPS) {
+  DCmdAsyncJob* const job = claim_pending_job();
+  if (job == NULL) {
+    // the pending job was cancelled before a worker picked it up
+    return;
+  }
+  HandleMark hm(THREAD);
+  DCmd::parse_and_execute(job->_source, &job->_output, job->_cmdline, ' ', THREAD);
+  DCmdAsyncJob::JobState final_state = DCmdAsyncJob::job_completed;
+  if (HAS_PENDING_EXCEPTION) {
+    ResourceMark rm(THREAD);
+    job->_output.cr();
+    job->_output.print_cr("%s", PENDING_EXCEPTION->klass()->external_name());
+    CLEAR_PENDING_EXCEPTION;
+    final_state = DCmdAsyncJob::job_failed;
+  }
+  MutexLocker ml(DCmdAsyncJobs_lock, Mutex::_no_safepoint_check_flag);
+  if (job->_state == DCmdAsyncJob::job_cancelled) {
+    remove_job(job);
+    delete job;
+  } else {
+    job->_state = final_state;
+  }
+}
+
+// Starts a worker thread, following the pattern of AttachListener::init(),
+// except that failures are reported to the submitter instead of exiting.
+bool DCmdAsyncManager::spawn_worker(TRAPS) {
+  const char thread_name[] = "DCmd Async Worker";
+  Handle string = java_lang_String::create_from_str(thread_name, CHECK_false);
+
+  // Initialize thread_oop to put it into the system threadGroup
+  Handle thread_group(THREAD, Universe::system_thread_group());
+  Handle thread_oop = JavaCalls::construct_new_instance(SystemDictionary::Thread_klass(),
+                       vmSymbols::threadgroup_string_void_signature(),
+                       thread_group,
+                       string,
+                       CHECK_false);
+
+  Klass* group = SystemDictionary::ThreadGroup_klass();
+  JavaValue result(T_VOID);
+  JavaCalls::call_special(&result,
+                          thread_group,
+                          group,
+                          vmSymbols::add_method_name(),
+                          vmSymbols::thread_void_signature(),
+                          thread_oop,
+                          CHECK_false);
+
+  { MutexLocker mu(Threads_lock);
+    JavaThread* worker = new JavaThread(&worker_entry);
+
+    // Check that thread and osthread were created
+    if (worker == NULL || worker->osthread() == NULL) {
+      delete worker;
+      return false;
+    }
+
+    java_lang_Thread::set_thread(thread_oop(), worker);
+    java_lang_Thread::set_daemon(thread_oop());
+
+    worker->set_threadObj(thread_oop());
+    Threads::add(worker);
+    Thread::start(worker);
+  }
+  return true;
+}
+
+void DCmdAsyncManager::start_job(DCmdSource source, const char* cmdline, outputStream* out, TRAPS) {
+  if (cmdline == NULL || cmdline[0] == '\0') {
+    out->print_cr("No command specified");
+    return;
+  }
+  DCmdAsyncJob* const job = new DCmdAsyncJob(source, cmdline);
+  {
+    MutexLocker ml(DCmdAsyncJobs_lock, Mutex::_no_safepoint_check_flag);
+    job->_id = _next_id++;
+    job->_next = _jobs;
+    _jobs = job;
+  }
+  if (!spawn_worker(THREAD)) {
+    // A concurrently started worker may already have claimed this job, but
+    // then some pending job is left without a worker; dropping any pending
+    // job keeps workers and pending jobs balanced.
+    MutexLocker ml(DCmdAsyncJobs_lock, Mutex::_no_safepoint_check_flag);
+    for (DCmdAsyncJob* victim = _jobs; victim != NULL; victim = victim->_next) {
+      if (victim->_state == DCmdAsyncJob::job_pending) {
+        remove_job(victim);
+        delete victim;
+        break;
+      }
+    }
+    if (!HAS_PENDING_EXCEPTION) {
+      out->print_cr("Could not start a worker thread");
+    }
+    return;
+  }
+  out->print_cr("Started job %d: %s", job->id(), job->cmdline());
+  out->print_cr("Use Async.jobs to follow it and Async.result %d to retrieve the output", job->id());
+}
+
+void DCmdAsyncManager::list_jobs(outputStream* out) {
+  MutexLocker ml(DCmdAsyncJobs_lock, Mutex::_no_safepoint_check_flag);
+  if (_jobs == NULL) {
+    out->print_cr("No asynchronous jobs");
+    return;
+  }
+  const jlong now = os::javaTimeMillis();
+  for (DCmdAsyncJob* job = _jobs; job != NULL; job = job->_next) {
+    out->print_cr("%4d %-9s %8.3fs %s", job->_id, job->state_name(),
+                  (double)(now - job->_start_time) / 1000.0, job->_cmdline);
+  }
+}
+
+void DCmdAsyncManager::print_job(int id, outputStream* out) {
+  DCmdAsyncJob* job_to_delete = NULL;
+  {
+    MutexLocker ml(DCmdAsyncJobs_lock, Mutex::_no_safepoint_check_flag);
+    DCmdAsyncJob* const job = find_job(id);
+    if (job == NULL) {
+      out->print_cr("Job %d not found", id);
+      return;
+    }
+    if (job->_state == DCmdAsyncJob::job_pending ||
+        job->_state == DCmdAsyncJob::job_running ||
+        job->_state == DCmdAsyncJob::job_cancelled) {
+      out->print_cr("Job %d is still %s", id, job->state_name());
+      return;
+    }
+    out->print_raw(job->_output.base(), (int)job->_output.size());
+    remove_job(job);
+    job_to_delete = job;
+  }
+  delete job_to_delete;
+}
+
+void DCmdAsyncManager::cancel_job(int id, outputStream* out) {
+  DCmdAsyncJob* job_to_delete = NULL;
+  {
+    MutexLocker ml(DCmdAsyncJobs_lock, Mutex::_no_safepoint_check_flag);
+    DCmdAsyncJob* const job = find_job(id);
+    if (job == NULL) {
+      out->print_cr("Job %d not found", id);
+      return;
+    }
+    switch (job->_state) {
+      case DCmdAsyncJob::job_pending:
+        remove_job(job);
+        job_to_delete = job;
+        out->print_cr("Job %d cancelled", id);
+        break;
+      case DCmdAsyncJob::job_running:
+        // A running command cannot be interrupted; mark the job so that it
+        // is discarded when the command completes.
+        job->_state = DCmdAsyncJob::job_cancelled;
+        out->print_cr("Job %d cancelled; the running command cannot be "
+                      "interrupted and its output will be discarded", id);
+        break;
+      case DCmdAsyncJob::job_cancelled:
+        out->print_cr("Job %d is already cancelled", id);
+        break;
+      default:
+        // completed or failed; cancelling just discards the result
+        remove_job(job);
+        job_to_delete = job;
+        out->print_cr("Job %d removed", id);
+        break;
+    }
+  }
+  delete job_to_delete;
+}
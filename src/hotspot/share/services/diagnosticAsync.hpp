@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_SERVICES_DIAGNOSTICASYNC_HPP
+#define SHARE_SERVICES_DIAGNOSTICASYNC_HPP
+
+#include "memory/allocation.hpp"
+#include "services/diagnosticFramework.hpp"
+#include "utilities/ostream.hpp"
+
+// Asynchronous execution of diagnostic commands. A job wraps a command line
+// submitted with Async.start; it is picked up by a dedicated worker thread
+// so that a long-running command does not block the attach listener thread
+// for subsequent attach requests. The output of a job is collected in the
+// job itself and retrieved with Async.result once it has completed, because
+// an attach operation is completed with a single response and cannot stream
+// the output of a still running command back over the originating
+// connection.
+class DCmdAsyncJob : public CHeapObj<mtInternal> {
+  friend class DCmdAsyncManager;
+ public:
+  enum JobState {
+    job_pending,    // submitted, not yet picked up by a worker
+    job_running,
+    job_completed,
+    job_failed,     // the command completed with a pending exception
+    job_cancelled   // cancelled while running; removed when it completes
+  };
+ private:
+  int _id;
+  char* _cmdline;
+  DCmdSource _source;
+  volatile JobState _state;
+  jlong _start_time;
+  bufferedStream _output;
+  DCmdAsyncJob* _next;
+
+  DCmdAsyncJob(DCmdSource source, const char* cmdline);
+  ~DCmdAsyncJob();
+ public:
+  int id() const              { return _id; }
+  const char* cmdline() const { return _cmdline; }
+  JobState state() const      { return _state; }
+  const char* state_name() const;
+};
+
+// The list of jobs, guarded by DCmdAsyncJobs_lock. One worker thread is
+// started per submitted job and claims the oldest pending job, so workers
+// and pending jobs always balance out.
+class DCmdAsyncManager : public AllStatic {
+ private:
+  static DCmdAsyncJob* _jobs;
+  static int _next_id;
+
+  static DCmdAsyncJob* find_job(int id);
+  static void remove_job(DCmdAsyncJob* job);
+  static DCmdAsyncJob* claim_pending_job();
+  static void worker_entry(JavaThread* thread, TRAPS);
+  static bool spawn_worker(TRAPS);
+ public:
+  static void start_job(DCmdSource source, const char* cmdline, outputStream* out, TRAPS);
+  static void list_jobs(outputStream* out);
+  static void print_job(int id, outputStream* out);
+  static void cancel_job(int id, outputStream* out);
+};
+
+#endif // SHARE_SERVICES_DIAGNOSTICASYNC_HPP
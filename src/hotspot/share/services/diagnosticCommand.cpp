@@ -40,8 +40,10 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaCalls.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "services/diagnosticArgument.hpp"
+#include "services/diagnosticAsync.hpp"
 #include "services/diagnosticCommand.hpp"
 #include "services/diagnosticFramework.hpp"
 #include "services/heapDumper.hpp"
@@ -112,6 +114,7 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeCacheDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<TouchedMethodsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeHeapAnalyticsDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<NativeLockStatsDCmd>(full_export, true, false));
 
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesPrintDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesAddDCmd>(full_export, true, false));
@@ -132,6 +135,13 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<DebugOnCmdStartDCmd>(full_export, true, false));
 #endif // INCLUDE_JVMTI
 
+  // Asynchronous diagnostic command execution. Async.start takes a raw
+  // command line, so it is not exported via the DiagnosticCommandMBean.
+  uint32_t async_export_flags = DCmd_Source_Internal | DCmd_Source_AttachAPI;
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<AsyncStartDCmd>(async_export_flags, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<AsyncJobsDCmd>(async_export_flags, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<AsyncResultDCmd>(async_export_flags, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<AsyncCancelDCmd>(async_export_flags, true, false));
 }
 
 #ifndef HAVE_EXTRA_DCMD
@@ -1110,6 +1120,10 @@ int TouchedMethodsDCmd::num_arguments() {
   return 0;
 }
 
+void NativeLockStatsDCmd::execute(DCmdSource source, TRAPS) {
+  print_lock_contention_counts(output());
+}
+
 #if INCLUDE_JVMTI
 extern "C" typedef char const* (JNICALL *debugInit_startDebuggingViaCommandPtr)(JNIEnv* env, jthread thread, char const** transport_name,
                                                                                 char const** address, jboolean* first_start);
@@ -1149,3 +1163,60 @@ void DebugOnCmdStartDCmd::execute(DCmdSource source, TRAPS) {
   }
 }
 #endif // INCLUDE_JVMTI
+
+void AsyncStartDCmd::parse(CmdLine* line, char delim, TRAPS) {
+  // The whole argument list is the command line to be started; keep it
+  // verbatim instead of running it through a parser.
+  char* cmd = NEW_RESOURCE_ARRAY(char, line->args_len() + 1);
+  memcpy(cmd, line->args_addr(), line->args_len());
+  cmd[line->args_len()] = '\0';
+  _cmdline = cmd;
+}
+
+void AsyncStartDCmd::execute(DCmdSource source, TRAPS) {
+  DCmdAsyncManager::start_job(source, _cmdline, output(), CHECK);
+}
+
+void AsyncJobsDCmd::execute(DCmdSource source, TRAPS) {
+  DCmdAsyncManager::list_jobs(output());
+}
+
+AsyncResultDCmd::AsyncResultDCmd(outputStream* output, bool heap) : DCmdWithParser(output, heap),
+  _id("id", "The job id as reported by Async.start", "INT", true) {
+  _dcmdparser.add_dcmd_argument(&_id);
+}
+
+void AsyncResultDCmd::execute(DCmdSource source, TRAPS) {
+  DCmdAsyncManager::print_job((int)_id.value(), output());
+}
+
+int AsyncResultDCmd::num_arguments() {
+  ResourceMark rm;
+  AsyncResultDCmd* dcmd = new AsyncResultDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
+AsyncCancelDCmd::AsyncCancelDCmd(outputStream* output, bool heap) : DCmdWithParser(output, heap),
+  _id("id", "The job id as reported by Async.start", "INT", true) {
+  _dcmdparser.add_dcmd_argument(&_id);
+}
+
+void AsyncCancelDCmd::execute(DCmdSource source, TRAPS) {
+  DCmdAsyncManager::cancel_job((int)_id.value(), output());
+}
+
+int AsyncCancelDCmd::num_arguments() {
+  ResourceMark rm;
+  AsyncCancelDCmd* dcmd = new AsyncCancelDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
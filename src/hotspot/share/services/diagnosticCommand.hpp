@@ -441,6 +441,22 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class NativeLockStatsDCmd : public DCmd {
+public:
+  NativeLockStatsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() {
+    return "VM.native_lock_stats";
+  }
+  static const char* description() {
+    return "Print contention counts of the named VM-internal mutexes and monitors.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 // See also: thread_dump in attachListener.cpp
 class ThreadDumpDCmd : public DCmdWithParser {
 protected:
@@ -912,4 +928,88 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+// Asynchronous diagnostic command execution (see diagnosticAsync.hpp)
+class AsyncStartDCmd : public DCmd {
+private:
+  const char* _cmdline;
+public:
+  AsyncStartDCmd(outputStream* output, bool heap) : DCmd(output, heap), _cmdline(NULL) { }
+  static const char* name() { return "Async.start"; }
+  static const char* description() {
+    return "Start a diagnostic command asynchronously on a worker thread, "
+           "so that the attach listener stays available while it runs.";
+  }
+  static const char* impact() {
+    return "Low: The impact of the started command applies.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "control", NULL};
+    return p;
+  }
+  static int num_arguments() { return 0; }
+  virtual void print_help(const char* name) const {
+    output()->print_cr("Syntax: %s <command line>", name);
+  }
+  virtual void parse(CmdLine* line, char delim, TRAPS);
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class AsyncJobsDCmd : public DCmd {
+public:
+  AsyncJobsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "Async.jobs"; }
+  static const char* description() {
+    return "Print the asynchronously started diagnostic commands and their states.";
+  }
+  static const char* impact() { return "Low"; }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class AsyncResultDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<jlong> _id;
+public:
+  AsyncResultDCmd(outputStream* output, bool heap);
+  static const char* name() { return "Async.result"; }
+  static const char* description() {
+    return "Print the output of a completed asynchronous diagnostic command "
+           "and remove the job.";
+  }
+  static const char* impact() { return "Low"; }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class AsyncCancelDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<jlong> _id;
+public:
+  AsyncCancelDCmd(outputStream* output, bool heap);
+  static const char* name() { return "Async.cancel"; }
+  static const char* description() {
+    return "Cancel a pending asynchronous diagnostic command, or discard the "
+           "result of a running or completed one.";
+  }
+  static const char* impact() { return "Low"; }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "control", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 #endif // SHARE_SERVICES_DIAGNOSTICCOMMAND_HPP
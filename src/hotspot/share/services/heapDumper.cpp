@@ -30,8 +30,10 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/gcLocker.hpp"
 #include "gc/shared/gcVMOperations.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -43,6 +45,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.inline.hpp"
 #include "runtime/reflectionUtils.hpp"
 #include "runtime/thread.inline.hpp"
@@ -381,10 +384,12 @@ enum {
 class DumpWriter : public StackObj {
  private:
   enum {
-    io_buffer_size  = 8*M
+    io_buffer_size        = 8*M,
+    in_memory_buffer_size = 1*M
   };
 
   int _fd;              // file descriptor (-1 if dump file not open)
+  bool _in_memory;      // buffer-only writer, used by the parallel heap dump workers
   julong _bytes_written; // number of byte written to dump file
 
   char* _buffer;    // internal buffer
@@ -403,15 +408,23 @@ class DumpWriter : public StackObj {
   size_t position() const                       { return _pos; }
   void set_position(size_t pos)                 { _pos = pos; }
 
-  void set_error(const char* error)             { _error = (char*)os::strdup(error); }
-
   // all I/O go through this function
   void write_internal(void* s, size_t len);
 
  public:
   DumpWriter(const char* path);
+  // creates an in-memory writer: nothing is written to a file, the contents
+  // are retrieved with data()/data_size() and discarded with reset_data()
+  DumpWriter();
   ~DumpWriter();
 
+  // access to the contents of an in-memory writer
+  char* data() const                    { assert(_in_memory, "in-memory writers only"); return _buffer; }
+  size_t data_size() const              { assert(_in_memory, "in-memory writers only"); return _pos; }
+  void reset_data()                     { assert(_in_memory, "in-memory writers only"); _pos = 0; }
+
+  void set_error(const char* error)     { _error = (char*)os::strdup(error); }
+
   void close();
   bool is_open() const                  { return file_descriptor() >= 0; }
   void flush();
@@ -459,6 +472,7 @@ DumpWriter::DumpWriter(const char* path) {
   } while (_buffer == NULL && _size > 0);
   assert((_size > 0 && _buffer != NULL) || (_size == 0 && _buffer == NULL), "sanity check");
   _pos = 0;
+  _in_memory = false;
   _error = NULL;
   _bytes_written = 0L;
   _dump_start = (jlong)-1;
@@ -470,6 +484,21 @@ DumpWriter::DumpWriter(const char* path) {
   }
 }
 
+DumpWriter::DumpWriter() {
+  _size = in_memory_buffer_size;
+  _buffer = (char*)os::malloc(_size, mtInternal);
+  _pos = 0;
+  _in_memory = true;
+  _error = NULL;
+  _bytes_written = 0L;
+  _dump_start = (jlong)-1;
+  _fd = -1;
+  if (_buffer == NULL) {
+    _size = 0;
+    set_error("Insufficient memory for in-memory dump writer");
+  }
+}
+
 DumpWriter::~DumpWriter() {
   // flush and close dump file
   if (is_open()) {
@@ -531,6 +560,27 @@ void DumpWriter::write_internal(void* s, size_t len) {
 
 // write raw bytes
 void DumpWriter::write_raw(void* s, size_t len) {
+  if (_in_memory) {
+    if (_error != NULL) {
+      // drop further writes after an allocation failure; the buffer contents
+      // are discarded by the parallel dump task when an error is set
+      return;
+    }
+    if (position() + len > buffer_size()) {
+      size_t new_size = MAX2(buffer_size() * 2, position() + len);
+      char* new_buffer = (char*)os::realloc(_buffer, new_size, mtInternal);
+      if (new_buffer == NULL) {
+        set_error("Insufficient memory while writing heap dump segment");
+        return;
+      }
+      _buffer = new_buffer;
+      _size = new_size;
+    }
+    memcpy(buffer() + position(), s, len);
+    set_position(position() + len);
+    return;
+  }
+
   if (is_open()) {
     // flush buffer to make room
     if ((position() + len) >= buffer_size()) {
@@ -1442,6 +1492,112 @@ void HeapObjectDumper::do_object(oop o) {
   }
 }
 
+// Task for dumping the objects of the heap with a gang of workers. The heap
+// is partitioned by a ParallelObjectIterator; each worker serializes the
+// objects it claims into a private in-memory DumpWriter and publishes the
+// contents as complete HPROF_HEAP_DUMP_SEGMENT records to the file writer
+// under a lock, so segments from different workers never interleave. The
+// caller must have closed any open dump record on the file writer before
+// running the task.
+class ParHeapObjectDumpTask : public AbstractGangTask {
+ private:
+  enum {
+    // publish a worker's segment once it exceeds this size, to bound the
+    // per-worker memory and keep the file writer's I/O going
+    segment_flush_threshold = 1*M
+  };
+
+  ParallelObjectIterator* _poi;
+  DumpWriter* _file_writer;
+  Mutex _lock;
+  volatile bool _failed;
+
+ public:
+  ParHeapObjectDumpTask(ParallelObjectIterator* poi, DumpWriter* file_writer) :
+      AbstractGangTask("Parallel heap object dump"),
+      _poi(poi),
+      _file_writer(file_writer),
+      _lock(Mutex::leaf, "ParHeapObjectDumpTask_lock", true, Monitor::_safepoint_check_never),
+      _failed(false) {}
+
+  bool failed() const { return _failed; }
+  void set_failed()   { _failed = true; }
+
+  bool should_flush_segment(DumpWriter* segment_writer) {
+    return segment_writer->data_size() > (size_t)segment_flush_threshold;
+  }
+
+  // writes the contents of an in-memory writer to the file as one
+  // HPROF_HEAP_DUMP_SEGMENT record; the length is known up front so no
+  // fix-up of the record header is needed
+  void flush_segment(DumpWriter* segment_writer) {
+    size_t len = segment_writer->data_size();
+    if (len == 0 || segment_writer->error() != NULL) {
+      // an errored buffer may end with a truncated sub-record; discard it
+      return;
+    }
+    if (len > max_juint) {
+      warning("record is too large");
+    }
+    MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
+    _file_writer->write_u1(HPROF_HEAP_DUMP_SEGMENT);
+    _file_writer->write_u4(0); // current ticks
+    _file_writer->write_u4((u4)len);
+    _file_writer->write_raw(segment_writer->data(), len);
+    segment_writer->reset_data();
+  }
+
+  virtual void work(uint worker_id);
+};
+
+// Object closure used by the parallel dump workers. The same objects are
+// skipped and the same sub-records are emitted as by HeapObjectDumper, but
+// the records go to a worker-private in-memory writer.
+class ParHeapObjectDumper : public ObjectClosure {
+ private:
+  ParHeapObjectDumpTask* _task;
+  DumpWriter* _writer;   // in-memory writer of this worker
+
+ public:
+  ParHeapObjectDumper(ParHeapObjectDumpTask* task, DumpWriter* writer) :
+      _task(task), _writer(writer) {}
+
+  void do_object(oop o) {
+    // skip classes as these emitted as HPROF_GC_CLASS_DUMP records
+    if (o->klass() == SystemDictionary::Class_klass()) {
+      if (!java_lang_Class::is_primitive(o)) {
+        return;
+      }
+    }
+
+    if (o->is_instance()) {
+      DumperSupport::dump_instance(_writer, o);
+    } else if (o->is_objArray()) {
+      DumperSupport::dump_object_array(_writer, objArrayOop(o));
+    } else if (o->is_typeArray()) {
+      DumperSupport::dump_prim_array(_writer, typeArrayOop(o));
+    } else {
+      return;
+    }
+    // on a sub-record boundary: publish the segment once it is large enough
+    if (_task->should_flush_segment(_writer)) {
+      _task->flush_segment(_writer);
+    }
+  }
+};
+
+void ParHeapObjectDumpTask::work(uint worker_id) {
+  DumpWriter segment_writer;   // in-memory
+  ParHeapObjectDumper obj_dumper(this, &segment_writer);
+  _poi->object_iterate(&obj_dumper, worker_id);
+  flush_segment(&segment_writer);
+  if (segment_writer.error() != NULL) {
+    // ran out of native memory; the objects this worker could not serialize
+    // are missing from the dump
+    set_failed();
+  }
+}
+
 // The VM operation that performs the heap dump
 class VM_HeapDumper : public VM_GC_Operation {
  private:
@@ -1494,6 +1650,11 @@ class VM_HeapDumper : public VM_GC_Operation {
   // HPROF_TRACE and HPROF_FRAME records
   void dump_stack_traces();
 
+  // writes the HPROF_GC_INSTANCE_DUMP etc. sub-records with a gang of
+  // workers; returns false if no gang or heap support is available and the
+  // objects must be dumped serially
+  bool dump_objects_in_parallel();
+
  public:
   VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome) :
     VM_GC_Operation(0 /* total collections,      dummy, ignored */,
@@ -1856,9 +2017,12 @@ void VM_HeapDumper::doit() {
   // to check if the current segment exceeds a threshold. If so, a new
   // segment is started.
   // The HPROF_GC_CLASS_DUMP and HPROF_GC_INSTANCE_DUMP are the vast bulk
-  // of the heap dump.
-  HeapObjectDumper obj_dumper(this, writer());
-  Universe::heap()->safe_object_iterate(&obj_dumper);
+  // of the heap dump. If the heap can partition its objects among a gang of
+  // workers they are dumped in parallel, otherwise serially here.
+  if (!dump_objects_in_parallel()) {
+    HeapObjectDumper obj_dumper(this, writer());
+    Universe::heap()->safe_object_iterate(&obj_dumper);
+  }
 
   // HPROF_GC_ROOT_THREAD_OBJ + frames + jni locals
   do_threads();
@@ -1890,6 +2054,33 @@ void VM_HeapDumper::doit() {
   clear_global_writer();
 }
 
+bool VM_HeapDumper::dump_objects_in_parallel() {
+  WorkGang* gang = Universe::heap()->get_safepoint_workers();
+  if (gang == NULL || gang->active_workers() <= 1) {
+    return false;
+  }
+  ParallelObjectIterator* poi = Universe::heap()->parallel_object_iterator(gang->active_workers());
+  if (poi == NULL) {
+    return false;
+  }
+
+  // Close the currently open dump record: the workers write their own,
+  // self-contained HPROF_HEAP_DUMP_SEGMENT records.
+  DumperSupport::write_current_dump_record_length(writer());
+
+  ParHeapObjectDumpTask task(poi, writer());
+  gang->run_task(&task);
+  delete poi;
+
+  if (task.failed()) {
+    writer()->set_error("Native memory exhausted during parallel heap dump; dump is incomplete");
+  }
+
+  // Open a new segment for the remaining (root) sub-records.
+  DumperSupport::write_dump_header(writer());
+  return true;
+}
+
 void VM_HeapDumper::dump_stack_traces() {
   // write a HPROF_TRACE record without any frames to be referenced as object alloc sites
   DumperSupport::write_header(writer(), HPROF_TRACE, 3*sizeof(u4));
@@ -33,8 +33,8 @@ MallocSiteHashtableEntry*  MallocSiteTable::_table[MallocSiteTable::table_size];
 const NativeCallStack* MallocSiteTable::_hash_entry_allocation_stack = NULL;
 const MallocSiteHashtableEntry* MallocSiteTable::_hash_entry_allocation_site = NULL;
 
-// concurrent access counter
-volatile int MallocSiteTable::_access_count = 0;
+// striped concurrent access counters
+MallocSiteTable::AccessCounter MallocSiteTable::_access_counts[MallocSiteTable::access_lock_stripes];
 
 // Tracking hashtable contention
 NOT_PRODUCT(int MallocSiteTable::_peak_count = 0;)
@@ -202,16 +202,20 @@ void MallocSiteTable::delete_linked_list(MallocSiteHashtableEntry* head) {
 }
 
 void MallocSiteTable::shutdown() {
-  AccessLock locker(&_access_count);
-  locker.exclusiveLock();
+  // Lock out every stripe; shared access is rejected forever after.
+  for (int i = 0; i < access_lock_stripes; i++) {
+    AccessLock locker(&_access_counts[i]._access_count);
+    locker.exclusiveLock();
+  }
   reset();
 }
 
 bool MallocSiteTable::walk_malloc_site(MallocSiteWalker* walker) {
   assert(walker != NULL, "NuLL walker");
-  AccessLock locker(&_access_count);
+  volatile int* const lock = access_lock();
+  AccessLock locker(lock);
   if (locker.sharedLock()) {
-    NOT_PRODUCT(_peak_count = MAX2(_peak_count, _access_count);)
+    NOT_PRODUCT(_peak_count = MAX2(_peak_count, *lock);)
     return walk(walker);
   }
   return false;
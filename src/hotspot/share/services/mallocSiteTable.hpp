@@ -165,6 +165,30 @@ class MallocSiteTable : AllStatic {
     void exclusiveLock();
  };
 
+  // The shared access counter is striped so that allocation-heavy threads
+  // do not all contend on a single cache line; every os::malloc/os::free
+  // in detail mode acquires the shared lock. The exclusive lock (shutdown
+  // only) has to acquire every stripe.
+  enum {
+    access_lock_stripes = 64
+  };
+
+  struct AccessCounter {
+    volatile int _access_count;
+    char _padding[DEFAULT_CACHE_LINE_SIZE - sizeof(int)];
+  };
+
+  // Select a stripe by the current stack address. It is cheap, usable
+  // before the thread object exists and distributes threads evenly, since
+  // thread stacks are spaced much further apart than 64K. The stripe only
+  // has to be consistent within a single AccessLock scope, which holds
+  // because AccessLock retains the pointer.
+  static inline volatile int* access_lock() {
+    int anchor;
+    const uintptr_t id = (uintptr_t)&anchor >> 16;
+    return &_access_counts[id % access_lock_stripes]._access_count;
+  }
+
  public:
   static bool initialize();
   static void shutdown();
@@ -178,9 +202,10 @@ class MallocSiteTable : AllStatic {
   // acquired before access the entry.
   static inline bool access_stack(NativeCallStack& stack, size_t bucket_idx,
     size_t pos_idx) {
-    AccessLock locker(&_access_count);
+    volatile int* const lock = access_lock();
+    AccessLock locker(lock);
     if (locker.sharedLock()) {
-      NOT_PRODUCT(_peak_count = MAX2(_peak_count, _access_count);)
+      NOT_PRODUCT(_peak_count = MAX2(_peak_count, *lock);)
       MallocSite* site = malloc_site(bucket_idx, pos_idx);
       if (site != NULL) {
         stack = *site->call_stack();
@@ -199,9 +224,10 @@ class MallocSiteTable : AllStatic {
   //  2. overflow hash bucket
   static inline bool allocation_at(const NativeCallStack& stack, size_t size,
     size_t* bucket_idx, size_t* pos_idx, MEMFLAGS flags) {
-    AccessLock locker(&_access_count);
+    volatile int* const lock = access_lock();
+    AccessLock locker(lock);
     if (locker.sharedLock()) {
-      NOT_PRODUCT(_peak_count = MAX2(_peak_count, _access_count);)
+      NOT_PRODUCT(_peak_count = MAX2(_peak_count, *lock);)
       MallocSite* site = lookup_or_add(stack, bucket_idx, pos_idx, flags);
       if (site != NULL) site->allocate(size);
       return site != NULL;
@@ -212,9 +238,10 @@ class MallocSiteTable : AllStatic {
   // Record memory deallocation. bucket_idx and pos_idx indicate where the allocation
   // information was recorded.
   static inline bool deallocation_at(size_t size, size_t bucket_idx, size_t pos_idx) {
-    AccessLock locker(&_access_count);
+    volatile int* const lock = access_lock();
+    AccessLock locker(lock);
     if (locker.sharedLock()) {
-      NOT_PRODUCT(_peak_count = MAX2(_peak_count, _access_count);)
+      NOT_PRODUCT(_peak_count = MAX2(_peak_count, *lock);)
       MallocSite* site = malloc_site(bucket_idx, pos_idx);
       if (site != NULL) {
         site->deallocate(size);
@@ -253,8 +280,8 @@ class MallocSiteTable : AllStatic {
   }
 
  private:
-  // Counter for counting concurrent access
-  static volatile int                _access_count;
+  // Striped counters for counting concurrent access
+  static AccessCounter               _access_counts[access_lock_stripes];
 
   // The callsite hashtable. It has to be a static table,
   // since malloc call can come from C runtime linker.
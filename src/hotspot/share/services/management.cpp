@@ -1002,6 +1002,22 @@ JVM_ENTRY(jint, jmm_GetLongAttributes(JNIEnv *env,
   return num_atts;
 JVM_END
 
+// Helper function to resolve an array of thread IDs in one sweep over the
+// threads list, instead of one list scan per id. Entries of threads that do
+// not exist or have terminated are NULL. Allocates in the resource area, so
+// the caller is responsible for a ResourceMark.
+static JavaThread** tids_to_JavaThreads(ThreadsList* t_list,
+                                        typeArrayHandle ids_ah, // array of thread ID (long[])
+                                        int num_threads) {
+  jlong* tids = NEW_RESOURCE_ARRAY(jlong, num_threads);
+  for (int i = 0; i < num_threads; i++) {
+    tids[i] = ids_ah->long_at(i);
+  }
+  JavaThread** threads = NEW_RESOURCE_ARRAY(JavaThread*, num_threads);
+  t_list->find_JavaThreads_from_java_tids(tids, num_threads, threads);
+  return threads;
+}
+
 // Helper function to do thread dump for a specific list of threads
 static void do_thread_dump(ThreadDumpResult* dump_result,
                            typeArrayHandle ids_ah,  // array of thread ID (long[])
@@ -1022,9 +1038,9 @@ static void do_thread_dump(ThreadDumpResult* dump_result,
     // threadObj handles; dump_result->set_t_list() is called in the
     // VM op below so we can't use it yet.
     ThreadsListHandle tlh;
+    JavaThread** threads = tids_to_JavaThreads(tlh.list(), ids_ah, num_threads);
     for (int i = 0; i < num_threads; i++) {
-      jlong tid = ids_ah->long_at(i);
-      JavaThread* jt = tlh.list()->find_JavaThread_from_java_tid(tid);
+      JavaThread* jt = threads[i];
       oop thread_obj = (jt != NULL ? jt->threadObj() : (oop)NULL);
       instanceHandle threadObj_h(THREAD, (instanceOop) thread_obj);
       thread_handle_array->append(threadObj_h);
@@ -1096,9 +1112,9 @@ JVM_ENTRY(jint, jmm_GetThreadInfo(JNIEnv *env, jlongArray ids, jint maxDepth, jo
     // No stack trace to dump so we do not need to stop the world.
     // Since we never do the VM op here we must set the threads list.
     dump_result.set_t_list();
+    JavaThread** threads = tids_to_JavaThreads(dump_result.t_list(), ids_ah, num_threads);
     for (int i = 0; i < num_threads; i++) {
-      jlong tid = ids_ah->long_at(i);
-      JavaThread* jt = dump_result.t_list()->find_JavaThread_from_java_tid(tid);
+      JavaThread* jt = threads[i];
       if (jt == NULL) {
         // if the thread does not exist or now it is terminated,
         // create dummy snapshot
@@ -2099,10 +2115,10 @@ JVM_ENTRY(void, jmm_GetThreadAllocatedMemory(JNIEnv *env, jlongArray ids,
   }
 
   ThreadsListHandle tlh;
+  JavaThread** threads = tids_to_JavaThreads(tlh.list(), ids_ah, num_threads);
   for (int i = 0; i < num_threads; i++) {
-    JavaThread* java_thread = tlh.list()->find_JavaThread_from_java_tid(ids_ah->long_at(i));
-    if (java_thread != NULL) {
-      sizeArray_h->long_at_put(i, java_thread->cooked_allocated_bytes());
+    if (threads[i] != NULL) {
+      sizeArray_h->long_at_put(i, threads[i]->cooked_allocated_bytes());
     }
   }
 JVM_END
@@ -2170,10 +2186,10 @@ JVM_ENTRY(void, jmm_GetThreadCpuTimesWithKind(JNIEnv *env, jlongArray ids,
   }
 
   ThreadsListHandle tlh;
+  JavaThread** threads = tids_to_JavaThreads(tlh.list(), ids_ah, num_threads);
   for (int i = 0; i < num_threads; i++) {
-    JavaThread* java_thread = tlh.list()->find_JavaThread_from_java_tid(ids_ah->long_at(i));
-    if (java_thread != NULL) {
-      timeArray_h->long_at_put(i, os::thread_cpu_time((Thread*)java_thread,
+    if (threads[i] != NULL) {
+      timeArray_h->long_at_put(i, os::thread_cpu_time((Thread*)threads[i],
                                                       user_sys_cpu_time != 0));
     }
   }
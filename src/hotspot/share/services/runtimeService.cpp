@@ -39,6 +39,7 @@ PerfCounter*  RuntimeService::_sync_time_ticks = NULL;
 PerfCounter*  RuntimeService::_total_safepoints = NULL;
 PerfCounter*  RuntimeService::_safepoint_time_ticks = NULL;
 PerfCounter*  RuntimeService::_application_time_ticks = NULL;
+PerfVariable* RuntimeService::_last_straggler_time = NULL;
 
 void RuntimeService::init() {
   if (UsePerfData) {
@@ -60,6 +61,10 @@ void RuntimeService::init() {
               PerfDataManager::create_counter(SUN_RT, "applicationTime",
                                               PerfData::U_Ticks, CHECK);
 
+    _last_straggler_time =
+              PerfDataManager::create_variable(SUN_RT, "lastSafepointStragglerTime",
+                                               PerfData::U_Ticks, CHECK);
+
 
     // create performance counters for jvm_version and its capabilities
     PerfDataManager::create_constant(SUN_RT, "jvmVersion", PerfData::U_None,
@@ -95,6 +100,12 @@ void RuntimeService::record_safepoint_synchronized(jlong sync_ticks) {
   }
 }
 
+void RuntimeService::record_safepoint_straggler(jlong latency_ticks) {
+  if (UsePerfData) {
+    _last_straggler_time->set_value(latency_ticks);
+  }
+}
+
 void RuntimeService::record_safepoint_end(jlong safepoint_ticks) {
   HS_PRIVATE_SAFEPOINT_END();
   if (UsePerfData) {
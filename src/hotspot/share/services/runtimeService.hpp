@@ -34,6 +34,7 @@ private:
   static PerfCounter* _total_safepoints;
   static PerfCounter* _safepoint_time_ticks;   // Accumulated time at safepoints
   static PerfCounter* _application_time_ticks; // Accumulated time not at safepoints
+  static PerfVariable* _last_straggler_time;   // Poll latency of the last thread to reach the most recent safepoint
 
 public:
   static void init();
@@ -47,6 +48,7 @@ public:
   static void record_safepoint_begin(jlong app_ticks) NOT_MANAGEMENT_RETURN;
   static void record_safepoint_synchronized(jlong sync_ticks) NOT_MANAGEMENT_RETURN;
   static void record_safepoint_end(jlong safepoint_ticks) NOT_MANAGEMENT_RETURN;
+  static void record_safepoint_straggler(jlong latency_ticks) NOT_MANAGEMENT_RETURN;
 };
 
 #endif // SHARE_SERVICES_RUNTIMESERVICE_HPP
@@ -29,6 +29,7 @@
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/copy.hpp"
 #include "utilities/debug.hpp"
+#include "utilities/population_count.hpp"
 
 STATIC_ASSERT(sizeof(BitMap::bm_word_t) == BytesPerWord); // "Implementation assumption."
 
@@ -611,70 +612,67 @@ void BitMap::clear_large() {
 // interval [leftOffset, rightOffset) is right open.
 bool BitMap::iterate(BitMapClosure* blk, idx_t leftOffset, idx_t rightOffset) {
   verify_range(leftOffset, rightOffset);
-
-  idx_t startIndex = word_index(leftOffset);
-  idx_t endIndex   = MIN2(word_index(rightOffset) + 1, size_in_words());
-  for (idx_t index = startIndex, offset = leftOffset;
-       offset < rightOffset && index < endIndex;
-       offset = (++index) << LogBitsPerWord) {
-    idx_t rest = map(index) >> (offset & (BitsPerWord - 1));
-    for (; offset < rightOffset && rest != 0; offset++) {
-      if (rest & 1) {
-        if (!blk->do_bit(offset)) return false;
-        //  resample at each closure application
-        // (see, for instance, CMS bug 4525989)
-        rest = map(index) >> (offset & (BitsPerWord -1));
-      }
-      rest = rest >> 1;
+  // The bit search resamples the map on every iteration, so modifications
+  // by the closure to the right of the current bit are seen
+  // (see, for instance, CMS bug 4525989).
+  for (idx_t offset = get_next_one_offset(leftOffset, rightOffset);
+       offset < rightOffset;
+       offset = get_next_one_offset(offset + 1, rightOffset)) {
+    if (!blk->do_bit(offset)) {
+      return false;
     }
   }
   return true;
 }
 
-const BitMap::idx_t* BitMap::_pop_count_table = NULL;
-
-void BitMap::init_pop_count_table() {
-  if (_pop_count_table == NULL) {
-    BitMap::idx_t *table = NEW_C_HEAP_ARRAY(idx_t, 256, mtInternal);
-    for (uint i = 0; i < 256; i++) {
-      table[i] = num_set_bits(i);
-    }
+// Casting keeps overload resolution exact regardless of how uintptr_t is
+// defined on the platform.
+static BitMap::idx_t count_bits_in_word(BitMap::bm_word_t w) {
+#ifdef _LP64
+  return (BitMap::idx_t)population_count((uint64_t)w);
+#else
+  return (BitMap::idx_t)population_count((uint32_t)w);
+#endif
+}
 
-    if (!Atomic::replace_if_null(table, &_pop_count_table)) {
-      guarantee(_pop_count_table != NULL, "invariant");
-      FREE_C_HEAP_ARRAY(idx_t, table);
-    }
+BitMap::idx_t BitMap::count_one_bits_within_word(idx_t beg, idx_t end) const {
+  if (beg != end) {
+    assert(end > beg, "no inverted range");
+    bm_word_t mask = ~inverted_bit_mask_for_range(beg, end);
+    return count_bits_in_word(map(word_index(beg)) & mask);
   }
+  return 0;
 }
 
-BitMap::idx_t BitMap::num_set_bits(bm_word_t w) {
-  idx_t bits = 0;
-
-  while (w != 0) {
-    while ((w & 1) == 0) {
-      w >>= 1;
-    }
-    bits++;
-    w >>= 1;
+BitMap::idx_t BitMap::count_one_bits_in_range_of_words(idx_t beg_full_word, idx_t end_full_word) const {
+  idx_t sum = 0;
+  for (idx_t i = beg_full_word; i < end_full_word; i++) {
+    sum += count_bits_in_word(map(i));
   }
-  return bits;
+  return sum;
 }
 
-BitMap::idx_t BitMap::num_set_bits_from_table(unsigned char c) {
-  assert(_pop_count_table != NULL, "precondition");
-  return _pop_count_table[c];
+BitMap::idx_t BitMap::count_one_bits() const {
+  return count_one_bits(0, size());
 }
 
-BitMap::idx_t BitMap::count_one_bits() const {
-  init_pop_count_table(); // If necessary.
+BitMap::idx_t BitMap::count_one_bits(idx_t beg, idx_t end) const {
+  verify_range(beg, end);
+
+  idx_t beg_full_word = word_index_round_up(beg);
+  idx_t end_full_word = word_index(end);
+
   idx_t sum = 0;
-  typedef unsigned char uchar;
-  for (idx_t i = 0; i < size_in_words(); i++) {
-    bm_word_t w = map()[i];
-    for (size_t j = 0; j < sizeof(bm_word_t); j++) {
-      sum += num_set_bits_from_table(uchar(w & 255));
-      w >>= 8;
-    }
+  if (beg_full_word < end_full_word) {
+    // The range includes at least one full word.
+    sum += count_one_bits_within_word(beg, bit_index(beg_full_word));
+    sum += count_one_bits_in_range_of_words(beg_full_word, end_full_word);
+    sum += count_one_bits_within_word(bit_index(end_full_word), end);
+  } else {
+    // The range spans at most 2 partial words.
+    idx_t boundary = MIN2(bit_index(beg_full_word), end);
+    sum += count_one_bits_within_word(beg, boundary);
+    sum += count_one_bits_within_word(boundary, end);
   }
   return sum;
 }
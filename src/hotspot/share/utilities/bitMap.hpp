@@ -126,16 +126,16 @@ class BitMap {
   // The index of the first full word in a range.
   idx_t word_index_round_up(idx_t bit) const;
 
+  // The number of bits set within a range contained in a single word.
+  idx_t count_one_bits_within_word(idx_t beg, idx_t end) const;
+
+  // The number of bits set in a range of entire words.
+  idx_t count_one_bits_in_range_of_words(idx_t beg_full_word, idx_t end_full_word) const;
+
   // Verification.
   void verify_index(idx_t index) const NOT_DEBUG_RETURN;
   void verify_range(idx_t beg_index, idx_t end_index) const NOT_DEBUG_RETURN;
 
-  // Statistics.
-  static const idx_t* _pop_count_table;
-  static void init_pop_count_table();
-  static idx_t num_set_bits(bm_word_t w);
-  static idx_t num_set_bits_from_table(unsigned char c);
-
   // Allocation Helpers.
 
   // Allocates and clears the bitmap memory.
@@ -282,6 +282,9 @@ class BitMap {
   // Returns the number of bits set in the bitmap.
   idx_t count_one_bits() const;
 
+  // Returns the number of bits set within [beg, end).
+  idx_t count_one_bits(idx_t beg, idx_t end) const;
+
   // Set operations.
   void set_union(const BitMap& bits);
   void set_difference(const BitMap& bits);
@@ -414,6 +414,16 @@ class ConcurrentHashTable : public CHeapObj<F> {
     return internal_insert(thread, lookup_f, value, grow_hint, clean_hint);
   }
 
+  // Inserts len values, amortizing one critical section over the whole
+  // batch instead of entering one per value. lookup_fs[i] must match
+  // values[i]. Values whose bucket could not be claimed in a pass, because
+  // the bucket was locked or the insert raced, are retried in a later pass
+  // outside the critical section. Duplicates are not inserted. Returns the
+  // number of values inserted.
+  template <typename LOOKUP_FUNC>
+  size_t bulk_insert(Thread* thread, LOOKUP_FUNC* lookup_fs, const VALUE* values,
+                     size_t len, bool* grow_hint = NULL);
+
   // This does a fast unsafe insert and can thus only be used when there is no
   // risk for a duplicates and no other threads uses this table.
   bool unsafe_insert(const VALUE& value);
@@ -945,6 +945,70 @@ inline bool ConcurrentHashTable<VALUE, CONFIG, F>::
   return ret;
 }
 
+template <typename VALUE, typename CONFIG, MEMFLAGS F>
+template <typename LOOKUP_FUNC>
+inline size_t ConcurrentHashTable<VALUE, CONFIG, F>::
+  bulk_insert(Thread* thread, LOOKUP_FUNC* lookup_fs, const VALUE* values,
+              size_t len, bool* grow_hint)
+{
+  size_t inserted = 0;
+  size_t remaining = len;
+  bool clean = false;
+  size_t loops = 0;
+
+  // Entries are NULLed as their values are inserted or found to be duplicates.
+  Node** nodes = NEW_C_HEAP_ARRAY(Node*, len, F);
+  for (size_t i = 0; i < len; i++) {
+    nodes[i] = Node::create_node(values[i], NULL);
+  }
+
+  while (remaining > 0) {
+    size_t retry = 0;
+    {
+      ScopedCS cs(thread, this); /* protects the table/buckets */
+      for (size_t i = 0; i < len; i++) {
+        if (nodes[i] == NULL) {
+          continue;
+        }
+        uintx hash = lookup_fs[i].get_hash();
+        Bucket* bucket = get_bucket(hash);
+        Node* first_at_start = bucket->first();
+        Node* old = get_node(bucket, lookup_fs[i], &clean, &loops);
+        if (old != NULL) {
+          // There is a duplicate.
+          Node::destroy_node(nodes[i]);
+          nodes[i] = NULL;
+          continue;
+        }
+        nodes[i]->set_next(first_at_start);
+        if (bucket->cas_first(nodes[i], first_at_start)) {
+          JFR_ONLY(_stats_rate.add();)
+          nodes[i] = NULL;
+          inserted++;
+        } else {
+          // The bucket is locked by a resize or the insert raced. We must
+          // not wait for it inside the critical section - a concurrent
+          // resize waits for all critical sections to exit - so the value
+          // is retried in the next pass.
+          retry++;
+        }
+      }
+    } /* leave critical section */
+    remaining = retry;
+    if (remaining > 0) {
+      os::naked_yield();
+    }
+  }
+
+  FREE_C_HEAP_ARRAY(Node*, nodes);
+
+  if (grow_hint != NULL) {
+    *grow_hint = loops > _grow_hint;
+  }
+
+  return inserted;
+}
+
 template <typename VALUE, typename CONFIG, MEMFLAGS F>
 template <typename FUNC>
 inline bool ConcurrentHashTable<VALUE, CONFIG, F>::
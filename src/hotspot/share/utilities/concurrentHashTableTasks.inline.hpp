@@ -160,12 +160,19 @@ class ConcurrentHashTable<VALUE, CONFIG, F>::BulkDeleteTask :
   }
 };
 
+// For doing pausable/parallel grow. One thread calls prepare() and done(),
+// but any number of threads may call do_task() in between to claim and
+// re-size bucket ranges concurrently; the ranges are disjoint and every
+// bucket is locked while its nodes are distributed into the new table.
+// As for BulkDeleteTask, the coordinating thread must not call done()
+// until all concurrent do_task() calls have returned.
 template <typename VALUE, typename CONFIG, MEMFLAGS F>
 class ConcurrentHashTable<VALUE, CONFIG, F>::GrowTask :
   public BucketsOperation
 {
  public:
-  GrowTask(ConcurrentHashTable<VALUE, CONFIG, F>* cht) : BucketsOperation(cht) {
+  GrowTask(ConcurrentHashTable<VALUE, CONFIG, F>* cht, bool is_mt = false)
+    : BucketsOperation(cht, is_mt) {
   }
   // Before start prepare must be called.
   bool prepare(Thread* thread) {
@@ -23,11 +23,23 @@
  */
 
 #include "precompiled.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "utilities/align.hpp"
 #include "utilities/copy.hpp"
 
 
+void Copy::aligned_disjoint_words_bulk(const HeapWord* from, HeapWord* to, size_t count) {
+  assert_params_aligned(from, to);
+  assert_disjoint(from, to, count);
+  if (NonTemporalCopyThreshold != 0 &&
+      count * HeapWordSize >= NonTemporalCopyThreshold) {
+    pd_aligned_disjoint_words_nt(from, to, count);
+  } else {
+    pd_aligned_disjoint_words(from, to, count);
+  }
+}
+
 // Copy bytes; larger units are filled atomically if everything is aligned.
 void Copy::conjoint_memory_atomic(const void* from, void* to, size_t size) {
   uintptr_t bits = (uintptr_t) from | (uintptr_t) to | (uintptr_t) size;
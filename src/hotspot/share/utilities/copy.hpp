@@ -120,6 +120,13 @@ class Copy : AllStatic {
     pd_aligned_disjoint_words(from, to, count);
   }
 
+  // Object-aligned words,  disjoint, not atomic on each word. Intended for
+  // bulk copies such as GC evacuation: copies of at least
+  // NonTemporalCopyThreshold bytes use cache-bypassing streaming stores on
+  // platforms that provide them, so that evacuating large amounts of data
+  // does not evict the working set of the mutators from the cache.
+  static void aligned_disjoint_words_bulk(const HeapWord* from, HeapWord* to, size_t count);
+
   // bytes, jshorts, jints, jlongs, oops
 
   // bytes,                 conjoint, not atomic on each byte (not that it matters)
@@ -344,6 +351,13 @@ class Copy : AllStatic {
   // Platform dependent implementations of the above methods.
 #include CPU_HEADER(copy)
 
+#ifndef PD_HAS_NON_TEMPORAL_COPY
+  // Platforms without streaming stores fall back to a normal copy.
+  static void pd_aligned_disjoint_words_nt(const HeapWord* from, HeapWord* to, size_t count) {
+    pd_aligned_disjoint_words(from, to, count);
+  }
+#endif
+
 };
 
 #endif // SHARE_UTILITIES_COPY_HPP
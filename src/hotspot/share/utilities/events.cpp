@@ -129,8 +129,7 @@ void UnloadingEventLog::log(Thread* thread, InstanceKlass* ik) {
   if (!should_log()) return;
 
   double timestamp = fetch_timestamp();
-  // Unloading events are single threaded.
-  int index = compute_log_index();
+  int index = claim_log_index();
   _records[index].thread = thread;
   _records[index].timestamp = timestamp;
   stringStream st(_records[index].data.buffer(),
@@ -143,8 +142,7 @@ void ExceptionsEventLog::log(Thread* thread, Handle h_exception, const char* mes
   if (!should_log()) return;
 
   double timestamp = fetch_timestamp();
-  MutexLocker ml(&_mutex, Mutex::_no_safepoint_check_flag);
-  int index = compute_log_index();
+  int index = claim_log_index();
   _records[index].thread = thread;
   _records[index].timestamp = timestamp;
   stringStream st(_records[index].data.buffer(),
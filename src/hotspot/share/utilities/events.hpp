@@ -26,6 +26,7 @@
 #define SHARE_UTILITIES_EVENTS_HPP
 
 #include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/thread.hpp"
 #include "utilities/formatBuffer.hpp"
@@ -87,6 +88,7 @@ template <class T> class EventLogBase : public EventLog {
   };
 
  protected:
+  // Serializes concurrent printers only; the log path is lock-free.
   Mutex           _mutex;
   // Name is printed out as a header.
   const char*     _name;
@@ -94,8 +96,11 @@ template <class T> class EventLogBase : public EventLog {
   // for printing (see VM.events command).
   const char*     _handle;
   int             _length;
-  int             _index;
-  int             _count;
+  // Number of events ever logged, modulo the platform word; word-sized so
+  // the 32-bit ports can claim slots with their native atomic add. The
+  // ring slot is derived from it, and a wrap of the counter only restarts
+  // the slot numbering, which is harmless.
+  volatile uintx  _seq;
   EventRecord<T>* _records;
 
  public:
@@ -104,8 +109,7 @@ template <class T> class EventLogBase : public EventLog {
     _name(name),
     _handle(handle),
     _length(length),
-    _index(0),
-    _count(0) {
+    _seq(0) {
     _records = new EventRecord<T>[length];
   }
 
@@ -113,15 +117,15 @@ template <class T> class EventLogBase : public EventLog {
     return os::elapsedTime();
   }
 
-  // move the ring buffer to next open slot and return the index of
-  // the slot to use for the current message.  Should only be called
-  // while mutex is held.
-  int compute_log_index() {
-    int index = _index;
-    if (_count < _length) _count++;
-    _index++;
-    if (_index >= _length) _index = 0;
-    return index;
+  // Claim the next slot of the ring buffer and return its index. The
+  // claim is a single atomic increment, so logging threads never block
+  // each other. A writer that is lapped by a full wrap of the buffer
+  // races with the lapping writer on the same slot and may garble a
+  // record that was about to be overwritten anyway; records are fixed
+  // size text, so such a record prints oddly but stays in bounds.
+  int claim_log_index() {
+    uintx seq = Atomic::add((uintx)1, &_seq) - 1;
+    return (int)(seq % (uintx)_length);
   }
 
   bool should_log() {
@@ -173,8 +177,7 @@ class FormatStringEventLog : public EventLogBase< FormatStringLogMessage<bufsz>
     if (!this->should_log()) return;
 
     double timestamp = this->fetch_timestamp();
-    MutexLocker ml(&this->_mutex, Mutex::_no_safepoint_check_flag);
-    int index = this->compute_log_index();
+    int index = this->claim_log_index();
     this->_records[index].thread = thread;
     this->_records[index].timestamp = timestamp;
     this->_records[index].data.printv(format, ap);
@@ -334,16 +337,20 @@ inline void EventLogBase<T>::print_names(outputStream* out) const {
 // Dump the ring buffer entries that current have entries.
 template <class T>
 inline void EventLogBase<T>::print_log_impl(outputStream* out, int max) {
-  out->print_cr("%s (%d events):", _name, _count);
-  if (_count == 0) {
+  uintx seq = Atomic::load(&_seq);
+  int count = seq < (uintx)_length ? (int)seq : _length;
+  int index = (int)(seq % (uintx)_length);
+
+  out->print_cr("%s (%d events):", _name, count);
+  if (count == 0) {
     out->print_cr("No events");
     out->cr();
     return;
   }
 
   int printed = 0;
-  if (_count < _length) {
-    for (int i = 0; i < _count; i++) {
+  if (count < _length) {
+    for (int i = 0; i < count; i++) {
       if (max > 0 && printed == max) {
         break;
       }
@@ -351,14 +358,14 @@ inline void EventLogBase<T>::print_log_impl(outputStream* out, int max) {
       printed ++;
     }
   } else {
-    for (int i = _index; i < _length; i++) {
+    for (int i = index; i < _length; i++) {
       if (max > 0 && printed == max) {
         break;
       }
       print(out, _records[i]);
       printed ++;
     }
-    for (int i = 0; i < _index; i++) {
+    for (int i = 0; i < index; i++) {
       if (max > 0 && printed == max) {
         break;
       }
@@ -23,8 +23,14 @@
  */
 
 #include "precompiled.hpp"
+#include "utilities/align.hpp"
 #include "utilities/utf8.hpp"
 
+// Constants for the word-at-a-time ASCII fast paths below. A word of
+// UTF-8 bytes is all-ASCII iff none of the bytes has its high bit set.
+static const uintx every_byte = (~(uintx)0) / 0xFF;              // 0x..0101
+static const uintx high_bit_of_each_byte = every_byte << 7;      // 0x..8080
+
 // Assume the utf8 string is in legal form and has been
 // checked in the class file parser/format checker.
 template<typename T> char* UTF8::next(const char* str, T* value) {
@@ -101,7 +107,17 @@ int UTF8::unicode_length(const char* str, int len, bool& is_latin1, bool& has_mu
   has_multibyte = false;
   is_latin1 = true;
   unsigned char prev = 0;
-  for (int i = 0; i < len; i++) {
+  int i = 0;
+  while (i < len) {
+    // ASCII words contain no 10xxxxxx continuation bytes and cannot make
+    // the string non-latin1, so they are skipped a word at a time.
+    if (is_aligned(&str[i], sizeof(uintx)) &&
+        i + (int)sizeof(uintx) <= len &&
+        ((*(const uintx*)&str[i]) & high_bit_of_each_byte) == 0) {
+      i += (int)sizeof(uintx);
+      prev = str[i - 1];
+      continue;
+    }
     unsigned char c = str[i];
     if ((c & 0xC0) == 0x80) {
       // Multibyte, check if valid latin1 character.
@@ -112,6 +128,7 @@ int UTF8::unicode_length(const char* str, int len, bool& is_latin1, bool& has_mu
       --num_chars;
     }
     prev = c;
+    i++;
   }
   return num_chars;
 }
@@ -171,10 +188,21 @@ template<typename T> void UTF8::convert_to_unicode(const char* utf8_str, T* unic
   const char *ptr = utf8_str;
   int index = 0;
 
-  /* ASCII case loop optimization */
-  for (; index < unicode_length; index++) {
+  /* ASCII case loop optimization; aligned words are widened in bulk. A
+     word of remaining output implies at least a word of remaining input. */
+  while (index < unicode_length) {
+    if (is_aligned(ptr, sizeof(uintx)) &&
+        index + (int)sizeof(uintx) <= unicode_length &&
+        ((*(const uintx*)ptr) & high_bit_of_each_byte) == 0) {
+      for (size_t i = 0; i < sizeof(uintx); i++) {
+        unicode_str[index + (int)i] = (T)(unsigned char)ptr[i];
+      }
+      index += (int)sizeof(uintx);
+      ptr += sizeof(uintx);
+      continue;
+    }
     if((ch = ptr[0]) > 0x7F) { break; }
-    unicode_str[index] = (T)ch;
+    unicode_str[index++] = (T)ch;
     ptr = (const char *)(ptr + 1);
   }
 
@@ -435,12 +463,51 @@ int UNICODE::utf8_size(jbyte c) {
   }
 }
 
-template<typename T>
-int UNICODE::utf8_length(const T* base, int length) {
+// Characters in [1, 0x7f] encode as one UTF-8 byte each; whole words of
+// such characters are counted at once. The subtraction trick detects a
+// zero lane, which must be two-byte encoded as 0xC080 in modified UTF-8,
+// given that no lane has its high bit set.
+template<>
+int UNICODE::utf8_length(const jbyte* base, int length) {
   int result = 0;
-  for (int index = 0; index < length; index++) {
-    T c = base[index];
-    result += utf8_size(c);
+  int index = 0;
+  while (index < length) {
+    if (is_aligned(&base[index], sizeof(uintx)) &&
+        index + (int)sizeof(uintx) <= length) {
+      uintx w = *(const uintx*)&base[index];
+      if ((w & high_bit_of_each_byte) == 0 &&
+          ((w - every_byte) & high_bit_of_each_byte) == 0) {
+        result += (int)sizeof(uintx);
+        index += (int)sizeof(uintx);
+        continue;
+      }
+    }
+    result += utf8_size(base[index]);
+    index++;
+  }
+  return result;
+}
+
+template<>
+int UNICODE::utf8_length(const jchar* base, int length) {
+  const uintx every_char = (~(uintx)0) / 0xFFFF;             // 0x..00010001
+  const uintx non_ascii_bits = every_char * 0xFF80;          // 0x..FF80FF80
+  const int chars_per_word = (int)(sizeof(uintx) / sizeof(jchar));
+  int result = 0;
+  int index = 0;
+  while (index < length) {
+    if (is_aligned(&base[index], sizeof(uintx)) &&
+        index + chars_per_word <= length) {
+      uintx w = *(const uintx*)&base[index];
+      if ((w & non_ascii_bits) == 0 &&
+          ((w - every_char) & (every_char << 15)) == 0) {
+        result += chars_per_word;
+        index += chars_per_word;
+        continue;
+      }
+    }
+    result += utf8_size(base[index]);
+    index++;
   }
   return result;
 }
@@ -530,8 +597,6 @@ void UNICODE::as_quoted_ascii(const T* base, int length, char* buf, int buflen)
 }
 
 // Explicit instantiation for all supported types.
-template int UNICODE::utf8_length(const jbyte* base, int length);
-template int UNICODE::utf8_length(const jchar* base, int length);
 template char* UNICODE::as_utf8(const jbyte* base, int& length);
 template char* UNICODE::as_utf8(const jchar* base, int& length);
 template int UNICODE::quoted_ascii_length<jbyte>(const jbyte* base, int length);
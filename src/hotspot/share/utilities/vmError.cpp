@@ -28,6 +28,7 @@
 #include "compiler/compileBroker.hpp"
 #include "compiler/disassembler.hpp"
 #include "gc/shared/gcConfig.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logConfiguration.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "memory/resourceArea.hpp"
@@ -1370,6 +1371,12 @@ void VMError::report_and_die(int id, const char* message, const char* detail_fmt
     // first time
     _error_reported = true;
 
+    // Write out any pending asynchronous log messages. With _error_reported
+    // set, further log messages are written synchronously by the logging
+    // threads themselves, so nothing is lost if the flush thread makes no
+    // more progress.
+    AsyncLogWriter::flush();
+
     reporting_started();
     if (!TestUnresponsiveErrorHandler) {
       // Record reporting_start_time unless we're running the
@@ -37,40 +37,32 @@ void GenericWaitBarrier::arm(int barrier_tag) {
   OrderAccess::fence();
 }
 
-int GenericWaitBarrier::wake_if_needed() {
-  assert(_barrier_tag == 0, "Not disarmed");
-  int w = _waiters;
-  if (w == 0) {
-    // Load of _barrier_threads in caller must not pass the load of _waiters.
-    OrderAccess::loadload();
-    return 0;
-  }
-  assert(w > 0, "Bad counting");
-  // We need an exact count which never goes below zero,
-  // otherwise the semaphore may be signalled too many times.
-  if (Atomic::cmpxchg(w - 1, &_waiters, w) == w) {
-    _sem_barrier.signal();
-    return w - 1;
-  }
-  return w;
-}
-
 void GenericWaitBarrier::disarm() {
   assert(_barrier_tag != 0, "Not armed");
   _barrier_tag = 0;
   // Loads of _barrier_threads/_waiters must not float above disarm store and
   // disarm store must not sink below.
   OrderAccess::fence();
-  int left;
   SpinYield sp;
-  do {
-    left = GenericWaitBarrier::wake_if_needed();
-    if (left == 0 && _barrier_threads > 0) {
-      // There is no thread to wake but we still have barrier threads.
-      sp.wait();
+  while (true) {
+    // Grab the entire set of registered waiters and post the semaphore
+    // once for all of them, instead of one signal per waiter. Waiters
+    // that register after the exchange are picked up by a later round.
+    int w = Atomic::xchg(0, &_waiters);
+    if (w > 0) {
+      _sem_barrier.signal((uint)w);
+      continue;
+    }
+    // Load of _barrier_threads must not pass the load of _waiters.
+    OrderAccess::loadload();
+    if (_barrier_threads == 0) {
+      break;
     }
-    // We must loop here until there are no waiters or potential waiters.
-  } while (left > 0 || _barrier_threads > 0);
+    // There is no thread to wake but we still have barrier threads;
+    // a thread has passed the tag check but not yet registered as a
+    // waiter. We must loop until there are no potential waiters.
+    sp.wait();
+  }
   // API specifies disarm() must provide a trailing fence.
   OrderAccess::fence();
 }
@@ -86,9 +78,6 @@ void GenericWaitBarrier::wait(int barrier_tag) {
   if (barrier_tag != 0 && barrier_tag == _barrier_tag) {
     Atomic::add(1, &_waiters);
     _sem_barrier.wait();
-    // We help out with posting, but we need to do so before we decrement the
-    // _barrier_threads otherwise we might wake threads up in next wait.
-    GenericWaitBarrier::wake_if_needed();
   }
   Atomic::add(-1, &_barrier_threads);
 }
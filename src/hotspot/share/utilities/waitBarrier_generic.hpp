@@ -43,8 +43,6 @@ class GenericWaitBarrier : public CHeapObj<mtInternal> {
   GenericWaitBarrier(const GenericWaitBarrier&);
   GenericWaitBarrier& operator=(const GenericWaitBarrier&);
 
-  int wake_if_needed();
-
  public:
   GenericWaitBarrier() : _barrier_tag(0), _waiters(0), _barrier_threads(0), _sem_barrier(0) {}
   ~GenericWaitBarrier() {}
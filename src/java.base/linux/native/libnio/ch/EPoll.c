@@ -57,14 +57,21 @@ Java_sun_nio_ch_EPoll_dataOffset(JNIEnv* env, jclass clazz)
 
 JNIEXPORT jint JNICALL
 Java_sun_nio_ch_EPoll_create(JNIEnv *env, jclass clazz) {
-    /* size hint not used in modern kernels */
-    int epfd = epoll_create(256);
+    int epfd = epoll_create1(EPOLL_CLOEXEC);
     if (epfd < 0) {
-        JNU_ThrowIOExceptionWithLastError(env, "epoll_create failed");
+        JNU_ThrowIOExceptionWithLastError(env, "epoll_create1 failed");
     }
     return epfd;
 }
 
+/*
+ * ctl passes the caller's event bits through unchanged and wait fills a
+ * caller-supplied native array, so triggering mode (level, EPOLLET,
+ * EPOLLONESHOT) and how the ready events are consumed are entirely the
+ * selector implementation's choice; nothing here needs to change to
+ * experiment with edge-triggered registration.
+ */
+
 JNIEXPORT jint JNICALL
 Java_sun_nio_ch_EPoll_ctl(JNIEnv *env, jclass clazz, jint epfd,
                           jint opcode, jint fd, jint events)
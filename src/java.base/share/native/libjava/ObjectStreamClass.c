@@ -28,6 +28,14 @@
 
 #include "java_io_ObjectStreamClass.h"
 
+/*
+ * Only reflective queries that genuinely need the VM live here.  Bulk
+ * primitive field access for default serialization is not one of them:
+ * FieldReflector on the Java side walks the precomputed offset table
+ * with Unsafe, reading or writing every primitive field of an instance
+ * without any JNI transition, so there is nothing to batch natively.
+ */
+
 static jclass noSuchMethodErrCl;
 
 /*
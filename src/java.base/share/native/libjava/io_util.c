@@ -57,6 +57,17 @@ readSingle(JNIEnv *env, jobject this, jfieldID fid) {
  */
 #define BUF_SIZE 8192
 
+/* The maximum size of a heap-allocated transfer buffer.  Requests larger
+ * than this are served in MAX_MALLOC_SIZE pieces: the intermediate copy
+ * stays cache-resident, and reading or writing a multi-gigabyte array no
+ * longer allocates and touches a native buffer of the same size before
+ * the first byte moves.  Note that the buffer cannot simply be replaced
+ * by pinning the Java array: these are blocking system calls, and a JNI
+ * critical section must not be held across a call that can block
+ * indefinitely.
+ */
+#define MAX_MALLOC_SIZE (128 * 1024)
+
 /*
  * Returns true if the array slice defined by the given offset and length
  * is out of bounds.
@@ -92,6 +103,12 @@ readBytes(JNIEnv *env, jobject this, jbyteArray bytes,
     if (len == 0) {
         return 0;
     } else if (len > BUF_SIZE) {
+        if (len > MAX_MALLOC_SIZE) {
+            /* Returning a short read here is fine; the read contract
+             * allows fewer bytes than requested and callers loop.
+             */
+            len = MAX_MALLOC_SIZE;
+        }
         buf = malloc(len);
         if (buf == NULL) {
             JNU_ThrowOutOfMemoryError(env, NULL);
@@ -149,6 +166,7 @@ writeBytes(JNIEnv *env, jobject this, jbyteArray bytes,
     jint n;
     char stackBuf[BUF_SIZE];
     char *buf = NULL;
+    jint bufLen;
     FD fd;
 
     if (IS_NULL(bytes)) {
@@ -164,37 +182,43 @@ writeBytes(JNIEnv *env, jobject this, jbyteArray bytes,
     if (len == 0) {
         return;
     } else if (len > BUF_SIZE) {
-        buf = malloc(len);
+        bufLen = (len < MAX_MALLOC_SIZE) ? len : MAX_MALLOC_SIZE;
+        buf = malloc(bufLen);
         if (buf == NULL) {
             JNU_ThrowOutOfMemoryError(env, NULL);
             return;
         }
     } else {
+        bufLen = len;
         buf = stackBuf;
     }
 
-    (*env)->GetByteArrayRegion(env, bytes, off, len, (jbyte *)buf);
-
-    if (!(*env)->ExceptionOccurred(env)) {
-        off = 0;
-        while (len > 0) {
+    while (len > 0 && !(*env)->ExceptionOccurred(env)) {
+        jint cnt = (len < bufLen) ? len : bufLen;
+        jint pos = 0;
+        (*env)->GetByteArrayRegion(env, bytes, off, cnt, (jbyte *)buf);
+        if ((*env)->ExceptionOccurred(env)) {
+            break;
+        }
+        while (pos < cnt) {
             fd = GET_FD(this, fid);
             if (fd == -1) {
                 JNU_ThrowIOException(env, "Stream Closed");
                 break;
             }
             if (append == JNI_TRUE) {
-                n = IO_Append(fd, buf+off, len);
+                n = IO_Append(fd, buf+pos, cnt-pos);
             } else {
-                n = IO_Write(fd, buf+off, len);
+                n = IO_Write(fd, buf+pos, cnt-pos);
             }
             if (n == -1) {
                 JNU_ThrowIOExceptionWithLastError(env, "Write error");
                 break;
             }
-            off += n;
-            len -= n;
+            pos += n;
         }
+        off += cnt;
+        len -= cnt;
     }
     if (buf != stackBuf) {
         free(buf);
@@ -105,18 +105,18 @@ s4 ImageStrings::find(Endian* endian, const char* name, s4* redirect, u4 length)
 // NULL.    Used to test sections of a path without copying from image string
 // table.
 const char* ImageStrings::starts_with(const char* string, const char* start) {
-    char ch1, ch2;
-    // Match up the strings the best we can.
-    while ((ch1 = *string) && (ch2 = *start)) {
-        if (ch1 != ch2) {
-            // Mismatch, return NULL.
-            return NULL;
-        }
-        // Next characters.
-        string++, start++;
+    size_t length = strlen(start);
+    // Let the C library do the scan; its strncmp compares a word at a time
+    // where the old byte loop did not, and resource verification does this
+    // for every component of every looked-up path.  Unlike the old loop
+    // this also rejects a string that ends in the middle of start instead
+    // of returning its terminator as the "remainder".
+    if (strncmp(string, start, length) != 0) {
+        // Mismatch, return NULL.
+        return NULL;
     }
     // Return remainder of string.
-    return string;
+    return string + length;
 }
 
 // Inflates the attribute stream into individual values stored in the long
@@ -298,6 +298,7 @@ find_positions(int fd, Byte *eb, jlong* base_offset, jlong* censtart)
 
 #define BUFSIZE (3 * 65536 + CENHDR + SIGSIZ)
 #define MINREAD 1024
+#define MAXREAD 65536
 
 /*
  * Locate the manifest file with the zip/jar file.
@@ -324,7 +325,10 @@ find_positions(int fd, Byte *eb, jlong* base_offset, jlong* censtart)
  *
  * In most cases, all that needs to be read are the first two entries in
  * a typical jar file (META-INF and META-INF/MANIFEST.MF). Keep this factoid
- * in mind when optimizing this code.
+ * in mind when optimizing this code.  That is why refills start out at
+ * MINREAD; the chunk size doubles up to MAXREAD on each refill so that a
+ * jar whose manifest sits at the far end of a large central directory is
+ * scanned with a few dozen reads rather than one per kilobyte.
  */
 static int
 find_file(int fd, zentry *entry, const char *file_name)
@@ -333,6 +337,8 @@ find_file(int fd, zentry *entry, const char *file_name)
     int     res;
     int     entry_size;
     int     read_size;
+    int     chunk_size;
+    size_t  file_name_len;
 
     /*
      * The (imaginary) position within the file relative to which
@@ -374,6 +380,8 @@ find_file(int fd, zentry *entry, const char *file_name)
         free(buffer);
         return (-1);
     }
+    chunk_size = MINREAD;
+    file_name_len = JLI_StrLen(file_name);
     p = bp;
     /*
      * Loop through the Central Directory Headers. Note that a valid zip/jar
@@ -392,23 +400,31 @@ find_file(int fd, zentry *entry, const char *file_name)
          */
         if (bytes < CENHDR) {
             p = memmove(bp, p, bytes);
-            if ((res = read(fd, bp + bytes, MINREAD)) <= 0) {
+            read_size = (chunk_size < BUFSIZE - bytes) ?
+                chunk_size : BUFSIZE - bytes;
+            if ((res = read(fd, bp + bytes, read_size)) <= 0) {
                 free(buffer);
                 return (-1);
             }
             bytes += res;
+            if (chunk_size < MAXREAD)
+                chunk_size <<= 1;
         }
         entry_size = CENHDR + CENNAM(p) + CENEXT(p) + CENCOM(p);
         if (bytes < entry_size + SIGSIZ) {
             if (p != bp)
                 p = memmove(bp, p, bytes);
             read_size = entry_size - bytes + SIGSIZ;
-            read_size = (read_size < MINREAD) ? MINREAD : read_size;
+            read_size = (read_size < chunk_size) ? chunk_size : read_size;
+            read_size = (read_size < BUFSIZE - bytes) ?
+                read_size : BUFSIZE - bytes;
             if ((res = read(fd, bp + bytes,  read_size)) <= 0) {
                 free(buffer);
                 return (-1);
             }
             bytes += res;
+            if (chunk_size < MAXREAD)
+                chunk_size <<= 1;
         }
 
         /*
@@ -416,8 +432,8 @@ find_file(int fd, zentry *entry, const char *file_name)
          * manifest.  If so, build the entry record from the data found in
          * the header located and return success.
          */
-        if ((size_t)CENNAM(p) == JLI_StrLen(file_name) &&
-          memcmp((p + CENHDR), file_name, JLI_StrLen(file_name)) == 0) {
+        if ((size_t)CENNAM(p) == file_name_len &&
+          memcmp((p + CENHDR), file_name, file_name_len) == 0) {
             if (JLI_Lseek(fd, base_offset + CENOFF(p), SEEK_SET) < (jlong)0) {
                 free(buffer);
                 return (-1);
@@ -42,6 +42,13 @@
 #define ThrowDataFormatException(env, msg) \
         JNU_ThrowByName(env, "java/util/zip/DataFormatException", msg)
 
+/*
+ * Process at most this many bytes per primitive array critical section.
+ * Pinned arrays keep the collector disabled, so a multi-gigabyte inflate
+ * must not hold its input and output arrays across the whole operation.
+ */
+#define INFLATE_CHUNK (512 * 1024)
+
 static jfieldID inputConsumedID;
 static jfieldID outputConsumedID;
 
@@ -141,11 +148,17 @@ static jint doInflate(jlong addr,
     return ret;
 }
 
+/*
+ * Translates the result of the last inflate() call plus the accumulated
+ * consumption counts into the packed jlong the Java side expects.  The
+ * counts are passed in by the caller because a single native call may
+ * have run several inflate() rounds; for a no-progress Z_BUF_ERROR they
+ * are simply both zero.
+ */
 static jlong checkInflateStatus(JNIEnv *env, jobject this, jlong addr,
-                        jint inputLen, jint outputLen, jint ret )
+                        jint inputUsed, jint outputUsed, jint ret )
 {
     z_stream *strm = jlong_to_ptr(addr);
-    jint inputUsed = 0, outputUsed = 0;
     int finished = 0;
     int needDict = 0;
 
@@ -154,22 +167,16 @@ static jlong checkInflateStatus(JNIEnv *env, jobject this, jlong addr,
         finished = 1;
         /* fall through */
     case Z_OK:
-        inputUsed = inputLen - strm->avail_in;
-        outputUsed = outputLen - strm->avail_out;
         break;
     case Z_NEED_DICT:
+        /* Might have consumed some input here, and zlib is unclear
+           about whether output may be produced; the counts cover it. */
         needDict = 1;
-        /* Might have consumed some input here! */
-        inputUsed = inputLen - strm->avail_in;
-        /* zlib is unclear about whether output may be produced */
-        outputUsed = outputLen - strm->avail_out;
         break;
     case Z_BUF_ERROR:
         break;
     case Z_DATA_ERROR:
-        inputUsed = inputLen - strm->avail_in;
         (*env)->SetIntField(env, this, inputConsumedID, inputUsed);
-        outputUsed = outputLen - strm->avail_out;
         (*env)->SetIntField(env, this, outputConsumedID, outputUsed);
         ThrowDataFormatException(env, strm->msg);
         break;
@@ -188,32 +195,64 @@ Java_java_util_zip_Inflater_inflateBytesBytes(JNIEnv *env, jobject this, jlong a
                                          jbyteArray inputArray, jint inputOff, jint inputLen,
                                          jbyteArray outputArray, jint outputOff, jint outputLen)
 {
-    jbyte *input = (*env)->GetPrimitiveArrayCritical(env, inputArray, 0);
-    jbyte *output;
+    z_stream *strm = jlong_to_ptr(addr);
+    jint inputUsed = 0, outputUsed = 0;
     jint ret;
-    jlong retVal;
 
-    if (input == NULL) {
-        if (inputLen != 0 && (*env)->ExceptionOccurred(env) == NULL)
-            JNU_ThrowOutOfMemoryError(env, 0);
-        return 0L;
-    }
-    output = (*env)->GetPrimitiveArrayCritical(env, outputArray, 0);
-    if (output == NULL) {
-        (*env)->ReleasePrimitiveArrayCritical(env, inputArray, input, 0);
-        if (outputLen != 0 && (*env)->ExceptionOccurred(env) == NULL)
-            JNU_ThrowOutOfMemoryError(env, 0);
-        return 0L;
-    }
+    /*
+     * Inflate in rounds of at most INFLATE_CHUNK bytes, unpinning both
+     * arrays between rounds so the collector can run during a large
+     * request.  The arrays may move while unpinned, so the raw pointers
+     * have to be re-fetched every time around the loop; the zlib stream
+     * state carries over from round to round untouched.
+     */
+    for (;;) {
+        jint inChunk = inputLen - inputUsed;
+        jint outChunk = outputLen - outputUsed;
+        jint inUsed, outUsed;
+        jbyte *input, *output;
+
+        if (inChunk > INFLATE_CHUNK)
+            inChunk = INFLATE_CHUNK;
+        if (outChunk > INFLATE_CHUNK)
+            outChunk = INFLATE_CHUNK;
+
+        input = (*env)->GetPrimitiveArrayCritical(env, inputArray, 0);
+        if (input == NULL) {
+            if (inputLen != 0 && (*env)->ExceptionOccurred(env) == NULL)
+                JNU_ThrowOutOfMemoryError(env, 0);
+            return 0L;
+        }
+        output = (*env)->GetPrimitiveArrayCritical(env, outputArray, 0);
+        if (output == NULL) {
+            (*env)->ReleasePrimitiveArrayCritical(env, inputArray, input, 0);
+            if (outputLen != 0 && (*env)->ExceptionOccurred(env) == NULL)
+                JNU_ThrowOutOfMemoryError(env, 0);
+            return 0L;
+        }
 
-    ret = doInflate(addr, input + inputOff, inputLen, output + outputOff,
-                    outputLen);
+        ret = doInflate(addr, input + inputOff + inputUsed, inChunk,
+                        output + outputOff + outputUsed, outChunk);
 
-    (*env)->ReleasePrimitiveArrayCritical(env, outputArray, output, 0);
-    (*env)->ReleasePrimitiveArrayCritical(env, inputArray, input, 0);
+        (*env)->ReleasePrimitiveArrayCritical(env, outputArray, output, 0);
+        (*env)->ReleasePrimitiveArrayCritical(env, inputArray, input, 0);
 
-    retVal = checkInflateStatus(env, this, addr, inputLen, outputLen, ret );
-    return retVal;
+        inUsed = inChunk - strm->avail_in;
+        outUsed = outChunk - strm->avail_out;
+        inputUsed += inUsed;
+        outputUsed += outUsed;
+
+        if (ret != Z_OK)
+            break;
+        if (outputUsed == outputLen)
+            break;  /* out of output space */
+        if (inputUsed == inputLen && outUsed < outChunk)
+            break;  /* input consumed and pending output drained */
+        if (inUsed == 0 && outUsed == 0)
+            break;  /* no progress; report what we have */
+    }
+
+    return checkInflateStatus(env, this, addr, inputUsed, outputUsed, ret);
 }
 
 JNIEXPORT jlong JNICALL
@@ -221,6 +260,7 @@ Java_java_util_zip_Inflater_inflateBytesBuffer(JNIEnv *env, jobject this, jlong
                                          jbyteArray inputArray, jint inputOff, jint inputLen,
                                          jlong outputBuffer, jint outputLen)
 {
+    z_stream *strm = jlong_to_ptr(addr);
     jbyte *input = (*env)->GetPrimitiveArrayCritical(env, inputArray, 0);
     jbyte *output;
     jint ret;
@@ -236,7 +276,8 @@ Java_java_util_zip_Inflater_inflateBytesBuffer(JNIEnv *env, jobject this, jlong
     ret = doInflate(addr, input + inputOff, inputLen, output, outputLen);
 
     (*env)->ReleasePrimitiveArrayCritical(env, inputArray, input, 0);
-    retVal = checkInflateStatus(env, this, addr, inputLen, outputLen, ret );
+    retVal = checkInflateStatus(env, this, addr, inputLen - strm->avail_in,
+                                outputLen - strm->avail_out, ret);
 
     return retVal;
 }
@@ -246,6 +287,7 @@ Java_java_util_zip_Inflater_inflateBufferBytes(JNIEnv *env, jobject this, jlong
                                          jlong inputBuffer, jint inputLen,
                                          jbyteArray outputArray, jint outputOff, jint outputLen)
 {
+    z_stream *strm = jlong_to_ptr(addr);
     jbyte *input = jlong_to_ptr(inputBuffer);
     jbyte *output = (*env)->GetPrimitiveArrayCritical(env, outputArray, 0);
     jint ret;
@@ -260,7 +302,8 @@ Java_java_util_zip_Inflater_inflateBufferBytes(JNIEnv *env, jobject this, jlong
     ret = doInflate(addr, input, inputLen, output  + outputOff, outputLen);
 
     (*env)->ReleasePrimitiveArrayCritical(env, outputArray, output, 0);
-    retVal = checkInflateStatus(env, this, addr, inputLen, outputLen, ret );
+    retVal = checkInflateStatus(env, this, addr, inputLen - strm->avail_in,
+                                outputLen - strm->avail_out, ret);
 
     return retVal;
 }
@@ -270,13 +313,15 @@ Java_java_util_zip_Inflater_inflateBufferBuffer(JNIEnv *env, jobject this, jlong
                                          jlong inputBuffer, jint inputLen,
                                          jlong outputBuffer, jint outputLen)
 {
+    z_stream *strm = jlong_to_ptr(addr);
     jbyte *input = jlong_to_ptr(inputBuffer);
     jbyte *output = jlong_to_ptr(outputBuffer);
     jint ret;
     jlong retVal;
 
     ret = doInflate(addr, input, inputLen, output, outputLen);
-    retVal = checkInflateStatus(env, this, addr, inputLen, outputLen, ret);
+    retVal = checkInflateStatus(env, this, addr, inputLen - strm->avail_in,
+                                outputLen - strm->avail_out, ret);
     return retVal;
 }
 
@@ -563,6 +563,22 @@ if (1) { zip->msg = message; goto Catch; } else ((void)0)
  * CEN header, otherwise returns -1 if an error occurred. If zip->msg != NULL
  * then the error was a zip format error and zip->msg has the error text.
  * Always pass in -1 for knownTotal; it's used for a recursive call.
+ *
+ * A note on sharing this work between processes: the index built here is
+ * deliberately position-independent (jzcell holds only a name hash, a file
+ * offset and a chain index, see zip_util.h), so in principle it could be
+ * dumped to a sidecar file keyed by dev/inode/mtime and mapped read-only
+ * by every VM on a host instead of being rebuilt per process.  We have
+ * chosen not to do that:
+ * 1. The dominant per-process cost is reading the CEN bytes themselves,
+ *    and with USE_MMAP those pages are already shared between processes
+ *    through the page cache; only the small derived table is private.
+ * 2. The Java class library parses central directories on its own, so
+ *    this code runs only for jars the VM itself opens (bootclasspath
+ *    appends, instrumentation agents), not the application class path.
+ * 3. An mtime-keyed cache consulted while loading classes is an easy
+ *    spoofing target; validating it thoroughly costs about as much as
+ *    the parse it would replace.
  */
 static jlong
 readCEN(jzfile *zip, jint knownTotal)
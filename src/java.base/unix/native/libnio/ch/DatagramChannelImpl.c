@@ -121,6 +121,16 @@ Java_sun_nio_ch_DatagramChannelImpl_disconnect0(JNIEnv *env, jobject this,
         handleSocketError(env, errno);
 }
 
+/*
+ * One datagram per syscall.  Batching with recvmmsg/sendmmsg would need
+ * a bulk API on the channel itself -- an array of packet buffers going
+ * down and per-packet lengths and sender addresses coming back -- since
+ * the existing receive/send contract returns one sender and one length.
+ * A native-only batch under the current contract would have to buffer
+ * packets between calls, which changes drop semantics (packets queued in
+ * user space survive a close that kernel-queued packets would not) and
+ * moves the SO_RCVBUF accounting applications actually tune against.
+ */
 JNIEXPORT jint JNICALL
 Java_sun_nio_ch_DatagramChannelImpl_receive0(JNIEnv *env, jobject this,
                                              jobject fdo, jlong address,
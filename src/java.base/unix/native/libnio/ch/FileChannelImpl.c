@@ -136,8 +136,22 @@ Java_sun_nio_ch_FileChannelImpl_transferTo0(JNIEnv *env, jobject this,
     if (n < 0) {
         if (errno == EAGAIN)
             return IOS_UNAVAILABLE;
-        if ((errno == EINVAL) && ((ssize_t)count >= 0))
-            return IOS_UNSUPPORTED_CASE;
+        if (errno == EINVAL) {
+            /* sendfile refuses some destinations, a pipe being the common
+             * one.  splice can move file pages into a pipe without copying,
+             * so try it before reporting the case unsupported and forcing
+             * the caller into its buffer-loop fallback.
+             */
+            offset = (off64_t)position;
+            n = splice(srcFD, &offset, dstFD, NULL, (size_t)count,
+                       SPLICE_F_MOVE);
+            if (n >= 0)
+                return n;
+            if (errno == EAGAIN)
+                return IOS_UNAVAILABLE;
+            if ((errno == EINVAL) && ((ssize_t)count >= 0))
+                return IOS_UNSUPPORTED_CASE;
+        }
         if (errno == EINTR) {
             return IOS_INTERRUPTED;
         }
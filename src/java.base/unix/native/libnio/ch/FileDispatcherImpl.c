@@ -95,6 +95,15 @@ Java_sun_nio_ch_FileDispatcherImpl_pread0(JNIEnv *env, jclass clazz, jobject fdo
     return convertReturnVal(env, pread64(fd, buf, len, offset), JNI_TRUE);
 }
 
+/*
+ * The iovec array at 'address' is built and cached on the Java side
+ * (IOVecWrapper keeps a per-thread native array that is reused across
+ * calls), and 'len' arrives already clamped to IOV_MAX.  Keep these at
+ * one syscall per JNI call rather than looping over IOV_MAX-sized
+ * groups here: channel interruption relies on a signal unblocking the
+ * kernel call and control returning to Java, and a native batch loop
+ * would keep running groups after the thread was interrupted.
+ */
 JNIEXPORT jlong JNICALL
 Java_sun_nio_ch_FileDispatcherImpl_readv0(JNIEnv *env, jclass clazz,
                               jobject fdo, jlong address, jint len)
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef BENCHMARKHELPER_HPP
+#define BENCHMARKHELPER_HPP
+
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/ticks.hpp"
+
+// Support for writing microbenchmarks of VM primitives as gtests, in
+// the spirit of test_oopStorage_parperf.cpp.  A benchmark is an
+// ordinary TEST_VM whose body hands a functor to run_benchmark(); the
+// helper runs the warmup iterations, times the measured iterations
+// with Ticks, and prints one machine-readable line
+//
+//   [benchmark] <name>: iterations=<n> total_ns=<ns> ns_per_op=<ns>
+//
+// which CI can grep out of the gtest log to track per changeset.  Keep
+// iteration counts modest: these runs ride along with the correctness
+// suite and provide trend data, not publication-grade numbers.
+
+template<typename Body>
+void run_benchmark(const char* name, uint warmup, uint iterations, Body& body) {
+  for (uint i = 0; i < warmup; i++) {
+    body();
+  }
+  Ticks start = Ticks::now();
+  for (uint i = 0; i < iterations; i++) {
+    body();
+  }
+  Tickspan elapsed = Ticks::now() - start;
+  uint64_t total_ns = elapsed.nanoseconds();
+  uint64_t per_op = (iterations == 0) ? 0 : total_ns / iterations;
+  tty->print_cr("[benchmark] %s: iterations=%u total_ns=" UINT64_FORMAT
+                " ns_per_op=" UINT64_FORMAT,
+                name, iterations, total_ns, per_op);
+}
+
+#endif // BENCHMARKHELPER_HPP
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "memory/allocation.hpp"
+#include "benchmarkHelper.hpp"
+#include "unittest.hpp"
+
+// Microbenchmarks for the GenericTaskQueue fast paths.  The owner-side
+// push/pop_local pair is the inner loop of every GC worker, and
+// pop_global is the stealing path; both are sensitive to the fence
+// placement in taskqueue.inline.hpp, which these numbers track.
+
+typedef GenericTaskQueue<uintptr_t, mtInternal> PerfTaskQueue;
+
+static const uint taskqueue_perf_warmup     = 10000;
+static const uint taskqueue_perf_iterations = 1000000;
+
+struct TaskQueuePushPopLocalBody {
+  PerfTaskQueue* _queue;
+
+  TaskQueuePushPopLocalBody(PerfTaskQueue* queue) : _queue(queue) {}
+
+  void operator()() {
+    _queue->push((uintptr_t)1);
+    uintptr_t e;
+    _queue->pop_local(e);
+  }
+};
+
+TEST_VM(TaskQueuePerf, push_pop_local) {
+  PerfTaskQueue queue;
+  queue.initialize();
+  TaskQueuePushPopLocalBody body(&queue);
+  run_benchmark("GenericTaskQueue push/pop_local",
+                taskqueue_perf_warmup, taskqueue_perf_iterations, body);
+  ASSERT_EQ(0u, queue.size());
+}
+
+struct TaskQueuePushPopGlobalBody {
+  PerfTaskQueue* _queue;
+
+  TaskQueuePushPopGlobalBody(PerfTaskQueue* queue) : _queue(queue) {}
+
+  void operator()() {
+    _queue->push((uintptr_t)1);
+    uintptr_t e;
+    _queue->pop_global(e);
+  }
+};
+
+// Single-threaded, so this measures the stealing path's instruction
+// cost (including its cmpxchg) without cache line contention.
+TEST_VM(TaskQueuePerf, push_pop_global) {
+  PerfTaskQueue queue;
+  queue.initialize();
+  TaskQueuePushPopGlobalBody body(&queue);
+  run_benchmark("GenericTaskQueue push/pop_global",
+                taskqueue_perf_warmup, taskqueue_perf_iterations, body);
+  ASSERT_EQ(0u, queue.size());
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "runtime/atomic.hpp"
+#include "benchmarkHelper.hpp"
+#include "unittest.hpp"
+
+// Microbenchmarks for the uncontended Atomic fast paths.  Contended
+// cost is dominated by cache line transfer and is workload dependent;
+// what these track is the single-thread latency of the primitives
+// themselves, which regresses when the platform-specific backends or
+// the template dispatch above them change.
+
+static const uint atomic_perf_warmup     = 10000;
+static const uint atomic_perf_iterations = 1000000;
+
+struct AtomicAddBody {
+  volatile intptr_t _counter;
+
+  AtomicAddBody() : _counter(0) {}
+
+  void operator()() {
+    Atomic::add((intptr_t)1, &_counter);
+  }
+};
+
+TEST_VM(AtomicPerf, add) {
+  AtomicAddBody body;
+  run_benchmark("Atomic::add (uncontended)",
+                atomic_perf_warmup, atomic_perf_iterations, body);
+  ASSERT_EQ((intptr_t)(atomic_perf_warmup + atomic_perf_iterations),
+            body._counter);
+}
+
+struct AtomicCmpxchgBody {
+  volatile intptr_t _value;
+
+  AtomicCmpxchgBody() : _value(0) {}
+
+  void operator()() {
+    intptr_t v = _value;
+    Atomic::cmpxchg(v + 1, &_value, v);
+  }
+};
+
+TEST_VM(AtomicPerf, cmpxchg) {
+  AtomicCmpxchgBody body;
+  run_benchmark("Atomic::cmpxchg (uncontended, always succeeds)",
+                atomic_perf_warmup, atomic_perf_iterations, body);
+  ASSERT_EQ((intptr_t)(atomic_perf_warmup + atomic_perf_iterations),
+            body._value);
+}
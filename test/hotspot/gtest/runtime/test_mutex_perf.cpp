@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "runtime/mutex.hpp"
+#include "benchmarkHelper.hpp"
+#include "unittest.hpp"
+
+// Microbenchmark for the uncontended Mutex fast path.  Most VM-internal
+// lock acquisitions are uncontended, so the cost of an acquire/release
+// pair with no waiters is the number that matters for the locks that
+// sit on allocation and handshake paths.
+
+struct MutexLockUnlockBody {
+  Mutex* _mutex;
+
+  MutexLockUnlockBody(Mutex* mutex) : _mutex(mutex) {}
+
+  void operator()() {
+    _mutex->lock_without_safepoint_check();
+    _mutex->unlock();
+  }
+};
+
+TEST_VM(MutexPerf, lock_unlock_uncontended) {
+  Mutex mutex(Mutex::leaf, "MutexPerf_lock", false, Monitor::_safepoint_check_never);
+  MutexLockUnlockBody body(&mutex);
+  run_benchmark("Mutex lock/unlock (uncontended)", 10000, 500000, body);
+}
@@ -376,10 +376,49 @@ static void cht_task_grow(Thread* thr) {
   delete cht;
 }
 
+static void cht_bulk_insert(Thread* thr) {
+  uintptr_t existing = 0x30;
+  SimpleTestLookup stl_existing(existing);
+  SimpleTestTable* cht = new SimpleTestTable();
+
+  EXPECT_TRUE(cht->insert(thr, stl_existing, existing)) << "Insert unique value failed.";
+
+  // 0x30 duplicates an entry already in the table and 0x20 occurs twice
+  // in the batch itself; neither may end up inserted twice.
+  const size_t len = 6;
+  uintptr_t vals[len] = { 0x10, 0x20, 0x30, 0x40, 0x20, 0x50 };
+  SimpleTestLookup stls[len] = {
+    SimpleTestLookup(vals[0]), SimpleTestLookup(vals[1]), SimpleTestLookup(vals[2]),
+    SimpleTestLookup(vals[3]), SimpleTestLookup(vals[4]), SimpleTestLookup(vals[5])
+  };
+
+  bool grow_hint = false;
+  size_t inserted = cht->bulk_insert(thr, stls, vals, len, &grow_hint);
+  EXPECT_EQ(inserted, (size_t)4) << "Only the four non-duplicate values should be inserted.";
+
+  for (size_t i = 0; i < len; i++) {
+    cht_find(thr, cht, vals[i]);
+  }
+
+  // Each value must be present exactly once: one remove must succeed and
+  // leave nothing behind.
+  for (uintptr_t v = 0x10; v <= 0x50; v += 0x10) {
+    SimpleTestLookup stl(v);
+    EXPECT_TRUE(cht->remove(thr, stl)) << "Removing a bulk-inserted value failed.";
+    EXPECT_NE(cht_get_copy(cht, thr, stl), v) << "Bulk insert created a duplicate.";
+  }
+
+  delete cht;
+}
+
 TEST_VM(ConcurrentHashTable, basic_insert) {
   nomt_test_doer(cht_insert);
 }
 
+TEST_VM(ConcurrentHashTable, basic_bulk_insert) {
+  nomt_test_doer(cht_bulk_insert);
+}
+
 TEST_VM(ConcurrentHashTable, basic_get_insert) {
   nomt_test_doer(cht_get_insert);
 }
@@ -1029,3 +1068,126 @@ public:
 TEST_VM(ConcurrentHashTable, concurrent_mt_bulk_delete) {
   mt_test_doer<Driver_BD_Thread>();
 }
+
+//#############################################################################################
+
+#define BI_GROW_BATCH 128
+#define BI_GROW_ROUNDS 64
+#define BI_GROW_INSERTER_COUNT 4
+#define BI_GROW_WORKER_COUNT 2
+
+// TestLookup with a default constructor so batches of lookups can live in
+// an array and be refilled per round.
+struct TestLookupDefault : public TestLookup {
+  TestLookupDefault() : TestLookup(0) {}
+  void set(uintptr_t val) { _val = val; }
+};
+
+class MT_Grow_Thread : public JavaTestThread {
+  TestTable::GrowTask* _gt;
+  public:
+  MT_Grow_Thread(Semaphore* post, TestTable::GrowTask* gt)
+    : JavaTestThread(post), _gt(gt) {}
+  virtual ~MT_Grow_Thread() {}
+  void main_run() {
+    while (_gt->do_task(this)) { /* grow */ }
+  }
+};
+
+class MT_BI_Thread : public JavaTestThread {
+  TestTable* _cht;
+  uintptr_t _start;
+  public:
+  MT_BI_Thread(Semaphore* post, TestTable* cht, uintptr_t start)
+    : JavaTestThread(post), _cht(cht), _start(start) {}
+  virtual ~MT_BI_Thread() {}
+  void main_run() {
+    // Each thread owns a disjoint value range, so every batch must be
+    // inserted completely even while the table is growing underneath it.
+    TestLookupDefault tls[BI_GROW_BATCH];
+    uintptr_t vals[BI_GROW_BATCH];
+    for (int round = 0; round < BI_GROW_ROUNDS; round++) {
+      uintptr_t base = _start + (uintptr_t)round * BI_GROW_BATCH;
+      for (size_t i = 0; i < BI_GROW_BATCH; i++) {
+        vals[i] = base + i;
+        tls[i].set(vals[i]);
+      }
+      size_t inserted = _cht->bulk_insert(this, tls, vals, (size_t)BI_GROW_BATCH);
+      EXPECT_EQ(inserted, (size_t)BI_GROW_BATCH) << "A batch of unique values should insert completely.";
+      for (size_t i = 0; i < BI_GROW_BATCH; i++) {
+        TestLookup tl(vals[i]);
+        EXPECT_EQ(cht_get_copy(_cht, this, tl), vals[i]) << "Getting a bulk-inserted value failed.";
+      }
+    }
+  }
+};
+
+class Driver_BI_Grow_Thread : public JavaTestThread {
+public:
+  Driver_BI_Grow_Thread(Semaphore* post) : JavaTestThread(post) {}
+  virtual ~Driver_BI_Grow_Thread() {}
+
+  void main_run() {
+    Semaphore insert_done(0);
+    Semaphore grow_done(0);
+    TestTable* cht = new TestTable(START_SIZE, END_SIZE, 2);
+
+    // Start the bulk inserters first so their batches race the grows and
+    // have to retry values whose buckets a resize has locked.
+    MT_BI_Thread* ins[BI_GROW_INSERTER_COUNT];
+    for (int i = 0; i < BI_GROW_INSERTER_COUNT; i++) {
+      ins[i] = new MT_BI_Thread(&insert_done, cht,
+                                (uintptr_t)0x10000 * (i + 1));
+      ins[i]->doit();
+    }
+
+    // Grow one step at a time with multiple threads claiming ranges of
+    // the same GrowTask, until the maximum size is reached.
+    while (true) {
+      TestTable::GrowTask gt(cht, true /* mt */);
+      if (!gt.prepare(this)) {
+        break; // max size reached
+      }
+      MT_Grow_Thread* gw[BI_GROW_WORKER_COUNT];
+      for (int i = 0; i < BI_GROW_WORKER_COUNT; i++) {
+        gw[i] = new MT_Grow_Thread(&grow_done, &gt);
+        gw[i]->doit();
+      }
+      for (int i = 0; i < BI_GROW_WORKER_COUNT; i++) {
+        grow_done.wait();
+      }
+      gt.done(this);
+    }
+    EXPECT_EQ(cht->get_size_log2(this), (size_t)END_SIZE) << "Table should have grown to max size.";
+
+    for (int i = 0; i < BI_GROW_INSERTER_COUNT; i++) {
+      insert_done.wait();
+    }
+
+    // Every value must have survived the grows, and the scan count must
+    // match the total so nothing was inserted twice.
+    for (int i = 0; i < BI_GROW_INSERTER_COUNT; i++) {
+      for (uintptr_t v = (uintptr_t)0x10000 * (i + 1);
+           v < (uintptr_t)0x10000 * (i + 1) + BI_GROW_ROUNDS * BI_GROW_BATCH; v++) {
+        TestLookup tl(v);
+        EXPECT_EQ(cht_get_copy(cht, this, tl), v) << "Getting a bulk-inserted value after grow failed.";
+      }
+    }
+    Count cnt;
+    cht->do_scan(this, cnt);
+    EXPECT_EQ(cnt._cnt, (size_t)(BI_GROW_INSERTER_COUNT * BI_GROW_ROUNDS * BI_GROW_BATCH))
+        << "Bulk insert racing grow lost or duplicated values.";
+
+    delete cht;
+  }
+
+  struct Count {
+    Count() : _cnt(0) {}
+    size_t _cnt;
+    bool operator()(uintptr_t*) { _cnt++; return true; };
+  };
+};
+
+TEST_VM(ConcurrentHashTable, concurrent_bulk_insert_grow) {
+  mt_test_doer<Driver_BI_Grow_Thread>();
+}